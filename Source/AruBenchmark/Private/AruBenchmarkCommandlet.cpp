@@ -0,0 +1,83 @@
+#include "AruBenchmarkCommandlet.h"
+#include "AruBenchmark.h"
+#include "AruBenchmarkGenerator.h"
+#include "AruBenchmarkSuite.h"
+#include "AruBenchmarkTypes.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AruBenchmarkCommandlet)
+
+UAruBenchmarkCommandlet::UAruBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAruBenchmarkCommandlet::Main(const FString& Params)
+{
+	const FAruBenchmarkShape Shape = FAruBenchmarkShape::FromCommandLine(*Params);
+
+	int32 Iterations = 5;
+	int32 WarmupIterations = 1;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	FParse::Value(*Params, TEXT("Warmup="), WarmupIterations);
+
+	TArray<FString> ScenarioFilter;
+	if (FString ScenarioList; FParse::Value(*Params, TEXT("Scenarios="), ScenarioList, false))
+	{
+		ScenarioList.ParseIntoArray(ScenarioFilter, TEXT(","));
+	}
+
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("AruBenchmark") / FString::Printf(TEXT("Throughput-%s.json"), *FDateTime::Now().ToString());
+	}
+
+	FAruProcessConfig Configs;
+	Configs.MaxSearchDepth = Shape.GetRequiredSearchDepth();
+	Configs.LogVerbosity = EAruLogVerbosity::Errors;
+
+	UE_LOG(LogAruBenchmark, Display, TEXT("Generating %d assets (breadth %d, depth %d, fanout %d, seed %d)..."),
+		Shape.NumAssets, Shape.Breadth, Shape.Depth, Shape.Fanout, Shape.Seed);
+	const TArray<TStrongObjectPtr<UAruBenchmarkDataAsset>> Assets = Aru::Benchmark::GenerateAssets(Shape);
+	const TArray<UObject*> Objects = Aru::Benchmark::ToObjects(Assets);
+
+	TArray<FAruBenchmarkResult> Results;
+	for (const FAruBenchmarkScenario& Scenario : Aru::Benchmark::MakeThroughputScenarios())
+	{
+		if (!ScenarioFilter.IsEmpty() && !ScenarioFilter.Contains(Scenario.Name))
+		{
+			continue;
+		}
+
+		const FAruBenchmarkResult& Result = Results.Add_GetRef(Aru::Benchmark::RunScenario(Scenario, Objects, Configs, Iterations, WarmupIterations));
+		UE_LOG(LogAruBenchmark, Display, TEXT("%-20s best %8.3f ms, mean %8.3f ms, %12.0f properties/s, %lld properties, %lld scratch allocations, %+lld KiB used"),
+			*Result.Scenario,
+			Result.BestSeconds * 1000.0,
+			Result.MeanSeconds * 1000.0,
+			Result.GetPropertiesPerSecond(),
+			Result.PropertiesVisited,
+			Result.ScratchAllocations,
+			Result.UsedPhysicalDelta / 1024);
+	}
+
+	if (Results.IsEmpty())
+	{
+		UE_LOG(LogAruBenchmark, Error, TEXT("No scenario was run."));
+		return 1;
+	}
+
+	if (!FFileHelper::SaveStringToFile(Aru::Benchmark::ToJson(Shape, Results), *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogAruBenchmark, Error, TEXT("Can't write results to '%s'."), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogAruBenchmark, Display, TEXT("Results written to '%s'."), *FPaths::ConvertRelativePathToFull(OutputPath));
+	return 0;
+}
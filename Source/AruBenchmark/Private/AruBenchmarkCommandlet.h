@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AruBenchmarkCommandlet.generated.h"
+
+/**
+ * Generates synthetic assets and measures how fast the processing pipeline runs rules over them.
+ *
+ * UnrealEditor-Cmd <Project> -run=AruBenchmark -unattended -nullrhi [-Assets=100 -Breadth=8 -Depth=2 -Fanout=2
+ *     -ArrayLength=16 -MapSize=8 -SetSize=8 -Seed=1337 -NoInstancedStructs -NoTags -NoReferences]
+ *     [-Iterations=5 -Warmup=1 -Scenarios=ScaleFloats,SetStrings -Output=<File.json>]
+ *
+ * Results are logged and written as JSON, by default to Saved/AruBenchmark/Throughput-<Timestamp>.json.
+ */
+UCLASS()
+class UAruBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAruBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,181 @@
+#include "AruBenchmarkGenerator.h"
+#include "AruBenchmarkTypes.h"
+#include "GameplayTagsManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/Parse.h"
+#include "UObject/Package.h"
+
+namespace Aru::Benchmark::Private
+{
+	struct FGenerator
+	{
+		const FAruBenchmarkShape& Shape;
+		FRandomStream Stream;
+		TArray<FGameplayTag> RegisteredTags;
+		TArray<UObject*> ReferenceTargets;
+
+		explicit FGenerator(const FAruBenchmarkShape& InShape)
+			: Shape(InShape), Stream(InShape.Seed)
+		{
+			if (Shape.bGameplayTags)
+			{
+				FGameplayTagContainer AllTags;
+				UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, false);
+				AllTags.GetGameplayTagArray(RegisteredTags);
+			}
+		}
+
+		FName MakeName(const int32 Max)
+		{
+			return FName{TEXT("Name"), Stream.RandRange(0, FMath::Max(Max, 1) - 1)};
+		}
+
+		FGameplayTag MakeTag()
+		{
+			return RegisteredTags.IsEmpty() ? FGameplayTag{} : RegisteredTags[Stream.RandRange(0, RegisteredTags.Num() - 1)];
+		}
+
+		FAruBenchmarkLeaf MakeLeaf()
+		{
+			FAruBenchmarkLeaf Leaf;
+			Leaf.bFlag = Stream.RandRange(0, 1) == 1;
+			Leaf.IntValue = Stream.RandRange(0, 1000);
+			Leaf.LargeValue = static_cast<int64>(Stream.RandRange(0, MAX_int32)) << 8;
+			Leaf.FloatValue = Stream.FRandRange(-100.f, 100.f);
+			Leaf.DoubleValue = Stream.FRandRange(-1000.f, 1000.f);
+			Leaf.StringValue = FString::Printf(TEXT("Value_%d"), Stream.RandRange(0, 9999));
+			Leaf.NameValue = MakeName(32);
+			Leaf.Location = Stream.GetUnitVector() * Stream.FRandRange(0.f, 1000.f);
+
+			if (Shape.bGameplayTags)
+			{
+				Leaf.Tag = MakeTag();
+				for (int32 Index = 0; Index < 3; ++Index)
+				{
+					if (const FGameplayTag Tag = MakeTag(); Tag.IsValid())
+					{
+						Leaf.Tags.AddTag(Tag);
+					}
+				}
+			}
+
+			if (Shape.bObjectReferences && !ReferenceTargets.IsEmpty())
+			{
+				Leaf.Reference = ReferenceTargets[Stream.RandRange(0, ReferenceTargets.Num() - 1)];
+				Leaf.SoftReference = ReferenceTargets[Stream.RandRange(0, ReferenceTargets.Num() - 1)];
+			}
+			return Leaf;
+		}
+
+		FAruBenchmarkNode MakeNode(const int32 Level)
+		{
+			FAruBenchmarkNode Node;
+			Node.Leaf = MakeLeaf();
+
+			Node.Values.Reserve(Shape.ArrayLength);
+			Node.Weights.Reserve(Shape.ArrayLength);
+			for (int32 Index = 0; Index < Shape.ArrayLength; ++Index)
+			{
+				Node.Values.Add(Stream.RandRange(0, 1000));
+				Node.Weights.Add(Stream.FRand());
+			}
+
+			// Struct arrays multiply the work of every leaf rule, so they stay a fraction of the scalar arrays.
+			for (int32 Index = 0; Index < FMath::Max(Shape.ArrayLength / 4, 1); ++Index)
+			{
+				Node.Leaves.Add(MakeLeaf());
+			}
+
+			for (int32 Index = 0; Index < Shape.MapSize; ++Index)
+			{
+				Node.Counters.Add(FName{TEXT("Counter"), Index}, Stream.RandRange(0, 100));
+			}
+
+			for (int32 Index = 0; Index < Shape.SetSize; ++Index)
+			{
+				Node.Labels.Add(MakeName(Shape.SetSize * 2));
+			}
+
+			if (Shape.bInstancedStructs)
+			{
+				Node.Payload.InitializeAs<FAruBenchmarkLeaf>(MakeLeaf());
+			}
+
+			if (Level < Shape.Depth)
+			{
+				Node.Children.Reserve(Shape.Fanout);
+				for (int32 Index = 0; Index < Shape.Fanout; ++Index)
+				{
+					Node.Children.Emplace(FInstancedStruct::Make(MakeNode(Level + 1)));
+				}
+			}
+			return Node;
+		}
+	};
+}
+
+FAruBenchmarkShape FAruBenchmarkShape::FromCommandLine(const TCHAR* Params)
+{
+	FAruBenchmarkShape Shape;
+	FParse::Value(Params, TEXT("Assets="), Shape.NumAssets);
+	FParse::Value(Params, TEXT("Breadth="), Shape.Breadth);
+	FParse::Value(Params, TEXT("Depth="), Shape.Depth);
+	FParse::Value(Params, TEXT("Fanout="), Shape.Fanout);
+	FParse::Value(Params, TEXT("ArrayLength="), Shape.ArrayLength);
+	FParse::Value(Params, TEXT("MapSize="), Shape.MapSize);
+	FParse::Value(Params, TEXT("SetSize="), Shape.SetSize);
+	FParse::Value(Params, TEXT("Seed="), Shape.Seed);
+	Shape.bInstancedStructs = !FParse::Param(Params, TEXT("NoInstancedStructs"));
+	Shape.bGameplayTags = !FParse::Param(Params, TEXT("NoTags"));
+	Shape.bObjectReferences = !FParse::Param(Params, TEXT("NoReferences"));
+
+	Shape.NumAssets = FMath::Max(Shape.NumAssets, 1);
+	Shape.Breadth = FMath::Max(Shape.Breadth, 1);
+	Shape.Depth = FMath::Max(Shape.Depth, 0);
+	Shape.Fanout = FMath::Max(Shape.Fanout, 0);
+	Shape.ArrayLength = FMath::Max(Shape.ArrayLength, 0);
+	Shape.MapSize = FMath::Max(Shape.MapSize, 0);
+	Shape.SetSize = FMath::Max(Shape.SetSize, 0);
+	return Shape;
+}
+
+int32 FAruBenchmarkShape::GetRequiredSearchDepth() const
+{
+	// Every level of children adds the array, the instanced struct and the node itself; the top adds Nodes, Leaves and the leaf fields.
+	return 3 * Depth + 6;
+}
+
+TArray<TStrongObjectPtr<UAruBenchmarkDataAsset>> Aru::Benchmark::GenerateAssets(const FAruBenchmarkShape& Shape)
+{
+	Private::FGenerator Generator{Shape};
+
+	TArray<TStrongObjectPtr<UAruBenchmarkDataAsset>> Assets;
+	Assets.Reserve(Shape.NumAssets);
+	for (int32 AssetIndex = 0; AssetIndex < Shape.NumAssets; ++AssetIndex)
+	{
+		const FName AssetName = MakeUniqueObjectName(GetTransientPackage(), UAruBenchmarkDataAsset::StaticClass(), TEXT("AruBenchmarkAsset"));
+		UAruBenchmarkDataAsset* Asset = NewObject<UAruBenchmarkDataAsset>(GetTransientPackage(), AssetName, RF_Transient);
+
+		Asset->Nodes.Reserve(Shape.Breadth);
+		for (int32 NodeIndex = 0; NodeIndex < Shape.Breadth; ++NodeIndex)
+		{
+			Asset->Nodes.Add(Generator.MakeNode(0));
+		}
+
+		// Later assets reference earlier ones, so references always point at live objects.
+		Generator.ReferenceTargets.Add(Asset);
+		Assets.Emplace(Asset);
+	}
+	return Assets;
+}
+
+TArray<UObject*> Aru::Benchmark::ToObjects(const TArray<TStrongObjectPtr<UAruBenchmarkDataAsset>>& Assets)
+{
+	TArray<UObject*> Objects;
+	Objects.Reserve(Assets.Num());
+	for (const TStrongObjectPtr<UAruBenchmarkDataAsset>& Asset : Assets)
+	{
+		Objects.Add(Asset.Get());
+	}
+	return Objects;
+}
@@ -0,0 +1,8 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AruBenchmark.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY(LogAruBenchmark);
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, AruBenchmark)
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AruTypes.h"
+#include "AssetFilters/AruFilter_ByName.h"
+#include "AssetFilters/AruFilter_ByPath.h"
+#include "AssetFilters/AruFilter_ByValue.h"
+#include "AssetPredicates/AruPredicate_Arithmetic.h"
+#include "AssetPredicates/AruPredicate_Array.h"
+#include "AssetPredicates/AruPredicate_AssetPathRedirector.h"
+#include "AssetPredicates/AruPredicate_GameplayTag.h"
+#include "AssetPredicates/AruPredicate_Map.h"
+#include "AssetPredicates/AruPredicate_MathStruct.h"
+#include "AssetPredicates/AruPredicate_PropertySetter.h"
+#include "AssetPredicates/AruPredicate_Set.h"
+
+namespace Aru::Benchmark
+{
+	/** Builds a condition of the rule type, e.g. MakeFilter<FAruFilter_InRange>(FVector2D{-1.0, 1001.0}). */
+	template <typename FilterType, typename... ArgTypes>
+	TInstancedStruct<FAruFilter> MakeFilter(ArgTypes&&... Args)
+	{
+		return TInstancedStruct<FAruFilter>::Make<FilterType>(Forward<ArgTypes>(Args)...);
+	}
+
+	template <typename PredicateType, typename... ArgTypes>
+	TInstancedStruct<FAruPredicate> MakePredicate(ArgTypes&&... Args)
+	{
+		return TInstancedStruct<FAruPredicate>::Make<PredicateType>(Forward<ArgTypes>(Args)...);
+	}
+
+	/** Condition met by the property with exactly this name. */
+	FORCEINLINE TInstancedStruct<FAruFilter> MakeByName(const TCHAR* PropertyName)
+	{
+		return MakeFilter<FAruFilter_ByName>(EAruNameCompareOp::MatchAll, FString{PropertyName});
+	}
+}
@@ -0,0 +1,232 @@
+#include "AruBenchmarkSuite.h"
+#include "AruBenchmark.h"
+#include "AruBenchmarkGenerator.h"
+#include "AruBenchmarkRules.h"
+#include "AruProcessingContext.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Serialization/JsonWriter.h"
+
+namespace Aru::Benchmark::Private
+{
+	static void AddActionScenario(TArray<FAruBenchmarkScenario>& Scenarios, const TCHAR* Name, TArray<TInstancedStruct<FAruFilter>> Conditions, TArray<TInstancedStruct<FAruPredicate>> Predicates)
+	{
+		FAruBenchmarkScenario& Scenario = Scenarios.AddDefaulted_GetRef();
+		Scenario.Name = Name;
+		Scenario.Mode = EAruProcessMode::Modify;
+		Scenario.Actions.Emplace(MoveTemp(Conditions), MoveTemp(Predicates));
+	}
+
+	static void AddValidationScenario(TArray<FAruBenchmarkScenario>& Scenarios, const TCHAR* Name, TArray<TInstancedStruct<FAruFilter>> Conditions)
+	{
+		FAruBenchmarkScenario& Scenario = Scenarios.AddDefaulted_GetRef();
+		Scenario.Name = Name;
+		Scenario.Mode = EAruProcessMode::Validate;
+		Scenario.Validations.Emplace(MoveTemp(Conditions));
+	}
+
+	/** Property values of the fixtures as generated, so every iteration of a modifying scenario starts from the same content. */
+	class FFixtureSnapshot : public FNoncopyable
+	{
+	public:
+		explicit FFixtureSnapshot(const TArray<UObject*>& Objects)
+		{
+			for (UObject* Object : Objects)
+			{
+				for (TFieldIterator<FProperty> It{Object->GetClass()}; It; ++It)
+				{
+					FValue& Value = Values.AddDefaulted_GetRef();
+					Value.Object = Object;
+					Value.Property = *It;
+					Value.Data = FMemory::Malloc(It->GetSize(), It->GetMinAlignment());
+					It->InitializeValue(Value.Data);
+					It->CopyCompleteValue(Value.Data, It->ContainerPtrToValuePtr<void>(Object));
+				}
+			}
+		}
+
+		~FFixtureSnapshot()
+		{
+			for (const FValue& Value : Values)
+			{
+				Value.Property->DestroyValue(Value.Data);
+				FMemory::Free(Value.Data);
+			}
+		}
+
+		void Restore() const
+		{
+			for (const FValue& Value : Values)
+			{
+				Value.Property->CopyCompleteValue(Value.Property->ContainerPtrToValuePtr<void>(Value.Object), Value.Data);
+			}
+		}
+
+	private:
+		struct FValue
+		{
+			UObject* Object = nullptr;
+			const FProperty* Property = nullptr;
+			void* Data = nullptr;
+		};
+
+		TArray<FValue> Values;
+	};
+}
+
+TArray<FAruBenchmarkScenario> Aru::Benchmark::MakeThroughputScenarios()
+{
+	using namespace Aru::Benchmark::Private;
+
+	TArray<FAruBenchmarkScenario> Scenarios;
+
+	// A condition no property meets: only traversal and one filter per property.
+	AddActionScenario(Scenarios, TEXT("Traverse"),
+		{MakeByName(TEXT("NoSuchProperty"))},
+		{MakePredicate<FAruPredicate_SetIntegerValue>(0)});
+
+	AddActionScenario(Scenarios, TEXT("ScaleFloats"),
+		{MakeByName(TEXT("FloatValue"))},
+		{MakePredicate<FAruPredicate_ScaleNumeric>(1.0001)});
+
+	AddActionScenario(Scenarios, TEXT("ScaleFloatArrays"),
+		{MakeByName(TEXT("Weights"))},
+		{MakePredicate<FAruPredicate_ScaleNumeric>(1.0001, true)});
+
+	AddActionScenario(Scenarios, TEXT("SetStrings"),
+		{MakeByName(TEXT("StringValue"))},
+		{MakePredicate<FAruPredicate_SetStringValue>(FString{TEXT("Benchmark")})});
+
+	AddActionScenario(Scenarios, TEXT("ReplaceNames"),
+		{MakeByName(TEXT("NameValue")), MakeFilter<FAruFilter_ByNameValue>(FName{TEXT("Name_3")})},
+		{MakePredicate<FAruPredicate_SetNameValue>(FName{TEXT("Name_4")})});
+
+	AddActionScenario(Scenarios, TEXT("ModifyMapValues"),
+		{MakeByName(TEXT("Counters"))},
+		{MakePredicate<FAruPredicate_ModifyMapPair>(
+			TArray<TInstancedStruct<FAruFilter>>{},
+			TArray<TInstancedStruct<FAruFilter>>{MakeFilter<FAruFilter_ByNumericValue>(-1.f, EAruNumericCompareOp::GreaterThan)},
+			TArray<TInstancedStruct<FAruPredicate>>{},
+			TArray<TInstancedStruct<FAruPredicate>>{MakePredicate<FAruPredicate_AddNumeric>(1.0)})});
+
+	// Generated integers lie in [0, 1000], so every value passes and no messages are written.
+	AddValidationScenario(Scenarios, TEXT("ValidateIntRange"),
+		{MakeByName(TEXT("IntValue")), MakeFilter<FAruFilter_InRange>(FVector2D{-1.0, 1001.0})});
+
+	return Scenarios;
+}
+
+FAruBenchmarkResult Aru::Benchmark::RunScenario(
+	const FAruBenchmarkScenario& Scenario,
+	const TArray<UObject*>& Objects,
+	const FAruProcessConfig& Configs,
+	const int32 Iterations,
+	const int32 WarmupIterations)
+{
+	FAruBenchmarkResult Result;
+	Result.Scenario = Scenario.Name;
+	Result.Iterations = FMath::Max(Iterations, 1);
+
+	// Modifying scenarios would otherwise time their own earlier writes, e.g. a name that is already replaced.
+	const bool bRestoreFixtures = Scenario.Mode == EAruProcessMode::Modify;
+	TOptional<Aru::Benchmark::Private::FFixtureSnapshot> Snapshot;
+	if (bRestoreFixtures)
+	{
+		Snapshot.Emplace(Objects);
+	}
+
+	FAruProcessConfig RunConfigs = Configs;
+	RunConfigs.bReportMemory = true;
+
+	auto RunOnce = [&Scenario, &Objects, &RunConfigs, &Snapshot, &Result]()
+	{
+		if (Snapshot.IsSet())
+		{
+			Snapshot->Restore();
+		}
+
+		FAruProcessingContext Context{RunConfigs};
+		FAruProcessingContextScope ContextScope{&Context};
+
+		const double StartTime = FPlatformTime::Seconds();
+		if (Scenario.Mode == EAruProcessMode::Modify)
+		{
+			UAruFunctionLibrary::ModifyAssets(Objects, Scenario.Actions, RunConfigs);
+		}
+		else
+		{
+			UAruFunctionLibrary::ValidateAssets(Objects, Scenario.Validations, RunConfigs);
+		}
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+		const FAruRunStats& Stats = Context.GetRunStats();
+		Result.PropertiesVisited = Stats.PropertiesVisited.load(std::memory_order_relaxed);
+		Result.AssetsProcessed = Stats.AssetsProcessed.load(std::memory_order_relaxed);
+		Result.ScratchAllocations = Stats.ScratchAllocations.load(std::memory_order_relaxed);
+		Result.PeakUsedPhysical = FMath::Max(Result.PeakUsedPhysical, Context.GetRunMemory()->GetPeakUsedPhysical());
+		return Seconds;
+	};
+
+	for (int32 Iteration = 0; Iteration < WarmupIterations; ++Iteration)
+	{
+		RunOnce();
+	}
+	Result.PeakUsedPhysical = 0;
+
+	const uint64 UsedBefore = FPlatformMemory::GetStats().UsedPhysical;
+	double TotalSeconds = 0.0;
+	Result.BestSeconds = TNumericLimits<double>::Max();
+	for (int32 Iteration = 0; Iteration < Result.Iterations; ++Iteration)
+	{
+		const double Seconds = RunOnce();
+		TotalSeconds += Seconds;
+		Result.BestSeconds = FMath::Min(Result.BestSeconds, Seconds);
+	}
+	Result.MeanSeconds = TotalSeconds / Result.Iterations;
+
+	Result.UsedPhysicalDelta = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(UsedBefore);
+	return Result;
+}
+
+FString Aru::Benchmark::ToJson(const FAruBenchmarkShape& Shape, TConstArrayView<FAruBenchmarkResult> Results)
+{
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	Writer->WriteObjectStart();
+
+	Writer->WriteObjectStart(TEXT("shape"));
+	Writer->WriteValue(TEXT("assets"), Shape.NumAssets);
+	Writer->WriteValue(TEXT("breadth"), Shape.Breadth);
+	Writer->WriteValue(TEXT("depth"), Shape.Depth);
+	Writer->WriteValue(TEXT("fanout"), Shape.Fanout);
+	Writer->WriteValue(TEXT("arrayLength"), Shape.ArrayLength);
+	Writer->WriteValue(TEXT("mapSize"), Shape.MapSize);
+	Writer->WriteValue(TEXT("setSize"), Shape.SetSize);
+	Writer->WriteValue(TEXT("instancedStructs"), Shape.bInstancedStructs);
+	Writer->WriteValue(TEXT("gameplayTags"), Shape.bGameplayTags);
+	Writer->WriteValue(TEXT("objectReferences"), Shape.bObjectReferences);
+	Writer->WriteValue(TEXT("seed"), Shape.Seed);
+	Writer->WriteObjectEnd();
+
+	Writer->WriteArrayStart(TEXT("scenarios"));
+	for (const FAruBenchmarkResult& Result : Results)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("name"), Result.Scenario);
+		Writer->WriteValue(TEXT("iterations"), Result.Iterations);
+		Writer->WriteValue(TEXT("bestSeconds"), Result.BestSeconds);
+		Writer->WriteValue(TEXT("meanSeconds"), Result.MeanSeconds);
+		Writer->WriteValue(TEXT("propertiesVisited"), Result.PropertiesVisited);
+		Writer->WriteValue(TEXT("propertiesPerSecond"), Result.GetPropertiesPerSecond());
+		Writer->WriteValue(TEXT("assetsProcessed"), Result.AssetsProcessed);
+		Writer->WriteValue(TEXT("scratchAllocations"), Result.ScratchAllocations);
+		Writer->WriteValue(TEXT("usedPhysicalDelta"), Result.UsedPhysicalDelta);
+		Writer->WriteValue(TEXT("peakUsedPhysical"), static_cast<int64>(Result.PeakUsedPhysical));
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+	return Json;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AruFunctionLibrary.h"
+#include "AruTypes.h"
+
+struct FAruBenchmarkShape;
+
+/** A named set of definitions run over the generated assets as one processing run. */
+struct FAruBenchmarkScenario
+{
+	FString Name;
+	EAruProcessMode Mode = EAruProcessMode::Modify;
+	TArray<FAruActionDefinition> Actions;
+	TArray<FAruValidationDefinition> Validations;
+};
+
+/** Timings of a scenario plus the work counters and memory of its last iteration. */
+struct FAruBenchmarkResult
+{
+	FString Scenario;
+	int32 Iterations = 0;
+	double BestSeconds = 0.0;
+	double MeanSeconds = 0.0;
+	int64 PropertiesVisited = 0;
+	int64 AssetsProcessed = 0;
+	int64 ScratchAllocations = 0;
+
+	/** Change of used physical memory over all iterations. Negative when the run released more than it kept. */
+	int64 UsedPhysicalDelta = 0;
+
+	/** Highest used physical memory sampled during the timed runs, see FAruRunMemory. */
+	uint64 PeakUsedPhysical = 0;
+
+	FORCEINLINE double GetPropertiesPerSecond() const { return BestSeconds > 0.0 ? PropertiesVisited / BestSeconds : 0.0; }
+};
+
+namespace Aru::Benchmark
+{
+	/** Scenarios covering filtering, arithmetic, setters, map values and validation. */
+	TArray<FAruBenchmarkScenario> MakeThroughputScenarios();
+
+	/**
+	 * Runs the scenario once per iteration, each time in a fresh processing context, after the warmup iterations.
+	 * A modifying scenario restores the objects' properties before every iteration, outside the timing.
+	 */
+	FAruBenchmarkResult RunScenario(
+		const FAruBenchmarkScenario& Scenario,
+		const TArray<UObject*>& Objects,
+		const FAruProcessConfig& Configs,
+		const int32 Iterations,
+		const int32 WarmupIterations);
+
+	FString ToJson(const FAruBenchmarkShape& Shape, TConstArrayView<FAruBenchmarkResult> Results);
+}
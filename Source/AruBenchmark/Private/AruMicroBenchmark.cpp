@@ -0,0 +1,337 @@
+#include "AruMicroBenchmark.h"
+#include "AruBenchmark.h"
+#include "AruBenchmarkGenerator.h"
+#include "AruBenchmarkTypes.h"
+#include "AruProcessingContext.h"
+#include "Dom/JsonObject.h"
+#include "GameplayTagsManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace Aru::Benchmark::Private
+{
+	static FAruMicroKernel MakeKernel(const TCHAR* Name, TInstancedStruct<FAruFilter> Filter, const TCHAR* Field, const bool bNodeField = false)
+	{
+		return FAruMicroKernel{Name, MoveTemp(Filter), {}, Field, bNodeField};
+	}
+
+	static FAruMicroKernel MakeKernel(const TCHAR* Name, TInstancedStruct<FAruPredicate> Predicate, const TCHAR* Field, const bool bNodeField = false)
+	{
+		return FAruMicroKernel{Name, {}, MoveTemp(Predicate), Field, bNodeField};
+	}
+
+	/** Generated once per kernel, so predicates that drift values never affect the next kernel. */
+	static TStrongObjectPtr<UAruBenchmarkDataAsset> MakeKernelAsset()
+	{
+		FAruBenchmarkShape Shape;
+		// The second asset references the first, so object filters see a live reference.
+		Shape.NumAssets = 2;
+		Shape.Breadth = 1;
+		Shape.Depth = 0;
+		Shape.ArrayLength = 64;
+		Shape.MapSize = 16;
+		Shape.SetSize = 16;
+		return Aru::Benchmark::GenerateAssets(Shape).Last();
+	}
+
+	/** First registered tag, or none when the project has no tags. Tag rules then take their empty fast paths. */
+	static FGameplayTag GetKernelTag()
+	{
+		FGameplayTagContainer AllTags;
+		UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, false);
+		return AllTags.IsEmpty() ? FGameplayTag{} : AllTags.First();
+	}
+}
+
+TArray<FAruMicroKernel> Aru::Benchmark::MakeMicroKernels()
+{
+	using namespace Aru::Benchmark::Private;
+
+	TArray<FAruMicroKernel> Kernels;
+	const FGameplayTag Tag = GetKernelTag();
+	const TArray<TInstancedStruct<FAruFilter>> NoFilters;
+
+	Kernels.Add(MakeKernel(TEXT("Filter.ByName.MatchAll"),
+		MakeFilter<FAruFilter_ByName>(EAruNameCompareOp::MatchAll, FString{TEXT("IntValue")}),
+		TEXT("IntValue")));
+	Kernels.Add(MakeKernel(TEXT("Filter.ByName.MatchAny"),
+		MakeFilter<FAruFilter_ByName>(EAruNameCompareOp::MatchAny, FString{TEXT("Value")}),
+		TEXT("IntValue")));
+	Kernels.Add(MakeKernel(TEXT("Filter.ByNumericValue"),
+		MakeFilter<FAruFilter_ByNumericValue>(500.f, EAruNumericCompareOp::GreaterThan),
+		TEXT("IntValue")));
+	Kernels.Add(MakeKernel(TEXT("Filter.InRange"),
+		MakeFilter<FAruFilter_InRange>(FVector2D{-50.0, 50.0}),
+		TEXT("FloatValue")));
+	Kernels.Add(MakeKernel(TEXT("Filter.ByBoolean"),
+		MakeFilter<FAruFilter_ByBoolean>(false),
+		TEXT("bFlag")));
+	Kernels.Add(MakeKernel(TEXT("Filter.ByString"),
+		MakeFilter<FAruFilter_ByString>(FString{TEXT("Value_1")}),
+		TEXT("StringValue")));
+	Kernels.Add(MakeKernel(TEXT("Filter.ByNameValue"),
+		MakeFilter<FAruFilter_ByNameValue>(FName{TEXT("Name_3")}),
+		TEXT("NameValue")));
+	Kernels.Add(MakeKernel(TEXT("Filter.ByAssetPath"),
+		MakeFilter<FAruFilter_ByAssetPath>(TArray<FString>{TEXT("/Engine/Transient")}),
+		TEXT("Reference")));
+	Kernels.Add(MakeKernel(TEXT("Filter.ByGameplayTagContainer"),
+		MakeFilter<FAruFilter_ByGameplayTagContainer>(FGameplayTagQuery::MakeQuery_MatchAnyTags(FGameplayTagContainer{Tag})),
+		TEXT("Tags")));
+
+	Kernels.Add(MakeKernel(TEXT("Predicate.SetIntegerValue"),
+		MakePredicate<FAruPredicate_SetIntegerValue>(7),
+		TEXT("IntValue")));
+	Kernels.Add(MakeKernel(TEXT("Predicate.SetFloatValue"),
+		MakePredicate<FAruPredicate_SetFloatValue>(0.5f),
+		TEXT("FloatValue")));
+	Kernels.Add(MakeKernel(TEXT("Predicate.SetStringValue"),
+		MakePredicate<FAruPredicate_SetStringValue>(FString{TEXT("Benchmark")}),
+		TEXT("StringValue")));
+	Kernels.Add(MakeKernel(TEXT("Predicate.SetNameValue"),
+		MakePredicate<FAruPredicate_SetNameValue>(FName{TEXT("Name_4")}),
+		TEXT("NameValue")));
+	Kernels.Add(MakeKernel(TEXT("Predicate.SetStructValue"),
+		MakePredicate<FAruPredicate_SetStructValue>(FInstancedStruct::Make(FVector{1.0, 2.0, 3.0})),
+		TEXT("Location")));
+	Kernels.Add(MakeKernel(TEXT("Predicate.ScaleNumeric"),
+		MakePredicate<FAruPredicate_ScaleNumeric>(1.0),
+		TEXT("FloatValue")));
+	Kernels.Add(MakeKernel(TEXT("Predicate.ScaleNumeric.FloatArray"),
+		MakePredicate<FAruPredicate_ScaleNumeric>(1.0, true),
+		TEXT("Weights"), true));
+	Kernels.Add(MakeKernel(TEXT("Predicate.AddNumeric.IntArray"),
+		MakePredicate<FAruPredicate_AddNumeric>(0.0, true),
+		TEXT("Values"), true));
+	Kernels.Add(MakeKernel(TEXT("Predicate.ModifyArrayValue"),
+		MakePredicate<FAruPredicate_ModifyArrayValue>(
+			TArray<TInstancedStruct<FAruFilter>>{MakeFilter<FAruFilter_ByNumericValue>(500.f, EAruNumericCompareOp::GreaterThan)},
+			TArray<TInstancedStruct<FAruPredicate>>{MakePredicate<FAruPredicate_AddNumeric>(0.0)}),
+		TEXT("Values"), true));
+	Kernels.Add(MakeKernel(TEXT("Predicate.ModifyMapPair"),
+		MakePredicate<FAruPredicate_ModifyMapPair>(
+			TArray<TInstancedStruct<FAruFilter>>{},
+			TArray<TInstancedStruct<FAruFilter>>{MakeFilter<FAruFilter_ByNumericValue>(50.f, EAruNumericCompareOp::GreaterThan)},
+			TArray<TInstancedStruct<FAruPredicate>>{},
+			TArray<TInstancedStruct<FAruPredicate>>{MakePredicate<FAruPredicate_AddNumeric>(0.0)}),
+		TEXT("Counters"), true));
+
+	Kernels.Add(MakeKernel(TEXT("Predicate.ClampNumeric"),
+		MakePredicate<FAruPredicate_ClampNumeric>(-100.0, 100.0),
+		TEXT("FloatValue")));
+	Kernels.Add(MakeKernel(TEXT("Predicate.RoundNumeric"),
+		MakePredicate<FAruPredicate_RoundNumeric>(1.0),
+		TEXT("FloatValue")));
+
+	// Container kernels keep the container's size stable over any number of ops: removals match nothing,
+	// and additions hit an existing element after the first op, so they time the pending element and its lookup.
+	Kernels.Add(MakeKernel(TEXT("Predicate.RemoveArrayValue"),
+		MakePredicate<FAruPredicate_RemoveArrayValue>(
+			TArray<TInstancedStruct<FAruFilter>>{MakeFilter<FAruFilter_ByNumericValue>(1000.f, EAruNumericCompareOp::GreaterThan)}),
+		TEXT("Values"), true));
+	Kernels.Add(MakeKernel(TEXT("Predicate.AddMapPair"),
+		MakePredicate<FAruPredicate_AddMapPair>(
+			TArray<TInstancedStruct<FAruPredicate>>{MakePredicate<FAruPredicate_SetNameValue>(FName{TEXT("Counter_1")})},
+			TArray<TInstancedStruct<FAruPredicate>>{MakePredicate<FAruPredicate_SetIntegerValue>(0)}),
+		TEXT("Counters"), true));
+	Kernels.Add(MakeKernel(TEXT("Predicate.RemoveMapPair"),
+		MakePredicate<FAruPredicate_RemoveMapPair>(
+			NoFilters,
+			TArray<TInstancedStruct<FAruFilter>>{MakeFilter<FAruFilter_ByNumericValue>(1000.f, EAruNumericCompareOp::GreaterThan)}),
+		TEXT("Counters"), true));
+	Kernels.Add(MakeKernel(TEXT("Predicate.AddSetElement"),
+		MakePredicate<FAruPredicate_AddSetElement>(
+			TArray<TInstancedStruct<FAruPredicate>>{MakePredicate<FAruPredicate_SetNameValue>(FName{TEXT("Label_Benchmark")})}),
+		TEXT("Labels"), true));
+	Kernels.Add(MakeKernel(TEXT("Predicate.RemoveSetValue"),
+		MakePredicate<FAruPredicate_RemoveSetValue>(
+			TArray<TInstancedStruct<FAruFilter>>{MakeFilter<FAruFilter_ByNameValue>(FName{TEXT("NoSuchLabel")})}),
+		TEXT("Labels"), true));
+	Kernels.Add(MakeKernel(TEXT("Predicate.ModifySetValue"),
+		MakePredicate<FAruPredicate_ModifySetValue>(
+			TArray<TInstancedStruct<FAruFilter>>{MakeFilter<FAruFilter_ByNameValue>(FName{TEXT("Name_3")})},
+			TArray<TInstancedStruct<FAruPredicate>>{MakePredicate<FAruPredicate_SetNameValue>(FName{TEXT("Name_3")})}),
+		TEXT("Labels"), true));
+
+	// No replacement matches, so both time the compiled redirect table and, for hard references, the asset lookup.
+	const TMap<FString, FString> Redirects{{TEXT("/Game/NoSuchFolder/"), TEXT("/Game/OtherFolder/")}};
+	Kernels.Add(MakeKernel(TEXT("Predicate.AssetPathRedirector.Hard"),
+		MakePredicate<FAruPredicate_AssetPathRedirector>(Redirects),
+		TEXT("Reference")));
+	Kernels.Add(MakeKernel(TEXT("Predicate.AssetPathRedirector.Soft"),
+		MakePredicate<FAruPredicate_AssetPathRedirector>(Redirects),
+		TEXT("SoftReference")));
+
+	Kernels.Add(MakeKernel(TEXT("Predicate.ScaleMathStruct"),
+		MakePredicate<FAruPredicate_ScaleMathStruct>(EAruTransformComponent::Translation, FVector4{1.0, 1.0, 1.0, 1.0}),
+		TEXT("Location")));
+	Kernels.Add(MakeKernel(TEXT("Predicate.OffsetMathStruct"),
+		MakePredicate<FAruPredicate_OffsetMathStruct>(EAruTransformComponent::Translation, FVector4{0.0, 0.0, 0.0, 0.0}),
+		TEXT("Location")));
+	Kernels.Add(MakeKernel(TEXT("Predicate.ClampMathStruct"),
+		MakePredicate<FAruPredicate_ClampMathStruct>(EAruTransformComponent::Translation, FVector4{-1000.0, -1000.0, -1000.0, -1000.0}, FVector4{1000.0, 1000.0, 1000.0, 1000.0}),
+		TEXT("Location")));
+
+	Kernels.Add(MakeKernel(TEXT("Predicate.SetGameplayTag"),
+		MakePredicate<FAruPredicate_SetGameplayTag>(Tag),
+		TEXT("Tag")));
+	Kernels.Add(MakeKernel(TEXT("Predicate.SetGameplayTagContainer"),
+		MakePredicate<FAruPredicate_SetGameplayTagContainer>(FGameplayTagContainer{Tag}),
+		TEXT("Tags")));
+
+	return Kernels;
+}
+
+bool Aru::Benchmark::RunMicroKernel(const FAruMicroKernel& Kernel, const int64 OpsPerSample, const int32 Samples, FAruMicroResult& OutResult)
+{
+	const FAruFilter* Filter = Kernel.Filter.GetPtr<const FAruFilter>();
+	const FAruPredicate* Predicate = Kernel.Predicate.GetPtr<const FAruPredicate>();
+	if (Filter == nullptr && Predicate == nullptr)
+	{
+		UE_LOG(LogAruBenchmark, Error, TEXT("Kernel '%s' has no rule."), *Kernel.Name);
+		return false;
+	}
+
+	const TStrongObjectPtr<UAruBenchmarkDataAsset> Asset = Private::MakeKernelAsset();
+	FAruBenchmarkNode& Node = Asset->Nodes[0];
+	const UStruct* Owner = Kernel.bNodeField ? FAruBenchmarkNode::StaticStruct() : FAruBenchmarkLeaf::StaticStruct();
+	void* Container = Kernel.bNodeField ? static_cast<void*>(&Node) : static_cast<void*>(&Node.Leaf);
+	const FProperty* Property = Owner->FindPropertyByName(Kernel.Field);
+	if (Property == nullptr)
+	{
+		UE_LOG(LogAruBenchmark, Error, TEXT("Kernel '%s' targets unknown field '%s'."), *Kernel.Name, *Kernel.Field.ToString());
+		return false;
+	}
+	void* Value = Property->ContainerPtrToValuePtr<void>(Container);
+
+	const FInstancedPropertyBag Parameters;
+
+	FAruProcessConfig Configs;
+	Configs.LogVerbosity = EAruLogVerbosity::Errors;
+	FAruProcessingContext Context{Configs};
+	FAruProcessingContextScope ContextScope{&Context};
+
+	auto RunSample = [&]()
+	{
+		int64 Hits = 0;
+		const double StartTime = FPlatformTime::Seconds();
+		if (Filter != nullptr)
+		{
+			for (int64 Op = 0; Op < OpsPerSample; ++Op)
+			{
+				Hits += Filter->IsConditionMet(Property, Value, Parameters);
+			}
+		}
+		else
+		{
+			for (int64 Op = 0; Op < OpsPerSample; ++Op)
+			{
+				Hits += Predicate->Execute(Property, Value, Parameters);
+			}
+		}
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+		// Keeps the results observable, so the loop can't be optimized away.
+		UE_LOG(LogAruBenchmark, VeryVerbose, TEXT("%s: %lld hits"), *Kernel.Name, Hits);
+		return Seconds * 1e9 / FMath::Max<int64>(OpsPerSample, 1);
+	};
+
+	// Warms caches and lets rules compile their configuration before anything is timed.
+	RunSample();
+
+	OutResult = FAruMicroResult{};
+	OutResult.Kernel = Kernel.Name;
+	OutResult.OpsPerSample = OpsPerSample;
+	OutResult.Samples = FMath::Max(Samples, 1);
+	OutResult.BestNsPerOp = TNumericLimits<double>::Max();
+
+	double TotalNsPerOp = 0.0;
+	for (int32 Sample = 0; Sample < OutResult.Samples; ++Sample)
+	{
+		const double NsPerOp = RunSample();
+		TotalNsPerOp += NsPerOp;
+		OutResult.BestNsPerOp = FMath::Min(OutResult.BestNsPerOp, NsPerOp);
+	}
+	OutResult.MeanNsPerOp = TotalNsPerOp / OutResult.Samples;
+	return true;
+}
+
+FString Aru::Benchmark::MicroResultsToJson(TConstArrayView<FAruMicroResult> Results)
+{
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("platform"), FString{FPlatformProperties::PlatformName()});
+	Writer->WriteValue(TEXT("cpu"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+
+	Writer->WriteArrayStart(TEXT("kernels"));
+	for (const FAruMicroResult& Result : Results)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("name"), Result.Kernel);
+		Writer->WriteValue(TEXT("opsPerSample"), Result.OpsPerSample);
+		Writer->WriteValue(TEXT("samples"), Result.Samples);
+		Writer->WriteValue(TEXT("bestNsPerOp"), Result.BestNsPerOp);
+		Writer->WriteValue(TEXT("meanNsPerOp"), Result.MeanNsPerOp);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+	return Json;
+}
+
+bool Aru::Benchmark::LoadMicroBaseline(const FString& InPath, TMap<FString, double>& OutNsPerOp)
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *InPath))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+	{
+		UE_LOG(LogAruBenchmark, Error, TEXT("Baseline '%s' is not valid JSON."), *InPath);
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Kernels = nullptr;
+	if (!Root->TryGetArrayField(TEXT("kernels"), Kernels))
+	{
+		UE_LOG(LogAruBenchmark, Error, TEXT("Baseline '%s' has no kernels."), *InPath);
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& KernelValue : *Kernels)
+	{
+		const TSharedPtr<FJsonObject>* Kernel = nullptr;
+		FString Name;
+		double NsPerOp = 0.0;
+		if (KernelValue->TryGetObject(Kernel)
+			&& (*Kernel)->TryGetStringField(TEXT("name"), Name)
+			&& (*Kernel)->TryGetNumberField(TEXT("bestNsPerOp"), NsPerOp))
+		{
+			OutNsPerOp.Add(Name, NsPerOp);
+		}
+	}
+	return true;
+}
+
+TArray<FAruMicroRegression> Aru::Benchmark::FindRegressions(TConstArrayView<FAruMicroResult> Results, const TMap<FString, double>& BaselineNsPerOp, const double Threshold)
+{
+	TArray<FAruMicroRegression> Regressions;
+	for (const FAruMicroResult& Result : Results)
+	{
+		const double* Baseline = BaselineNsPerOp.Find(Result.Kernel);
+		if (Baseline != nullptr && *Baseline > 0.0 && Result.BestNsPerOp > *Baseline * (1.0 + Threshold))
+		{
+			Regressions.Add(FAruMicroRegression{Result.Kernel, *Baseline, Result.BestNsPerOp});
+		}
+	}
+	return Regressions;
+}
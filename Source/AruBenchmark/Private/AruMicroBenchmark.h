@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AruBenchmarkRules.h"
+
+/** One rule applied over and over to one property of a generated node. */
+struct FAruMicroKernel
+{
+	FString Name;
+
+	/** The rule, timed through IsConditionMet when Filter is set and through Execute otherwise. */
+	TInstancedStruct<FAruFilter> Filter;
+	TInstancedStruct<FAruPredicate> Predicate;
+
+	/** Field of FAruBenchmarkLeaf, or of FAruBenchmarkNode when bNodeField is set. */
+	FName Field;
+	bool bNodeField = false;
+};
+
+struct FAruMicroResult
+{
+	FString Kernel;
+	int64 OpsPerSample = 0;
+	int32 Samples = 0;
+	double BestNsPerOp = 0.0;
+	double MeanNsPerOp = 0.0;
+};
+
+/** A kernel that got slower than its baseline allows. */
+struct FAruMicroRegression
+{
+	FString Kernel;
+	double BaselineNsPerOp = 0.0;
+	double CurrentNsPerOp = 0.0;
+
+	FORCEINLINE double GetRatio() const { return BaselineNsPerOp > 0.0 ? CurrentNsPerOp / BaselineNsPerOp : 0.0; }
+};
+
+namespace Aru::Benchmark
+{
+	/** One kernel per covered filter and predicate type. */
+	TArray<FAruMicroKernel> MakeMicroKernels();
+
+	/**
+	 * Times the kernel on its property of a generated node. Every sample runs the rule OpsPerSample times;
+	 * the best sample is the figure baselines compare, since it is the least disturbed by the rest of the machine.
+	 * Returns false if the kernel has no rule or its property doesn't exist.
+	 */
+	bool RunMicroKernel(const FAruMicroKernel& Kernel, const int64 OpsPerSample, const int32 Samples, FAruMicroResult& OutResult);
+
+	FString MicroResultsToJson(TConstArrayView<FAruMicroResult> Results);
+
+	/** Reads the best ns/op per kernel from a file written by MicroResultsToJson. */
+	bool LoadMicroBaseline(const FString& InPath, TMap<FString, double>& OutNsPerOp);
+
+	/** Kernels whose best ns/op exceeds their baseline by more than the threshold, e.g. 0.2 for 20%. Kernels without a baseline pass. */
+	TArray<FAruMicroRegression> FindRegressions(TConstArrayView<FAruMicroResult> Results, const TMap<FString, double>& BaselineNsPerOp, const double Threshold);
+}
@@ -0,0 +1,113 @@
+#include "AruMicroBenchmarkCommandlet.h"
+#include "AruBenchmark.h"
+#include "AruMicroBenchmark.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AruMicroBenchmarkCommandlet)
+
+UAruMicroBenchmarkCommandlet::UAruMicroBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAruMicroBenchmarkCommandlet::Main(const FString& Params)
+{
+	int64 OpsPerSample = 20000;
+	int32 Samples = 7;
+	double Threshold = 0.2;
+	FParse::Value(*Params, TEXT("Ops="), OpsPerSample);
+	FParse::Value(*Params, TEXT("Samples="), Samples);
+	FParse::Value(*Params, TEXT("Threshold="), Threshold);
+
+	TArray<FString> KernelFilter;
+	if (FString KernelList; FParse::Value(*Params, TEXT("Kernels="), KernelList, false))
+	{
+		KernelList.ParseIntoArray(KernelFilter, TEXT(","));
+	}
+
+	FString BaselinePath;
+	if (!FParse::Value(*Params, TEXT("Baseline="), BaselinePath))
+	{
+		BaselinePath = FPaths::ProjectSavedDir() / TEXT("AruBenchmark") / TEXT("MicroBaseline.json");
+	}
+
+	FString OutputPath;
+	if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("AruBenchmark") / FString::Printf(TEXT("Micro-%s.json"), *FDateTime::Now().ToString());
+	}
+
+	TArray<FAruMicroResult> Results;
+	bool bAllKernelsRan = true;
+	for (const FAruMicroKernel& Kernel : Aru::Benchmark::MakeMicroKernels())
+	{
+		if (!KernelFilter.IsEmpty() && !KernelFilter.Contains(Kernel.Name))
+		{
+			continue;
+		}
+
+		FAruMicroResult Result;
+		if (!Aru::Benchmark::RunMicroKernel(Kernel, OpsPerSample, Samples, Result))
+		{
+			UE_LOG(LogAruBenchmark, Error, TEXT("Kernel '%s' couldn't be set up."), *Kernel.Name);
+			bAllKernelsRan = false;
+			continue;
+		}
+
+		UE_LOG(LogAruBenchmark, Display, TEXT("%-36s best %9.2f ns/op, mean %9.2f ns/op"), *Result.Kernel, Result.BestNsPerOp, Result.MeanNsPerOp);
+		Results.Add(MoveTemp(Result));
+	}
+
+	const FString Json = Aru::Benchmark::MicroResultsToJson(Results);
+	if (!FFileHelper::SaveStringToFile(Json, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogAruBenchmark, Error, TEXT("Can't write results to '%s'."), *OutputPath);
+		return 1;
+	}
+	UE_LOG(LogAruBenchmark, Display, TEXT("Results written to '%s'."), *FPaths::ConvertRelativePathToFull(OutputPath));
+
+	if (!bAllKernelsRan)
+	{
+		return 1;
+	}
+
+	if (FParse::Param(*Params, TEXT("SaveBaseline")))
+	{
+		if (!FFileHelper::SaveStringToFile(Json, *BaselinePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogAruBenchmark, Error, TEXT("Can't write baseline to '%s'."), *BaselinePath);
+			return 1;
+		}
+		UE_LOG(LogAruBenchmark, Display, TEXT("Baseline saved to '%s'."), *FPaths::ConvertRelativePathToFull(BaselinePath));
+		return 0;
+	}
+
+	TMap<FString, double> BaselineNsPerOp;
+	if (!Aru::Benchmark::LoadMicroBaseline(BaselinePath, BaselineNsPerOp))
+	{
+		// A gate without a baseline would pass every run, so a missing or unreadable one fails it.
+		UE_LOG(LogAruBenchmark, Error, TEXT("No baseline at '%s', nothing to compare. Run with -SaveBaseline to record one."), *BaselinePath);
+		return 1;
+	}
+
+	const TArray<FAruMicroRegression> Regressions = Aru::Benchmark::FindRegressions(Results, BaselineNsPerOp, Threshold);
+	for (const FAruMicroRegression& Regression : Regressions)
+	{
+		UE_LOG(LogAruBenchmark, Error, TEXT("Regression in '%s': %.2f ns/op, baseline %.2f ns/op (%+.0f%%)."),
+			*Regression.Kernel, Regression.CurrentNsPerOp, Regression.BaselineNsPerOp, (Regression.GetRatio() - 1.0) * 100.0);
+	}
+
+	if (!Regressions.IsEmpty())
+	{
+		UE_LOG(LogAruBenchmark, Error, TEXT("%d of %d kernels regressed by more than %.0f%%."), Regressions.Num(), Results.Num(), Threshold * 100.0);
+		return 2;
+	}
+
+	UE_LOG(LogAruBenchmark, Display, TEXT("All %d kernels are within %.0f%% of the baseline."), Results.Num(), Threshold * 100.0);
+	return 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AruMicroBenchmarkCommandlet.generated.h"
+
+/**
+ * Times every covered filter and predicate in isolation and gates the results against a stored baseline.
+ *
+ * UnrealEditor-Cmd <Project> -run=AruMicroBenchmark -unattended -nullrhi
+ *     [-Ops=20000 -Samples=7 -Kernels=Filter.ByName.MatchAll,Predicate.ModifyMapPair -Output=<File.json>]
+ *     [-Baseline=<File.json> -Threshold=0.2] [-SaveBaseline]
+ *
+ * With -SaveBaseline the results replace the baseline. Otherwise the commandlet fails with exit code 2
+ * when any kernel's best ns/op is more than Threshold slower than in the baseline, and with exit code 1
+ * when there is no baseline to compare against.
+ * Baselines only compare meaningfully on the machine that recorded them.
+ */
+UCLASS()
+class UAruMicroBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAruMicroBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
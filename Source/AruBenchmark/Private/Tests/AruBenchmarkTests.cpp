@@ -0,0 +1,101 @@
+#include "AruBenchmarkGenerator.h"
+#include "AruBenchmarkSuite.h"
+#include "AruBenchmarkTypes.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace Aru::Benchmark::Tests
+{
+	static bool HaveNodesChanged(const TArray<FAruBenchmarkNode>& Before, const TArray<FAruBenchmarkNode>& After)
+	{
+		if (Before.Num() != After.Num())
+		{
+			return true;
+		}
+
+		for (int32 Index = 0; Index < Before.Num(); ++Index)
+		{
+			if (!FAruBenchmarkNode::StaticStruct()->CompareScriptStruct(&Before[Index], &After[Index], PPF_None))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAruBenchmarkScenariosModifyFixtureTest, "AruEditorUtilities.Benchmark.ScenariosModifyFixture",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAruBenchmarkScenariosModifyFixtureTest::RunTest(const FString& Parameters)
+{
+	// The default tree per asset holds enough leaves that every scenario's conditions find a match.
+	FAruBenchmarkShape Shape;
+	Shape.NumAssets = 2;
+
+	FAruProcessConfig Configs;
+	Configs.MaxSearchDepth = Shape.GetRequiredSearchDepth();
+	Configs.LogVerbosity = EAruLogVerbosity::Errors;
+
+	const TArray<FAruBenchmarkScenario> Scenarios = Aru::Benchmark::MakeThroughputScenarios();
+	TestTrue(TEXT("Scenarios are built"), Scenarios.Num() > 0);
+
+	for (const FAruBenchmarkScenario& Scenario : Scenarios)
+	{
+		// Fresh assets per scenario, so every scenario starts from the same fixture.
+		const TArray<TStrongObjectPtr<UAruBenchmarkDataAsset>> Assets = Aru::Benchmark::GenerateAssets(Shape);
+		TArray<TArray<FAruBenchmarkNode>> Before;
+		for (const TStrongObjectPtr<UAruBenchmarkDataAsset>& Asset : Assets)
+		{
+			Before.Add(Asset->Nodes);
+		}
+
+		Aru::Benchmark::RunScenario(Scenario, Aru::Benchmark::ToObjects(Assets), Configs, 1, 0);
+
+		bool bChanged = false;
+		for (int32 Index = 0; Index < Assets.Num(); ++Index)
+		{
+			bChanged |= Aru::Benchmark::Tests::HaveNodesChanged(Before[Index], Assets[Index]->Nodes);
+		}
+
+		// Traverse matches nothing and validations never write.
+		const bool bExpectChange = Scenario.Mode == EAruProcessMode::Modify && Scenario.Name != TEXT("Traverse");
+		TestEqual(FString::Printf(TEXT("Scenario '%s' changed the fixture"), *Scenario.Name), bChanged, bExpectChange);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAruBenchmarkIterationsRestoreFixtureTest, "AruEditorUtilities.Benchmark.IterationsRestoreFixture",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAruBenchmarkIterationsRestoreFixtureTest::RunTest(const FString& Parameters)
+{
+	// Without references two generations of the same seed hold equal values, so their nodes compare directly.
+	FAruBenchmarkShape Shape;
+	Shape.NumAssets = 2;
+	Shape.bObjectReferences = false;
+
+	FAruProcessConfig Configs;
+	Configs.MaxSearchDepth = Shape.GetRequiredSearchDepth();
+	Configs.LogVerbosity = EAruLogVerbosity::Errors;
+
+	for (const FAruBenchmarkScenario& Scenario : Aru::Benchmark::MakeThroughputScenarios())
+	{
+		const TArray<TStrongObjectPtr<UAruBenchmarkDataAsset>> Once = Aru::Benchmark::GenerateAssets(Shape);
+		const TArray<TStrongObjectPtr<UAruBenchmarkDataAsset>> Repeated = Aru::Benchmark::GenerateAssets(Shape);
+		Aru::Benchmark::RunScenario(Scenario, Aru::Benchmark::ToObjects(Once), Configs, 1, 0);
+		const FAruBenchmarkResult Result = Aru::Benchmark::RunScenario(Scenario, Aru::Benchmark::ToObjects(Repeated), Configs, 3, 1);
+
+		bool bChanged = false;
+		for (int32 Index = 0; Index < Once.Num(); ++Index)
+		{
+			bChanged |= Aru::Benchmark::Tests::HaveNodesChanged(Once[Index]->Nodes, Repeated[Index]->Nodes);
+		}
+		TestFalse(FString::Printf(TEXT("Iterations of '%s' don't compound"), *Scenario.Name), bChanged);
+		TestTrue(FString::Printf(TEXT("'%s' reports the peak of its runs"), *Scenario.Name), Result.PeakUsedPhysical > 0);
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,7 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+ARUBENCHMARK_API DECLARE_LOG_CATEGORY_EXTERN(LogAruBenchmark, Log, All);
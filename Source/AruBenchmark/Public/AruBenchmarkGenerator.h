@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/StrongObjectPtr.h"
+
+class UAruBenchmarkDataAsset;
+
+/** Size and composition of the generated content. The same shape and seed always produce the same values. */
+struct ARUBENCHMARK_API FAruBenchmarkShape
+{
+	int32 NumAssets = 100;
+
+	/** Top-level nodes per asset. */
+	int32 Breadth = 8;
+
+	/** Levels of child nodes below each top-level node. */
+	int32 Depth = 2;
+
+	/** Child nodes per node on every level. */
+	int32 Fanout = 2;
+
+	int32 ArrayLength = 16;
+	int32 MapSize = 8;
+	int32 SetSize = 8;
+
+	bool bInstancedStructs = true;
+	bool bGameplayTags = true;
+	bool bObjectReferences = true;
+
+	int32 Seed = 1337;
+
+	/** Reads -Assets=, -Breadth=, -Depth=, -Fanout=, -ArrayLength=, -MapSize=, -SetSize=, -Seed= and -NoInstancedStructs, -NoTags, -NoReferences. */
+	static FAruBenchmarkShape FromCommandLine(const TCHAR* Params);
+
+	/** Traversal depth a run needs to reach the deepest leaf of this shape. */
+	int32 GetRequiredSearchDepth() const;
+};
+
+namespace Aru::Benchmark
+{
+	/** Creates transient assets of the shape. They stay alive as long as the returned pointers. */
+	ARUBENCHMARK_API TArray<TStrongObjectPtr<UAruBenchmarkDataAsset>> GenerateAssets(const FAruBenchmarkShape& Shape);
+
+	ARUBENCHMARK_API TArray<UObject*> ToObjects(const TArray<TStrongObjectPtr<UAruBenchmarkDataAsset>>& Assets);
+}
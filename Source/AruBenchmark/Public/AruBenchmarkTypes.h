@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "StructUtils/InstancedStruct.h"
+#include "AruBenchmarkTypes.generated.h"
+
+/** One of every value kind the rules handle. */
+USTRUCT()
+struct FAruBenchmarkLeaf
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	bool bFlag = false;
+
+	UPROPERTY()
+	int32 IntValue = 0;
+
+	UPROPERTY()
+	int64 LargeValue = 0;
+
+	UPROPERTY()
+	float FloatValue = 0.f;
+
+	UPROPERTY()
+	double DoubleValue = 0.0;
+
+	UPROPERTY()
+	FString StringValue;
+
+	UPROPERTY()
+	FName NameValue;
+
+	UPROPERTY()
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY()
+	FGameplayTag Tag;
+
+	UPROPERTY()
+	FGameplayTagContainer Tags;
+
+	UPROPERTY()
+	TObjectPtr<UObject> Reference = nullptr;
+
+	UPROPERTY()
+	TSoftObjectPtr<UObject> SoftReference;
+};
+
+/** Node of the generated tree. Depth comes from Children, which hold further nodes as instanced structs. */
+USTRUCT()
+struct FAruBenchmarkNode
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FAruBenchmarkLeaf Leaf;
+
+	UPROPERTY()
+	TArray<int32> Values;
+
+	UPROPERTY()
+	TArray<float> Weights;
+
+	UPROPERTY()
+	TArray<FAruBenchmarkLeaf> Leaves;
+
+	UPROPERTY()
+	TMap<FName, int32> Counters;
+
+	UPROPERTY()
+	TSet<FName> Labels;
+
+	UPROPERTY()
+	FInstancedStruct Payload;
+
+	UPROPERTY()
+	TArray<FInstancedStruct> Children;
+};
+
+/** Procedurally generated asset the benchmarks run their rules over. */
+UCLASS(Transient)
+class ARUBENCHMARK_API UAruBenchmarkDataAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<FAruBenchmarkNode> Nodes;
+};
@@ -41,6 +41,10 @@ public class AruEditorUtilities : ModuleRules
 				"SlateCore",
 				"GameplayTags", 
 				"MessageLog",
+				"AssetRegistry",
+				"Json",
+				"TraceLog",
+				"UnrealEd",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -0,0 +1,223 @@
+#include "AruAsyncRun.h"
+#include "AruRunMemory.h"
+#include "AruTrace.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AruAsyncRun)
+
+#define LOCTEXT_NAMESPACE "UAruAsyncRun"
+
+void UAruAsyncRun::Start(
+	const TArray<UObject*>& InObjects,
+	const FAruProcessConfig& InConfigs,
+	const EAruProcessMode InMode,
+	TFunctionRef<TFunction<bool(const FProperty*, void*)>(const FAruProcessConfig&)> InMakeProcessor)
+{
+	check(IsInGameThread());
+	Objects = InObjects;
+	Configs = InConfigs;
+	Context = MakeUnique<FAruProcessingContext>(Configs);
+	{
+		FAruProcessingContextScope ContextScope{Context.Get()};
+		Processor = InMakeProcessor(Configs);
+	}
+
+	// A dry run is a modify run that never writes.
+	Mode = InMode == EAruProcessMode::Modify && Context->GetChangeSet() != nullptr ? EAruProcessMode::Preview : InMode;
+	State = EAruAsyncRunState::Running;
+	AddToRoot();
+
+	if (FSlateApplication::IsInitialized())
+	{
+		FNotificationInfo Info{LOCTEXT("Starting", "Processing assets...")};
+		Info.bFireAndForget = false;
+		Info.ButtonDetails.Add(FNotificationButtonInfo{
+			LOCTEXT("PauseResume", "Pause / Resume"),
+			LOCTEXT("PauseResumeTooltip", "Pauses the run after the current slice, or resumes it."),
+			FSimpleDelegate::CreateWeakLambda(this, [this]
+			{
+				State == EAruAsyncRunState::Paused ? Resume() : Pause();
+			}),
+			SNotificationItem::CS_Pending});
+		Info.ButtonDetails.Add(FNotificationButtonInfo{
+			LOCTEXT("Cancel", "Cancel"),
+			LOCTEXT("CancelTooltip", "Stops the run after the current asset. What was already written stays."),
+			FSimpleDelegate::CreateUObject(this, &UAruAsyncRun::Cancel),
+			SNotificationItem::CS_Pending});
+
+		if (const TSharedPtr<SNotificationItem> Item = FSlateNotificationManager::Get().AddNotification(Info))
+		{
+			Item->SetCompletionState(SNotificationItem::CS_Pending);
+			Notification = Item;
+		}
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UAruAsyncRun::Tick));
+}
+
+void UAruAsyncRun::Pause()
+{
+	if (State == EAruAsyncRunState::Running)
+	{
+		State = EAruAsyncRunState::Paused;
+		UpdateNotification();
+	}
+}
+
+void UAruAsyncRun::Resume()
+{
+	if (State == EAruAsyncRunState::Paused)
+	{
+		State = EAruAsyncRunState::Running;
+		UpdateNotification();
+	}
+}
+
+void UAruAsyncRun::Cancel()
+{
+	if (State == EAruAsyncRunState::Running || State == EAruAsyncRunState::Paused)
+	{
+		Finish(EAruAsyncRunState::Cancelled);
+	}
+}
+
+float UAruAsyncRun::GetProgress() const
+{
+	return Objects.IsEmpty() ? 1.f : static_cast<float>(NextObjectIndex) / Objects.Num();
+}
+
+float UAruAsyncRun::GetThroughput() const
+{
+	return ProcessingSeconds > 0.0 ? static_cast<float>(NextObjectIndex / ProcessingSeconds) : 0.f;
+}
+
+float UAruAsyncRun::GetEstimatedSecondsRemaining() const
+{
+	if (NextObjectIndex == 0 || WallSeconds <= 0.0)
+	{
+		return -1.f;
+	}
+	return static_cast<float>((Objects.Num() - NextObjectIndex) * WallSeconds / NextObjectIndex);
+}
+
+void UAruAsyncRun::BeginDestroy()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+	Super::BeginDestroy();
+}
+
+bool UAruAsyncRun::Tick(float DeltaTime)
+{
+	if (State == EAruAsyncRunState::Paused)
+	{
+		return true;
+	}
+	if (State != EAruAsyncRunState::Running)
+	{
+		return false;
+	}
+
+	WallSeconds += DeltaTime;
+	if (NextObjectIndex < Objects.Num())
+	{
+		ProcessSlice();
+	}
+
+	if (NextObjectIndex >= Objects.Num())
+	{
+		Finish(EAruAsyncRunState::Finished);
+		return false;
+	}
+
+	UpdateNotification();
+	return State == EAruAsyncRunState::Running || State == EAruAsyncRunState::Paused;
+}
+
+void UAruAsyncRun::ProcessSlice()
+{
+	ARU_TRACE_SCOPE("Aru::AsyncRunSlice");
+	FAruProcessingContextScope ContextScope{Context.Get()};
+	LLM_SCOPE_BYTAG(Aru);
+	const FAruRunPhaseScope PhaseScope{EAruRunPhase::Process};
+	FAruRunMemory* RunMemory = Context->GetRunMemory();
+
+	// A transaction can't stay open across editor ticks, so every slice is its own undo step.
+	TOptional<FAruRunTransactionScope> TransactionScope;
+	if (Mode == EAruProcessMode::Modify)
+	{
+		TransactionScope.Emplace(*Context, LOCTEXT("Slice_Transaction", "Modify Assets (Background)"));
+	}
+
+	const double SliceStart = FPlatformTime::Seconds();
+	const double Budget = FMath::Max(FrameBudgetMilliseconds, 1.f) / 1000.0;
+	do
+	{
+		bResult |= UAruFunctionLibrary::ProcessAsset(Objects[NextObjectIndex++], Configs, Processor, Mode);
+		if (RunMemory != nullptr)
+		{
+			RunMemory->Sample();
+		}
+	}
+	while (NextObjectIndex < Objects.Num() && FPlatformTime::Seconds() - SliceStart < Budget);
+
+	ProcessingSeconds += FPlatformTime::Seconds() - SliceStart;
+}
+
+void UAruAsyncRun::Finish(const EAruAsyncRunState InState)
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	State = InState;
+
+	// Ending the run writes its log, reports, change set and journal.
+	Processor.Reset();
+	Context.Reset();
+
+	if (const TSharedPtr<SNotificationItem> Item = Notification.Pin())
+	{
+		Item->SetText(State == EAruAsyncRunState::Cancelled
+			? FText::Format(LOCTEXT("Cancelled", "Cancelled after {0} of {1} assets."), NextObjectIndex, Objects.Num())
+			: FText::Format(LOCTEXT("Finished", "Processed {0} assets in {1}."), Objects.Num(), FText::AsTimespan(FTimespan::FromSeconds(WallSeconds))));
+		Item->SetCompletionState(State == EAruAsyncRunState::Cancelled ? SNotificationItem::CS_Fail : SNotificationItem::CS_Success);
+		Item->ExpireAndFadeout();
+	}
+	Notification.Reset();
+
+	RemoveFromRoot();
+	OnFinished.Broadcast(bResult);
+}
+
+void UAruAsyncRun::UpdateNotification()
+{
+	const TSharedPtr<SNotificationItem> Item = Notification.Pin();
+	if (!Item.IsValid())
+	{
+		return;
+	}
+
+	const float SecondsRemaining = GetEstimatedSecondsRemaining();
+	const FText Remaining = SecondsRemaining >= 0.f ? FText::AsTimespan(FTimespan::FromSeconds(SecondsRemaining)) : LOCTEXT("Unknown", "unknown");
+	FNumberFormattingOptions ThroughputFormat;
+	ThroughputFormat.MaximumFractionalDigits = 1;
+	const FText Progress = FText::Format(
+		LOCTEXT("Progress", "{0} of {1} assets, {2} assets/s, {3} left"),
+		NextObjectIndex,
+		Objects.Num(),
+		FText::AsNumber(GetThroughput(), &ThroughputFormat),
+		Remaining);
+
+	Item->SetText(State == EAruAsyncRunState::Paused
+		? FText::Format(LOCTEXT("Paused", "Paused: {0}"), Progress)
+		: Progress);
+}
+
+#undef LOCTEXT_NAMESPACE
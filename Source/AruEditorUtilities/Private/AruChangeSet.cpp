@@ -0,0 +1,305 @@
+#include "AruChangeSet.h"
+#include "AruRunLog.h"
+#include "GameplayTagContainer.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Serialization/StructuredArchive.h"
+#include "StructUtils/InstancedStruct.h"
+
+#define LOCTEXT_NAMESPACE "FAruChangeSet"
+
+namespace Aru::Private
+{
+	static FCriticalSection LastChangeSetLock;
+	static TSharedPtr<const FAruChangeSet> LastChangeSet;
+
+	/** Whether a struct is diffed field by field. Structs that compare or serialize natively are only known as a whole. */
+	static bool HasDiffableMembers(const UScriptStruct* InStruct)
+	{
+		return InStruct != nullptr
+			&& (InStruct->StructFlags & (STRUCT_IdenticalNative | STRUCT_SerializeNative)) == 0
+			&& InStruct != FGameplayTag::StaticStruct()
+			&& InStruct != FGameplayTagQuery::StaticStruct()
+			&& InStruct != FGameplayTagContainer::StaticStruct();
+	}
+
+	/** Whether both maps hold the same keys at the same sparse indices, so their values can be diffed pair by pair. */
+	static bool HaveSameKeys(const FMapProperty* InProperty, FScriptMapHelper& InOld, FScriptMapHelper& InNew)
+	{
+		if (InOld.GetMaxIndex() != InNew.GetMaxIndex())
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index < InOld.GetMaxIndex(); ++Index)
+		{
+			const bool bValid = InOld.IsValidIndex(Index);
+			if (bValid != InNew.IsValidIndex(Index)
+				|| (bValid && !InProperty->KeyProp->Identical(InOld.GetKeyPtr(Index), InNew.GetKeyPtr(Index), PPF_None)))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+void Aru::Values::Serialize(const FProperty* InProperty, const void* InValue, TArray<uint8>& OutBytes)
+{
+	OutBytes.Reset();
+	if (InProperty == nullptr || InValue == nullptr)
+	{
+		return;
+	}
+
+	FMemoryWriter Writer{OutBytes};
+	FObjectAndNameAsStringProxyArchive Archive{Writer, false};
+	FStructuredArchiveFromArchive StructuredArchive{Archive};
+	InProperty->SerializeItem(StructuredArchive.GetSlot(), const_cast<void*>(InValue), nullptr);
+}
+
+bool Aru::Values::Deserialize(const FProperty* InProperty, void* OutValue, TConstArrayView<uint8> InBytes, const bool bLoadReferences)
+{
+	if (InProperty == nullptr || OutValue == nullptr)
+	{
+		return false;
+	}
+
+	FMemoryReaderView Reader{InBytes};
+	FObjectAndNameAsStringProxyArchive Archive{Reader, bLoadReferences};
+	{
+		FStructuredArchiveFromArchive StructuredArchive{Archive};
+		InProperty->SerializeItem(StructuredArchive.GetSlot(), OutValue, nullptr);
+	}
+	return !Reader.IsError() && Reader.Tell() == InBytes.Num();
+}
+
+FString Aru::Values::ExportText(const FProperty* InProperty, TConstArrayView<uint8> InBytes)
+{
+	const FAruScopedScratchValue Value{InProperty};
+	if (!Value.IsValid() || !Deserialize(InProperty, Value.Get(), InBytes))
+	{
+		return FString{TEXT("<unreadable>")};
+	}
+
+	FString Text;
+	InProperty->ExportText_Direct(Text, Value.Get(), nullptr, nullptr, PPF_None);
+	return Text;
+}
+
+bool FAruChangeSet::Record(const FProperty* InProperty, const void* InOldValue, const void* InNewValue)
+{
+	if (InProperty == nullptr || InOldValue == nullptr || InNewValue == nullptr || InProperty->Identical(InOldValue, InNewValue, PPF_None))
+	{
+		return false;
+	}
+
+	const UObject* Object = FAruPathScope::GetCurrentObject();
+	if (Object == nullptr)
+	{
+		return false;
+	}
+
+	FAruPropertyChange Change;
+	Change.Path = FAruPathScope::GetCurrentPath();
+	Change.Property = InProperty;
+	Aru::Values::Serialize(InProperty, InOldValue, Change.OldValue);
+	Aru::Values::Serialize(InProperty, InNewValue, Change.NewValue);
+
+	const FSoftObjectPath ObjectPath{Object};
+	FScopeLock ScopeLock{&Lock};
+	if (const int32* Found = ObjectIndices.Find(ObjectPath))
+	{
+		Change.ObjectIndex = *Found;
+	}
+	else
+	{
+		Change.ObjectIndex = Objects.Add(ObjectPath);
+		ObjectIndices.Add(ObjectPath, Change.ObjectIndex);
+	}
+	Changes.Add(MoveTemp(Change));
+	return true;
+}
+
+int32 FAruChangeSet::RecordDifferences(const FProperty* InProperty, const void* InOldValue, const void* InNewValue)
+{
+	if (InProperty == nullptr || InOldValue == nullptr || InNewValue == nullptr || InProperty->Identical(InOldValue, InNewValue, PPF_None))
+	{
+		return 0;
+	}
+
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty))
+	{
+		if (StructProperty->Struct == FInstancedStruct::StaticStruct())
+		{
+			const FInstancedStruct* OldStruct = static_cast<const FInstancedStruct*>(InOldValue);
+			const FInstancedStruct* NewStruct = static_cast<const FInstancedStruct*>(InNewValue);
+			if (OldStruct->IsValid() && OldStruct->GetScriptStruct() == NewStruct->GetScriptStruct()
+				&& Aru::Private::HasDiffableMembers(OldStruct->GetScriptStruct()))
+			{
+				return RecordMemberDifferences(OldStruct->GetScriptStruct(), OldStruct->GetMemory(), NewStruct->GetMemory());
+			}
+		}
+		else if (Aru::Private::HasDiffableMembers(StructProperty->Struct))
+		{
+			return RecordMemberDifferences(StructProperty->Struct, InOldValue, InNewValue);
+		}
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InProperty))
+	{
+		FScriptArrayHelper OldArray{ArrayProperty, InOldValue};
+		FScriptArrayHelper NewArray{ArrayProperty, InNewValue};
+		if (OldArray.Num() == NewArray.Num())
+		{
+			int32 NumRecorded = 0;
+			for (int32 Index = 0; Index < OldArray.Num(); ++Index)
+			{
+				const FAruPathScope ElementScope{EAruPathSegment::Element, NAME_None, Index};
+				NumRecorded += RecordDifferences(ArrayProperty->Inner, OldArray.GetRawPtr(Index), NewArray.GetRawPtr(Index));
+			}
+			return NumRecorded;
+		}
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(InProperty))
+	{
+		FScriptMapHelper OldMap{MapProperty, InOldValue};
+		FScriptMapHelper NewMap{MapProperty, InNewValue};
+		if (Aru::Private::HaveSameKeys(MapProperty, OldMap, NewMap))
+		{
+			int32 NumRecorded = 0;
+			for (int32 Index = 0; Index < OldMap.GetMaxIndex(); ++Index)
+			{
+				if (OldMap.IsValidIndex(Index))
+				{
+					const FAruPathScope ValueScope{EAruPathSegment::MapValue, NAME_None, Index};
+					NumRecorded += RecordDifferences(MapProperty->ValueProp, OldMap.GetValuePtr(Index), NewMap.GetValuePtr(Index));
+				}
+			}
+			return NumRecorded;
+		}
+	}
+
+	// Sets and everything that changed its shape are recorded whole, so a patch never has to rehash or resize in place.
+	return Record(InProperty, InOldValue, InNewValue) ? 1 : 0;
+}
+
+int32 FAruChangeSet::RecordMemberDifferences(const UStruct* InStruct, const void* InOldContainer, const void* InNewContainer)
+{
+	int32 NumRecorded = 0;
+	for (TFieldIterator<FProperty> It{InStruct}; It; ++It)
+	{
+		const FAruPathScope MemberScope{EAruPathSegment::Property, It->GetFName()};
+		NumRecorded += RecordDifferences(*It, It->ContainerPtrToValuePtr<void>(InOldContainer), It->ContainerPtrToValuePtr<void>(InNewContainer));
+	}
+	return NumRecorded;
+}
+
+void FAruChangeSet::Sort()
+{
+	FScopeLock ScopeLock{&Lock};
+
+	TArray<int32> ObjectOrder;
+	ObjectOrder.Reserve(Objects.Num());
+	for (int32 Index = 0; Index < Objects.Num(); ++Index)
+	{
+		ObjectOrder.Add(Index);
+	}
+	ObjectOrder.Sort([this](const int32 A, const int32 B) { return Objects[A].ToString() < Objects[B].ToString(); });
+
+	TArray<int32> Remap;
+	Remap.SetNum(Objects.Num());
+	TArray<FSoftObjectPath> SortedObjects;
+	SortedObjects.Reserve(Objects.Num());
+	for (const int32 OldIndex : ObjectOrder)
+	{
+		Remap[OldIndex] = SortedObjects.Add(Objects[OldIndex]);
+		ObjectIndices.Add(Objects[OldIndex], Remap[OldIndex]);
+	}
+	Objects = MoveTemp(SortedObjects);
+
+	for (FAruPropertyChange& Change : Changes)
+	{
+		Change.ObjectIndex = Remap[Change.ObjectIndex];
+	}
+
+	// Paths are compared as text, which keeps array elements of one property together.
+	Changes.StableSort([](const FAruPropertyChange& A, const FAruPropertyChange& B)
+	{
+		return A.ObjectIndex != B.ObjectIndex ? A.ObjectIndex < B.ObjectIndex : A.Path.ToString() < B.Path.ToString();
+	});
+}
+
+void FAruChangeSet::Report(const int32 MaxReportedChanges) const
+{
+	ARU_LOG(Info,
+		LOCTEXT("ChangeSet_Summary", "[DryRun] {0} values would change in {1} objects. Nothing was written."),
+		Changes.Num(),
+		Objects.Num());
+
+	const int32 NumReported = FMath::Min(Changes.Num(), FMath::Max(MaxReportedChanges, 0));
+	for (int32 Index = 0; Index < NumReported; ++Index)
+	{
+		const FAruPropertyChange& Change = Changes[Index];
+		ARU_LOG(Info,
+			LOCTEXT("ChangeSet_Change", "[DryRun] {0}: {1} '{2}' -> '{3}'"),
+			Objects[Change.ObjectIndex].ToString(),
+			Change.Path.ToString(),
+			Aru::Values::ExportText(Change.Property, Change.OldValue),
+			Aru::Values::ExportText(Change.Property, Change.NewValue));
+	}
+
+	if (NumReported < Changes.Num())
+	{
+		ARU_LOG(Info,
+			LOCTEXT("ChangeSet_Truncated", "[DryRun] {0} more changes are not listed."),
+			Changes.Num() - NumReported);
+	}
+}
+
+TSharedPtr<const FAruChangeSet> FAruChangeSet::GetLast()
+{
+	FScopeLock ScopeLock{&Aru::Private::LastChangeSetLock};
+	return Aru::Private::LastChangeSet;
+}
+
+void FAruChangeSet::PublishLast(const TSharedRef<const FAruChangeSet>& InChangeSet)
+{
+	FScopeLock ScopeLock{&Aru::Private::LastChangeSetLock};
+	Aru::Private::LastChangeSet = InChangeSet;
+}
+
+FAruShadowValue::FAruShadowValue(const FProperty* InProperty, void* InOriginal, const bool bInKeepCopy)
+	: Property(InProperty)
+	, Original(InOriginal)
+	, bKeepCopy(bInKeepCopy)
+{
+}
+
+void* FAruShadowValue::Write()
+{
+	if (!bWritten)
+	{
+		bWritten = true;
+		if (FAruProcessingContext* Context = FAruProcessingContext::Get(); Context != nullptr && Context->IsTransacted())
+		{
+			Context->ModifyBeforeWrite(FAruPathScope::GetCurrentObject());
+		}
+
+		if (bKeepCopy)
+		{
+			Copy.Emplace(Property);
+			if (Copy->IsValid())
+			{
+				Property->CopyCompleteValue(Copy->Get(), Original);
+			}
+		}
+	}
+
+	if (Copy.IsSet() && !Copy->IsValid())
+	{
+		return nullptr;
+	}
+	return Original;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,223 @@
+#include "AruCompiledPath.h"
+#include "Engine/DataTable.h"
+#include "StructUtils/InstancedStruct.h"
+
+namespace Aru::Private
+{
+	/** Struct a Property step reads its field from, given the value the previous step led to. */
+	static bool EnterStruct(const FProperty* InProperty, void* InValue, const UStruct*& OutStruct, void*& OutContainer)
+	{
+		const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty);
+		if (StructProperty == nullptr || InValue == nullptr)
+		{
+			return false;
+		}
+
+		if (StructProperty->Struct == FInstancedStruct::StaticStruct())
+		{
+			FInstancedStruct* InstancedStruct = static_cast<FInstancedStruct*>(InValue);
+			OutStruct = InstancedStruct->GetScriptStruct();
+			OutContainer = InstancedStruct->GetMutableMemory();
+		}
+		else
+		{
+			OutStruct = StructProperty->Struct;
+			OutContainer = InValue;
+		}
+		return OutStruct != nullptr && OutContainer != nullptr;
+	}
+}
+
+FAruCompiledPath FAruCompiledPath::Compile(const UObject* InRoot, const FAruPropertyPath& InPath)
+{
+	FAruCompiledPath Compiled;
+	if (InRoot == nullptr || InPath.Segments.IsEmpty())
+	{
+		return Compiled;
+	}
+
+	// Tracks the type each step leads to. Types below an instanced struct are only known per value.
+	const UStruct* CurrentStruct = InRoot->GetClass();
+	const FProperty* CurrentProperty = nullptr;
+	bool bDynamic = false;
+
+	Compiled.Steps.Reserve(InPath.Segments.Num());
+	for (const FAruPathSegment& Segment : InPath.Segments)
+	{
+		FAruPathStep& Step = Compiled.Steps.Add_GetRef({Segment.Kind, Segment.Name, Segment.Index, nullptr});
+		if (bDynamic)
+		{
+			continue;
+		}
+
+		switch (Segment.Kind)
+		{
+		case EAruPathSegment::Row:
+		{
+			const UDataTable* DataTable = Cast<UDataTable>(InRoot);
+			if (DataTable == nullptr || CurrentProperty != nullptr)
+			{
+				return Compiled;
+			}
+			CurrentStruct = DataTable->GetRowStruct();
+			break;
+		}
+		case EAruPathSegment::Property:
+			if (CurrentProperty != nullptr)
+			{
+				const FStructProperty* StructProperty = CastField<FStructProperty>(CurrentProperty);
+				if (StructProperty == nullptr)
+				{
+					return Compiled;
+				}
+				if (StructProperty->Struct == FInstancedStruct::StaticStruct())
+				{
+					bDynamic = true;
+					continue;
+				}
+				CurrentStruct = StructProperty->Struct;
+			}
+
+			Step.Property = CurrentStruct != nullptr ? FindFProperty<FProperty>(CurrentStruct, Segment.Name) : nullptr;
+			if (Step.Property == nullptr)
+			{
+				return Compiled;
+			}
+			CurrentProperty = Step.Property;
+			break;
+		case EAruPathSegment::Element:
+			if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(CurrentProperty))
+			{
+				CurrentProperty = ArrayProperty->Inner;
+			}
+			else if (const FSetProperty* SetProperty = CastField<FSetProperty>(CurrentProperty))
+			{
+				CurrentProperty = SetProperty->ElementProp;
+			}
+			else
+			{
+				return Compiled;
+			}
+			break;
+		case EAruPathSegment::MapKey:
+		case EAruPathSegment::MapValue:
+		{
+			const FMapProperty* MapProperty = CastField<FMapProperty>(CurrentProperty);
+			if (MapProperty == nullptr)
+			{
+				return Compiled;
+			}
+			CurrentProperty = Segment.Kind == EAruPathSegment::MapKey ? MapProperty->KeyProp : MapProperty->ValueProp;
+			break;
+		}
+		}
+	}
+
+	Compiled.bValid = true;
+	return Compiled;
+}
+
+FAruResolvedValue FAruCompiledPath::Resolve(UObject* InObject, const int32 InNumSteps) const
+{
+	if (!bValid || InObject == nullptr)
+	{
+		return {};
+	}
+
+	const UStruct* CurrentStruct = InObject->GetClass();
+	void* CurrentContainer = InObject;
+	FAruResolvedValue Current;
+	for (const FAruPathStep& Step : TConstArrayView<FAruPathStep>{Steps}.Left(InNumSteps))
+	{
+		switch (Step.Kind)
+		{
+		case EAruPathSegment::Row:
+		{
+			UDataTable* DataTable = Cast<UDataTable>(InObject);
+			if (DataTable == nullptr || Current.Property != nullptr)
+			{
+				return {};
+			}
+			CurrentStruct = DataTable->GetRowStruct();
+			CurrentContainer = DataTable->FindRowUnchecked(Step.Name);
+			if (CurrentContainer == nullptr)
+			{
+				return {};
+			}
+			break;
+		}
+		case EAruPathSegment::Property:
+		{
+			if (Current.Property != nullptr && !Aru::Private::EnterStruct(Current.Property, Current.Value, CurrentStruct, CurrentContainer))
+			{
+				return {};
+			}
+
+			const FProperty* Property = Step.Property != nullptr ? Step.Property : FindFProperty<FProperty>(CurrentStruct, Step.Name);
+			if (Property == nullptr || CurrentContainer == nullptr)
+			{
+				return {};
+			}
+			Current.Property = Property;
+			Current.Value = Property->ContainerPtrToValuePtr<void>(CurrentContainer);
+			break;
+		}
+		case EAruPathSegment::Element:
+			if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Current.Property))
+			{
+				FScriptArrayHelper ArrayHelper{ArrayProperty, Current.Value};
+				if (!ArrayHelper.IsValidIndex(Step.Index))
+				{
+					return {};
+				}
+				Current.Property = ArrayProperty->Inner;
+				Current.Value = ArrayHelper.GetRawPtr(Step.Index);
+			}
+			else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Current.Property))
+			{
+				FScriptSetHelper SetHelper{SetProperty, Current.Value};
+				if (!SetHelper.IsValidIndex(Step.Index))
+				{
+					return {};
+				}
+				Current.Property = SetProperty->ElementProp;
+				Current.Value = SetHelper.GetElementPtr(Step.Index);
+			}
+			else
+			{
+				return {};
+			}
+			break;
+		case EAruPathSegment::MapKey:
+		case EAruPathSegment::MapValue:
+		{
+			const FMapProperty* MapProperty = CastField<FMapProperty>(Current.Property);
+			if (MapProperty == nullptr)
+			{
+				return {};
+			}
+			FScriptMapHelper MapHelper{MapProperty, Current.Value};
+			if (!MapHelper.IsValidIndex(Step.Index))
+			{
+				return {};
+			}
+			const bool bKey = Step.Kind == EAruPathSegment::MapKey;
+			Current.Property = bKey ? MapProperty->KeyProp : MapProperty->ValueProp;
+			Current.Value = bKey ? MapHelper.GetKeyPtr(Step.Index) : MapHelper.GetValuePtr(Step.Index);
+			break;
+		}
+		}
+	}
+	return Current;
+}
+
+FAruPropertyPath FAruCompiledPath::ToPropertyPath() const
+{
+	FAruPropertyPath Path;
+	Path.Segments.Reserve(Steps.Num());
+	for (const FAruPathStep& Step : Steps)
+	{
+		Path.Segments.Add({Step.Kind, Step.Name, Step.Index});
+	}
+	return Path;
+}
@@ -0,0 +1,126 @@
+#include "AruContainerUtils.h"
+
+TBitArray<> Aru::Container::ResolveStagedKeys(
+	const FProperty* KeyProperty,
+	const int32 MaxIndex,
+	TFunctionRef<const void*(int32)> GetKeyPtr,
+	TConstArrayView<int32> ChangedIndices,
+	TConstArrayView<const void*> StagedKeys)
+{
+	TBitArray<> Accepted{false, ChangedIndices.Num()};
+	if (KeyProperty == nullptr || StagedKeys.Num() != ChangedIndices.Num())
+	{
+		return Accepted;
+	}
+
+	// Key currently held by each slot, updated as changes are accepted.
+	TArray<const void*> CurrentKeys;
+	CurrentKeys.SetNumZeroed(MaxIndex);
+
+	TMultiMap<uint32, int32> HashIndex;
+	HashIndex.Reserve(MaxIndex);
+	for (int32 Index = 0; Index < MaxIndex; ++Index)
+	{
+		if (const void* KeyPtr = GetKeyPtr(Index))
+		{
+			CurrentKeys[Index] = KeyPtr;
+			HashIndex.Add(KeyProperty->GetValueTypeHash(KeyPtr), Index);
+		}
+	}
+
+	for (int32 ChangeIndex = 0; ChangeIndex < ChangedIndices.Num(); ++ChangeIndex)
+	{
+		const int32 Index = ChangedIndices[ChangeIndex];
+		if (!CurrentKeys.IsValidIndex(Index) || CurrentKeys[Index] == nullptr)
+		{
+			continue;
+		}
+
+		const void* NewKeyPtr = StagedKeys[ChangeIndex];
+		const uint32 NewHash = KeyProperty->GetValueTypeHash(NewKeyPtr);
+
+		bool bDuplicated = false;
+		for (auto It = HashIndex.CreateConstKeyIterator(NewHash); It; ++It)
+		{
+			if (It.Value() != Index && KeyProperty->Identical(CurrentKeys[It.Value()], NewKeyPtr))
+			{
+				bDuplicated = true;
+				break;
+			}
+		}
+
+		if (bDuplicated)
+		{
+			continue;
+		}
+
+		HashIndex.RemoveSingle(KeyProperty->GetValueTypeHash(CurrentKeys[Index]), Index);
+		HashIndex.Add(NewHash, Index);
+		CurrentKeys[Index] = NewKeyPtr;
+		Accepted[ChangeIndex] = true;
+	}
+
+	return Accepted;
+}
+
+int32 Aru::Container::CompactArray(
+	FScriptArrayHelper& ArrayHelper,
+	const FProperty* InnerProperty,
+	TFunctionRef<bool(const void*)> ShouldRemove)
+{
+	if (InnerProperty == nullptr)
+	{
+		return 0;
+	}
+
+	const int32 Num = ArrayHelper.Num();
+	const int32 ElementSize = InnerProperty->GetSize();
+	uint8* Data = Num > 0 ? ArrayHelper.GetRawPtr(0) : nullptr;
+
+	int32 WriteIndex = 0;
+	int32 RunStart = INDEX_NONE;
+	auto FlushSurvivors = [&](const int32 RunEnd)
+	{
+		if (RunStart == INDEX_NONE)
+		{
+			return;
+		}
+
+		// Slide the whole run of survivors down in one move.
+		const int32 RunLength = RunEnd - RunStart;
+		if (RunStart != WriteIndex)
+		{
+			FMemory::Memmove(Data + WriteIndex * ElementSize, Data + RunStart * ElementSize, RunLength * ElementSize);
+		}
+		WriteIndex += RunLength;
+		RunStart = INDEX_NONE;
+	};
+
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		uint8* ElementPtr = Data + Index * ElementSize;
+		if (ShouldRemove(ElementPtr))
+		{
+			FlushSurvivors(Index);
+			InnerProperty->DestroyValue(ElementPtr);
+		}
+		else if (RunStart == INDEX_NONE)
+		{
+			RunStart = Index;
+		}
+	}
+	FlushSurvivors(Num);
+
+	const int32 RemovedCount = Num - WriteIndex;
+	if (RemovedCount > 0)
+	{
+		// The tail only holds stale bytes of moved elements, construct them so RemoveValues can destroy them safely.
+		for (int32 Index = WriteIndex; Index < Num; ++Index)
+		{
+			InnerProperty->InitializeValue(Data + Index * ElementSize);
+		}
+		ArrayHelper.RemoveValues(WriteIndex, RemovedCount);
+	}
+
+	return RemovedCount;
+}
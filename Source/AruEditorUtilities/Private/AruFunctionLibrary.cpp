@@ -1,8 +1,22 @@
 #include "AruFunctionLibrary.h"
 #include "AruTypes.h"
+#include "AruAsyncRun.h"
+#include "AruChangeSet.h"
+#include "AruPatch.h"
+#include "AruProcessingContext.h"
+#include "AruPropertyPath.h"
+#include "AruRunJournal.h"
+#include "AruTrace.h"
+#include "AruMathUtils.h"
+#include "SAruProfileReport.h"
+#include "Framework/Application/SlateApplication.h"
 #include "EditorUtilityLibrary.h"
 #include "GameplayTagContainer.h"
+#include "Async/ParallelFor.h"
+#include "Engine/CompositeDataTable.h"
+#include "Engine/DataTable.h"
 #include "StructUtils/InstancedStruct.h"
+#include "AssetCollector/AruAssetCollector.h"
 #include "AssetObject/AruAssetObject.h"
 #include "AssetFilters/AruFilter_Proxy.h"
 #include "AssetPredicates/AruPredicate_Proxy.h"
@@ -100,6 +114,115 @@ void InitializeValidationProxies(const TArray<FAruValidationDefinition>& Validat
 	}
 }
 
+namespace Aru::Private
+{
+	FORCEINLINE const FAruActionDefinition& GetDefinition(const FAruActionDefinition& Action) { return Action; }
+	FORCEINLINE const FAruActionDefinition& GetDefinition(const FAruActionDefinition* Action) { return *Action; }
+
+	/**
+	 * Configs a run over these definitions actually uses. Parallel processing is turned off when a rule can't run
+	 * on worker threads, so the flag alone never sends Blueprint proxies or asset loads to workers.
+	 */
+	template <typename DefinitionType>
+	static FAruProcessConfig MakeRunConfigs(const FAruProcessConfig& Configs, const TArray<DefinitionType>& Definitions)
+	{
+		FAruProcessConfig RunConfigs = Configs;
+		if (!RunConfigs.bAllowParallelProcessing)
+		{
+			return RunConfigs;
+		}
+
+		for (const DefinitionType& Definition : Definitions)
+		{
+			if (!Definition.IsThreadSafe())
+			{
+				ARU_LOG(Warning,
+					LOCTEXT("ParallelProcessingDisabled", "[Parallel] '{0}' uses Blueprint proxies or loads assets, so the run is processed on the game thread."),
+					Definition.GetDescription());
+				RunConfigs.bAllowParallelProcessing = false;
+				break;
+			}
+		}
+		return RunConfigs;
+	}
+
+	/** Whether the call has to start its own run: there is none, or a dry run was asked for inside a writing one. */
+	static bool NeedsOwnContext(const FAruProcessConfig& Configs)
+	{
+		const FAruProcessingContext* Context = FAruProcessingContext::Get();
+		return Context == nullptr || (Configs.bDryRun && !Context->ShouldTrackPaths());
+	}
+
+	/**
+	 * Runs the definitions on the value. A dry run already hands them copies, see ProcessRootProperty.
+	 * In a transacted run the owning object is saved to the transaction before the first write.
+	 * In a journaled run the value is copied before the first write, and what it held goes to the journal.
+	 */
+	template <typename RangeType>
+	bool InvokeActions(
+		const RangeType& Actions,
+		const FProperty* InProperty,
+		void* InValue,
+		const FAruProcessConfig& Configs,
+		FAruRunJournal* Journal)
+	{
+		bool bSuccess = false;
+		const FAruProcessingContext* Context = FAruProcessingContext::Get();
+		if (Journal == nullptr && (Context == nullptr || !Context->IsTransacted()))
+		{
+			for (const auto& Action : Actions)
+			{
+				bSuccess |= GetDefinition(Action).Invoke(InProperty, InValue, Configs.Parameters);
+			}
+			return bSuccess;
+		}
+
+		FAruShadowValue Shadow{InProperty, InValue, Journal != nullptr};
+		for (const auto& Action : Actions)
+		{
+			bSuccess |= GetDefinition(Action).Invoke(InProperty, InValue, Configs.Parameters, &Shadow);
+		}
+
+		if (!bSuccess || Journal == nullptr || !Shadow.HasCopy())
+		{
+			return bSuccess;
+		}
+		Journal->Record(InProperty, Shadow.GetCopy(), InValue);
+		return true;
+	}
+
+	/** Journal of the bound writing run, started on first use. Nullptr for dry runs and runs that don't keep one. */
+	static FAruRunJournal* GetRunJournal(const FAruProcessConfig& Configs)
+	{
+		FAruProcessingContext* Context = FAruProcessingContext::Get();
+		return Configs.bJournalChanges && Context->GetChangeSet() == nullptr ? &Context->EnableJournal() : nullptr;
+	}
+
+	/** Change set a run in this mode records into. Nullptr unless it is a dry run. */
+	static FAruChangeSet* GetPreviewChangeSet(const EAruProcessMode Mode)
+	{
+		FAruProcessingContext* Context = FAruProcessingContext::Get();
+		return Mode == EAruProcessMode::Preview && Context != nullptr ? Context->GetChangeSet() : nullptr;
+	}
+
+	/**
+	 * Marks a written object dirty. A journaled run keeps its own undo record, so no transaction snapshot is taken.
+	 * Otherwise the object is saved to the open transaction, which a transacted run already did before writing it.
+	 */
+	static void MarkModified(UObject* Object)
+	{
+		const FAruProcessingContext* Context = FAruProcessingContext::Get();
+		if (Context != nullptr && Context->GetJournal() != nullptr)
+		{
+			Object->MarkPackageDirty();
+		}
+		else
+		{
+			Object->Modify();
+		}
+	}
+}
+
 bool UAruFunctionLibrary::ModifyAssets(
 	const TArray<UObject*>& AssetsToModify,
 	const TArray<FAruActionDefinition>& Actions,
@@ -107,19 +230,336 @@ bool UAruFunctionLibrary::ModifyAssets(
 {
 	// Initialize all proxy instances
 	InitializeActionProxies(Actions);
+	const FAruProcessConfig RunConfigs = Aru::Private::MakeRunConfigs(Configs, Actions);
+
+	// The preload pass and the write pass share one run, so the loaded assets stay cached in between.
+	TUniquePtr<FAruProcessingContext> OwnedContext;
+	if (Aru::Private::NeedsOwnContext(RunConfigs))
+	{
+		OwnedContext = MakeUnique<FAruProcessingContext>(RunConfigs);
+	}
+	FAruProcessingContextScope ContextScope{OwnedContext.IsValid() ? OwnedContext.Get() : FAruProcessingContext::Get()};
+	FAruChangeSet* ChangeSet = FAruProcessingContext::Get()->GetChangeSet();
+	FAruRunJournal* Journal = Aru::Private::GetRunJournal(RunConfigs);
+
+	// Preloading and processing report into one dialog.
+	FScopedSlowTask Progress(2.f, LOCTEXT("Processing...", "Processing..."));
+	Progress.MakeDialog();
+	Progress.EnterProgressFrame(1.f);
+	if (RunConfigs.bPreloadAssets)
+	{
+		PreloadAssets(AssetsToModify, Actions, RunConfigs);
+	}
 
-	return ProcessAssets(AssetsToModify, Configs,
-		[&Actions, &Configs](const FProperty* InPropertyPtr, void* InValuePtr)
+	Progress.EnterProgressFrame(1.f);
+	const FAruRunTransactionScope TransactionScope{*FAruProcessingContext::Get(), LOCTEXT("ModifyAssets_Transaction", "Modify Assets")};
+	return ProcessAssets(AssetsToModify, RunConfigs,
+		[&Actions, &RunConfigs, Journal](const FProperty* InPropertyPtr, void* InValuePtr)
+			{
+				return Aru::Private::InvokeActions(Actions, InPropertyPtr, InValuePtr, RunConfigs, Journal);
+			},
+		ChangeSet != nullptr ? EAruProcessMode::Preview : EAruProcessMode::Modify);
+}
+
+TSharedRef<const FAruChangeSet> UAruFunctionLibrary::PreviewAssets(
+	const TArray<UObject*>& Objects,
+	const TArray<FAruActionDefinition>& Actions,
+	const FAruProcessConfig& Configs)
+{
+	FAruProcessConfig DryRunConfigs = Configs;
+	DryRunConfigs.bDryRun = true;
+
+	TSharedPtr<const FAruChangeSet> ChangeSet;
+	{
+		FAruProcessingContext Context{DryRunConfigs};
+		FAruProcessingContextScope ContextScope{&Context};
+		ModifyAssets(Objects, Actions, DryRunConfigs);
+		ChangeSet = Context.GetSharedChangeSet();
+	}
+	return ChangeSet.ToSharedRef();
+}
+
+
+void UAruFunctionLibrary::PreloadAssets(
+	const TArray<UObject*>& Objects,
+	const TArray<FAruActionDefinition>& Actions,
+	const FAruProcessConfig& Configs)
+{
+	TArray<const FAruActionDefinition*> ActionPtrs;
+	ActionPtrs.Reserve(Actions.Num());
+	for (const FAruActionDefinition& Action : Actions)
+	{
+		ActionPtrs.Add(&Action);
+	}
+	PreloadAssets(Objects, ActionPtrs, Configs);
+}
+
+void UAruFunctionLibrary::PreloadAssets(
+	const TArray<UObject*>& Objects,
+	TConstArrayView<const FAruActionDefinition*> Actions,
+	const FAruProcessConfig& Configs)
+{
+	FAruProcessingContext* Context = FAruProcessingContext::Get();
+	if (Context == nullptr)
+	{
+		return;
+	}
+
+	FScopedSlowTask Progress(Objects.Num() + 1, LOCTEXT("Preloading", "Preloading..."));
+
+	TArray<FSoftObjectPath> Paths;
+	{
+		const FAruRunPhaseScope PhaseScope{EAruRunPhase::Collect};
+		const TFunction<bool(const FProperty*, void*)> Gather = [&Actions, &Configs, &Paths](const FProperty* InPropertyPtr, const void* InValuePtr)
+			{
+				for (const FAruActionDefinition* Action : Actions)
+				{
+					Action->GatherPreloads(InPropertyPtr, InValuePtr, Configs.Parameters, Paths);
+				}
+				return false;
+			};
+
+		for (UObject* Object : Objects)
+		{
+			Progress.EnterProgressFrame(1.f);
+			ProcessAsset(Object, Configs, Gather, EAruProcessMode::Validate);
+		}
+	}
+
+	Progress.EnterProgressFrame(1.f);
+	const FAruRunPhaseScope PhaseScope{EAruRunPhase::Load};
+	ARU_TRACE_SCOPE("Aru::PreloadAssets");
+	Context->GetAssetCache().Preload(Paths);
+}
+
+namespace Aru::Private
+{
+	/** Collected assets that share one tag mask, and the definitions that mask routes them to. */
+	struct FTagRoute
+	{
+		TArray<int32> DefinitionIndices;
+		TArray<UObject*> Objects;
+	};
+
+	/**
+	 * Groups the collection by tag mask and matches every distinct mask against the definitions once.
+	 * Definitions requiring a tag no collected asset carries never match; assets without any matching definition are not loaded.
+	 */
+	template <typename DefinitionType>
+	TArray<FTagRoute> RouteByTags(const FAruAssetCollection& Collection, const TArray<DefinitionType>& Definitions)
+	{
+		const FAruTagDictionary& Dictionary = Collection.GetTagDictionary();
+		TArray<TOptional<FAruTagMask>> DefinitionMasks;
+		DefinitionMasks.Reserve(Definitions.Num());
+		for (const DefinitionType& Definition : Definitions)
+		{
+			FAruTagMask Mask;
+			DefinitionMasks.Add(Dictionary.TryMakeMask(Definition.GetTags(), Mask) ? TOptional<FAruTagMask>{MoveTemp(Mask)} : TOptional<FAruTagMask>{});
+		}
+
+		TArray<FTagRoute> Routes;
+		TMap<FAruTagMask, int32> RouteByMask;
+		const TConstArrayView<FAruTagMask> AssetMasks = Collection.GetTagMasks();
+		for (int32 AssetIndex = 0; AssetIndex < AssetMasks.Num(); ++AssetIndex)
+		{
+			int32 RouteIndex = INDEX_NONE;
+			if (const int32* Found = RouteByMask.Find(AssetMasks[AssetIndex]))
+			{
+				RouteIndex = *Found;
+			}
+			else
 			{
-				bool bSuccess = false;
-				for (const auto& Action : Actions)
+				RouteIndex = Routes.AddDefaulted();
+				RouteByMask.Add(AssetMasks[AssetIndex], RouteIndex);
+				for (int32 DefinitionIndex = 0; DefinitionIndex < DefinitionMasks.Num(); ++DefinitionIndex)
 				{
-					bSuccess |= Action.Invoke(InPropertyPtr, InValuePtr, Configs.Parameters);
+					if (DefinitionMasks[DefinitionIndex].IsSet() && UAruFunctionLibrary::IsTagMaskMatching(AssetMasks[AssetIndex], DefinitionMasks[DefinitionIndex].GetValue()))
+					{
+						Routes[RouteIndex].DefinitionIndices.Add(DefinitionIndex);
+					}
 				}
-				return bSuccess;
-			});
+			}
+
+			if (Routes[RouteIndex].DefinitionIndices.IsEmpty())
+			{
+				continue;
+			}
+
+			if (UObject* Object = Collection.ResolveObject(AssetIndex))
+			{
+				Routes[RouteIndex].Objects.Add(Object);
+			}
+		}
+
+		Routes.RemoveAll([](const FTagRoute& Route) { return Route.DefinitionIndices.IsEmpty() || Route.Objects.IsEmpty(); });
+		return Routes;
+	}
+
+	static int32 CountRoutedObjects(TConstArrayView<FTagRoute> Routes)
+	{
+		int32 NumObjects = 0;
+		for (const FTagRoute& Route : Routes)
+		{
+			NumObjects += Route.Objects.Num();
+		}
+		return NumObjects;
+	}
+}
+
+bool UAruFunctionLibrary::ModifyCollectedAssets(
+	const UAruAssetCollector* Collector,
+	const TArray<FAruActionDefinition>& Actions,
+	const FAruProcessConfig& Configs)
+{
+	if (Collector == nullptr)
+	{
+		return false;
+	}
+
+	InitializeActionProxies(Actions);
+	const FAruProcessConfig RunConfigs = Aru::Private::MakeRunConfigs(Configs, Actions);
+
+	TUniquePtr<FAruProcessingContext> OwnedContext;
+	if (Aru::Private::NeedsOwnContext(RunConfigs))
+	{
+		OwnedContext = MakeUnique<FAruProcessingContext>(RunConfigs);
+	}
+	FAruProcessingContextScope ContextScope{OwnedContext.IsValid() ? OwnedContext.Get() : FAruProcessingContext::Get()};
+	FAruChangeSet* ChangeSet = FAruProcessingContext::Get()->GetChangeSet();
+	FAruRunJournal* Journal = Aru::Private::GetRunJournal(RunConfigs);
+
+	// Every route reports into one dialog.
+	const TArray<Aru::Private::FTagRoute> Routes = Aru::Private::RouteByTags(Collector->GetCollection(), Actions);
+	FScopedSlowTask Progress(Aru::Private::CountRoutedObjects(Routes), LOCTEXT("Processing...", "Processing..."));
+	Progress.MakeDialog();
+	const FAruRunTransactionScope TransactionScope{*FAruProcessingContext::Get(), LOCTEXT("ModifyAssets_Transaction", "Modify Assets")};
+
+	bool Result = false;
+	for (const Aru::Private::FTagRoute& Route : Routes)
+	{
+		Progress.EnterProgressFrame(Route.Objects.Num());
+		TArray<const FAruActionDefinition*> RoutedActions;
+		RoutedActions.Reserve(Route.DefinitionIndices.Num());
+		for (const int32 DefinitionIndex : Route.DefinitionIndices)
+		{
+			RoutedActions.Add(&Actions[DefinitionIndex]);
+		}
+
+		if (RunConfigs.bPreloadAssets)
+		{
+			PreloadAssets(Route.Objects, RoutedActions, RunConfigs);
+		}
+
+		Result |= ProcessAssets(Route.Objects, RunConfigs,
+			[&RoutedActions, &RunConfigs, Journal](const FProperty* InPropertyPtr, void* InValuePtr)
+				{
+					return Aru::Private::InvokeActions(RoutedActions, InPropertyPtr, InValuePtr, RunConfigs, Journal);
+				},
+			ChangeSet != nullptr ? EAruProcessMode::Preview : EAruProcessMode::Modify);
+	}
+	return Result;
 }
 
+bool UAruFunctionLibrary::ValidateCollectedAssets(
+	const UAruAssetCollector* Collector,
+	const TArray<FAruValidationDefinition>& Validations,
+	const FAruProcessConfig& Configs)
+{
+	if (Collector == nullptr)
+	{
+		return false;
+	}
+
+	InitializeValidationProxies(Validations);
+	const FAruProcessConfig RunConfigs = Aru::Private::MakeRunConfigs(Configs, Validations);
+
+	TUniquePtr<FAruProcessingContext> OwnedContext;
+	if (FAruProcessingContext::Get() == nullptr)
+	{
+		OwnedContext = MakeUnique<FAruProcessingContext>(RunConfigs);
+	}
+	FAruProcessingContextScope ContextScope{OwnedContext.IsValid() ? OwnedContext.Get() : FAruProcessingContext::Get()};
+
+	const TArray<Aru::Private::FTagRoute> Routes = Aru::Private::RouteByTags(Collector->GetCollection(), Validations);
+	FScopedSlowTask Progress(Aru::Private::CountRoutedObjects(Routes), LOCTEXT("Processing...", "Processing..."));
+	Progress.MakeDialog();
+
+	bool Result = false;
+	for (const Aru::Private::FTagRoute& Route : Routes)
+	{
+		Progress.EnterProgressFrame(Route.Objects.Num());
+		Result |= ProcessAssets(Route.Objects, RunConfigs,
+			[&Route, &Validations, &RunConfigs](const FProperty* InPropertyPtr, const void* InValuePtr)
+				{
+					for (const int32 DefinitionIndex : Route.DefinitionIndices)
+					{
+						if (!Validations[DefinitionIndex].Validate(InPropertyPtr, InValuePtr, RunConfigs.Parameters))
+						{
+							return false;
+						}
+					}
+					return true;
+				},
+			EAruProcessMode::Validate);
+	}
+	return Result;
+}
+
+UAruAsyncRun* UAruFunctionLibrary::ModifyAssetsAsync(
+	const TArray<UObject*>& AssetsToModify,
+	const TArray<FAruActionDefinition>& Actions,
+	const FAruProcessConfig& Configs)
+{
+	UAruAsyncRun* Run = NewObject<UAruAsyncRun>();
+	Run->Actions = Actions;
+	InitializeActionProxies(Run->Actions);
+
+	// The processor reads the run's own copies, which outlive this call.
+	Run->Start(AssetsToModify, Aru::Private::MakeRunConfigs(Configs, Run->Actions), EAruProcessMode::Modify,
+		[Run, &AssetsToModify](const FAruProcessConfig& RunConfigs) -> TFunction<bool(const FProperty*, void*)>
+		{
+			FAruRunJournal* Journal = Aru::Private::GetRunJournal(RunConfigs);
+			if (RunConfigs.bPreloadAssets)
+			{
+				PreloadAssets(AssetsToModify, Run->Actions, RunConfigs);
+			}
+
+			const TArray<FAruActionDefinition>& RunActions = Run->Actions;
+			return [&RunActions, &RunConfigs, Journal](const FProperty* InPropertyPtr, void* InValuePtr)
+				{
+					return Aru::Private::InvokeActions(RunActions, InPropertyPtr, InValuePtr, RunConfigs, Journal);
+				};
+		});
+	return Run;
+}
+
+UAruAsyncRun* UAruFunctionLibrary::ValidateAssetsAsync(
+	const TArray<UObject*>& AssetsToValidate,
+	const TArray<FAruValidationDefinition>& Validations,
+	const FAruProcessConfig& Configs)
+{
+	UAruAsyncRun* Run = NewObject<UAruAsyncRun>();
+	Run->Validations = Validations;
+	InitializeValidationProxies(Run->Validations);
+
+	Run->Start(AssetsToValidate, Aru::Private::MakeRunConfigs(Configs, Run->Validations), EAruProcessMode::Validate,
+		[Run](const FAruProcessConfig& RunConfigs) -> TFunction<bool(const FProperty*, void*)>
+		{
+			const TArray<FAruValidationDefinition>& RunValidations = Run->Validations;
+			return [&RunValidations, &RunConfigs](const FProperty* InPropertyPtr, const void* InValuePtr)
+				{
+					for (const FAruValidationDefinition& Validation : RunValidations)
+					{
+						if (!Validation.Validate(InPropertyPtr, InValuePtr, RunConfigs.Parameters))
+						{
+							return false;
+						}
+					}
+					return true;
+				};
+		});
+	return Run;
+}
 
 bool UAruFunctionLibrary::ModifySelectedAssets(const TArray<FAruActionDefinition>& Actions, const FAruProcessConfig& Configs)
 {
@@ -134,23 +574,25 @@ bool UAruFunctionLibrary::ValidateAssets(
 {
 	// Initialize all proxy instances
 	InitializeValidationProxies(Validations);
+	const FAruProcessConfig RunConfigs = Aru::Private::MakeRunConfigs(Configs, Validations);
 
-	return ProcessAssets(AssetsToValidate, Configs,
-		[&Validations, &Configs](const FProperty* InPropertyPtr, const void* InValuePtr)
+	return ProcessAssets(AssetsToValidate, RunConfigs,
+		[&Validations, &RunConfigs](const FProperty* InPropertyPtr, const void* InValuePtr)
 			{
 				for (const auto& Validation : Validations)
 				{
 					// Applies each validation rule to the current property
 					// Uses "fail-fast" approach: if any validation fails, immediately returns false
 					// without checking the remaining validation rules for this property
-					if (!Validation.Validate(InPropertyPtr, InValuePtr, Configs.Parameters))
+					if (!Validation.Validate(InPropertyPtr, InValuePtr, RunConfigs.Parameters))
 					{
 						return false;
 					}
 				}
 				// If all validations pass for this property, return true
 				return true;
-			});
+			},
+		EAruProcessMode::Validate);
 }
 
 bool UAruFunctionLibrary::ValidateSelectedAssets(const TArray<FAruValidationDefinition>& Validations, const FAruProcessConfig& Configs)
@@ -159,11 +601,74 @@ bool UAruFunctionLibrary::ValidateSelectedAssets(const TArray<FAruValidationDefi
 	return ValidateAssets(SelectedObjects, Validations, Configs);
 }
 
+bool UAruFunctionLibrary::OpenLastProfileReport()
+{
+	const TSharedPtr<const FAruProfileReport> Report = FAruRuleProfiler::GetLastReport();
+	if (!Report.IsValid() || !FSlateApplication::IsInitialized())
+	{
+		return false;
+	}
+
+	SAruProfileReport::OpenWindow(Report.ToSharedRef());
+	return true;
+}
+
+namespace Aru::Private
+{
+	static FString GetPatchFilename(const FString& Filename)
+	{
+		return FPaths::IsRelative(Filename) ? FPaths::ProjectSavedDir() / TEXT("AruEditorUtilities") / TEXT("Patches") / Filename : Filename;
+	}
+}
+
+bool UAruFunctionLibrary::SaveLastChangeSetAsPatch(const FString& Filename)
+{
+	const TSharedPtr<const FAruChangeSet> ChangeSet = FAruChangeSet::GetLast();
+	if (!ChangeSet.IsValid() || Filename.IsEmpty())
+	{
+		return false;
+	}
+	return FAruPatch::Save(*ChangeSet, Aru::Private::GetPatchFilename(Filename));
+}
+
+bool UAruFunctionLibrary::ApplyPatch(const FString& Filename, const bool bSkipConflictingPackages)
+{
+	const TUniquePtr<FAruPatch> Patch = FAruPatch::Open(Aru::Private::GetPatchFilename(Filename));
+	if (!Patch.IsValid())
+	{
+		return false;
+	}
+
+	FAruPatchApplyOptions Options;
+	Options.bSkipConflictingPackages = bSkipConflictingPackages;
+	return !Patch->Apply(Options).HasConflicts();
+}
+
+bool UAruFunctionLibrary::RollbackLastRun()
+{
+	const TSharedPtr<const FAruRunJournal> Journal = FAruRunJournal::PopHistory();
+	return Journal.IsValid() && Journal->Rollback() > 0;
+}
+
 bool UAruFunctionLibrary::ProcessAssets(
 	const TArray<UObject*>& Objects,
 	const FAruProcessConfig& Configs,
-	const TFunction<bool(const FProperty*, void*)>& PropertyProcessor)
+	const TFunction<bool(const FProperty*, void*)>& PropertyProcessor,
+	const EAruProcessMode Mode)
 {
+	ARU_TRACE_SCOPE("Aru::ProcessAssets");
+
+	// Reuse the caller's run if there is one, so nested calls share pools and caches.
+	TUniquePtr<FAruProcessingContext> OwnedContext;
+	if (FAruProcessingContext::Get() == nullptr)
+	{
+		OwnedContext = MakeUnique<FAruProcessingContext>(Configs);
+	}
+	FAruProcessingContextScope ContextScope{OwnedContext.IsValid() ? OwnedContext.Get() : FAruProcessingContext::Get()};
+	LLM_SCOPE_BYTAG(Aru);
+	const FAruRunPhaseScope PhaseScope{EAruRunPhase::Process};
+	FAruRunMemory* RunMemory = FAruProcessingContext::Get()->GetRunMemory();
+
 	FScopedSlowTask Progress(Objects.Num(), LOCTEXT("Processing...", "Processing..."));
 	Progress.MakeDialog();
 
@@ -171,7 +676,11 @@ bool UAruFunctionLibrary::ProcessAssets(
 	for (auto& Object : Objects)
 	{
 		Progress.EnterProgressFrame(1.f);
-		Result |= ProcessAsset(Object, Configs, PropertyProcessor);
+		Result |= ProcessAsset(Object, Configs, PropertyProcessor, Mode);
+		if (RunMemory != nullptr)
+		{
+			RunMemory->Sample();
+		}
 	}
 
 	return Result;
@@ -180,8 +689,24 @@ bool UAruFunctionLibrary::ProcessAssets(
 bool UAruFunctionLibrary::ProcessAsset(
 	UObject* const Object,
 	const FAruProcessConfig& Configs,
-	const TFunction<bool(const FProperty*, void*)>& PropertyProcessor)
+	const TFunction<bool(const FProperty*, void*)>& PropertyProcessor,
+	const EAruProcessMode Mode)
 {
+	if (Object == nullptr)
+	{
+		return false;
+	}
+
+	ARU_TRACE_SCOPE_TEXT(*Object->GetPathName());
+	LLM_SCOPE_BYTAG(Aru_Traversal);
+	const FAruAssetProfileScope ProfileScope{Object};
+	Aru::Memory::CountInRun(&FAruRunStats::AssetsProcessed);
+
+	if (UDataTable* DataTable = Cast<UDataTable>(Object))
+	{
+		return ProcessDataTableRows(DataTable, Configs, PropertyProcessor, Mode);
+	}
+
 	UObject* ObjectToProcess = Object;
 	UClass* ClassToProcess = Object->GetClass();
 	if (UBlueprint* BlueprintAsset = Cast<UBlueprint>(Object))
@@ -190,6 +715,8 @@ bool UAruFunctionLibrary::ProcessAsset(
 		ObjectToProcess = ClassToProcess->GetDefaultObject();
 	}
 
+	const FAruPathScope PathScope{ObjectToProcess};
+	const FAruProcessingParameters Parameters{PropertyProcessor, Configs.Parameters, Configs.MaxSearchDepth, Aru::Private::GetPreviewChangeSet(Mode)};
 	bool bExecutedSuccessfully = false;
 	for (TFieldIterator<FProperty> It{ClassToProcess}; It; ++It)
 	{
@@ -204,17 +731,202 @@ bool UAruFunctionLibrary::ProcessAsset(
 			continue;
 		}
 
-		bExecutedSuccessfully |= ProcessContainerValues(Property, ValuePtr, {PropertyProcessor, Configs.Parameters, Configs.MaxSearchDepth});
+		bExecutedSuccessfully |= ProcessRootProperty(Property, ValuePtr, Parameters);
 	}
 
-	if (bExecutedSuccessfully)
+	// Predicates only report actual changes, so an idempotent rerun leaves the package clean.
+	if (bExecutedSuccessfully && Mode == EAruProcessMode::Modify)
 	{
-		Object->Modify();
+		ARU_TRACE_SCOPE("Aru::MarkModified");
+		Aru::Private::MarkModified(Object);
 	}
 
 	return bExecutedSuccessfully;
 }
 
+namespace Aru::Private
+{
+	static bool CanReachObjects(const UStruct* StructType, TSet<const UStruct*>& Visited);
+
+	/** Whether the traversal can step from a value of this property into an object. Instanced structs are only known at runtime, so they count. */
+	static bool CanReachObjects(const FProperty* Property, TSet<const UStruct*>& Visited)
+	{
+		if (Property->IsA<FObjectPropertyBase>())
+		{
+			return true;
+		}
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			return StructProperty->Struct == FInstancedStruct::StaticStruct() || CanReachObjects(StructProperty->Struct, Visited);
+		}
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			return CanReachObjects(ArrayProperty->Inner, Visited);
+		}
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			return CanReachObjects(SetProperty->ElementProp, Visited);
+		}
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			return CanReachObjects(MapProperty->KeyProp, Visited) || CanReachObjects(MapProperty->ValueProp, Visited);
+		}
+		return false;
+	}
+
+	static bool CanReachObjects(const UStruct* StructType, TSet<const UStruct*>& Visited)
+	{
+		bool bAlreadyVisited = false;
+		Visited.Add(StructType, &bAlreadyVisited);
+		if (StructType == nullptr || bAlreadyVisited)
+		{
+			return false;
+		}
+
+		for (TFieldIterator<FProperty> It{StructType}; It; ++It)
+		{
+			if (CanReachObjects(*It, Visited))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+bool UAruFunctionLibrary::ProcessDataTableRows(
+	UDataTable* const DataTable,
+	const FAruProcessConfig& Configs,
+	const TFunction<bool(const FProperty*, void*)>& PropertyProcessor,
+	const EAruProcessMode Mode)
+{
+	if (DataTable == nullptr)
+	{
+		return false;
+	}
+
+	// Rows of a composite table are copies rebuilt from its parents, so edits have to land in the parents.
+	if (UCompositeDataTable* CompositeTable = Cast<UCompositeDataTable>(DataTable))
+	{
+		static const FName ParentTablesName{"ParentTables"};
+		const FArrayProperty* ParentTablesProperty = FindFProperty<FArrayProperty>(UCompositeDataTable::StaticClass(), ParentTablesName);
+		if (ParentTablesProperty == nullptr)
+		{
+			return false;
+		}
+
+		bool bExecutedSuccessfully = false;
+		FScriptArrayHelper ParentTables{ParentTablesProperty, ParentTablesProperty->ContainerPtrToValuePtr<void>(CompositeTable)};
+		const FObjectPropertyBase* ParentProperty = CastField<FObjectPropertyBase>(ParentTablesProperty->Inner);
+		for (int32 Index = 0; ParentProperty != nullptr && Index < ParentTables.Num(); ++Index)
+		{
+			UDataTable* ParentTable = Cast<UDataTable>(ParentProperty->GetObjectPropertyValue(ParentTables.GetRawPtr(Index)));
+			if (ParentTable == nullptr || ParentTable == CompositeTable)
+			{
+				continue;
+			}
+			bExecutedSuccessfully |= ProcessDataTableRows(ParentTable, Configs, PropertyProcessor, Mode);
+		}
+		return bExecutedSuccessfully;
+	}
+
+	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+	if (RowStruct == nullptr)
+	{
+		return false;
+	}
+
+	TArray<FName> RowNames;
+	TArray<uint8*> Rows;
+	DataTable->GetRowMap().GenerateKeyArray(RowNames);
+	DataTable->GetRowMap().GenerateValueArray(Rows);
+
+	const FAruProcessingParameters Parameters{PropertyProcessor, Configs.Parameters, Configs.MaxSearchDepth, Aru::Private::GetPreviewChangeSet(Mode)};
+	bool bExecutedSuccessfully = false;
+	TSet<const UStruct*> VisitedStructs;
+	if (Configs.bAllowParallelProcessing && Rows.Num() > Configs.ParallelBatchSize && !Aru::Private::CanReachObjects(RowStruct, VisitedStructs))
+	{
+		// Rows never share memory, and without object references the traversal never leaves its row, so batches need no synchronization.
+		// Rows reaching objects stay on this thread: several rows may reference the same object, which the traversal writes in place.
+		const int32 BatchSize = FMath::Max(1, Configs.ParallelBatchSize);
+		const int32 NumBatches = FMath::DivideAndRoundUp(Rows.Num(), BatchSize);
+		TArray<bool> BatchResults;
+		BatchResults.SetNumZeroed(NumBatches);
+
+		// Batches only write the table itself, which has to be in the transaction before they start.
+		FAruProcessingContext* Context = FAruProcessingContext::Get();
+		if (Mode == EAruProcessMode::Modify)
+		{
+			Context->ModifyBeforeWrite(DataTable);
+		}
+		ParallelFor(NumBatches, [&](int32 BatchIndex)
+		{
+			ARU_TRACE_SCOPE("Aru::ProcessDataTableBatch");
+			LLM_SCOPE_BYTAG(Aru_Traversal);
+			FAruProcessingContextScope ContextScope{Context};
+			const FAruAssetProfileScope ProfileScope{DataTable, false};
+			const FAruPathScope PathScope{DataTable};
+			const int32 FirstRow = BatchIndex * BatchSize;
+			const int32 LastRow = FMath::Min(FirstRow + BatchSize, Rows.Num());
+			bool bBatchResult = false;
+			for (int32 RowIndex = FirstRow; RowIndex < LastRow; ++RowIndex)
+			{
+				const FAruPathScope RowScope{EAruPathSegment::Row, RowNames[RowIndex]};
+				bBatchResult |= ProcessStructValues(RowStruct, Rows[RowIndex], Parameters);
+			}
+			BatchResults[BatchIndex] = bBatchResult;
+		});
+
+		bExecutedSuccessfully = BatchResults.Contains(true);
+	}
+	else
+	{
+		const FAruPathScope PathScope{DataTable};
+		for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+		{
+			const FAruPathScope RowScope{EAruPathSegment::Row, RowNames[RowIndex]};
+			bExecutedSuccessfully |= ProcessStructValues(RowStruct, Rows[RowIndex], Parameters);
+		}
+	}
+
+	if (bExecutedSuccessfully && Mode == EAruProcessMode::Modify)
+	{
+		ARU_TRACE_SCOPE("Aru::MarkModified");
+		Aru::Private::MarkModified(DataTable);
+		DataTable->HandleDataTableChanged();
+	}
+
+	return bExecutedSuccessfully;
+}
+
+bool UAruFunctionLibrary::ProcessStructValues(
+	const UStruct* StructType,
+	void* StructValue,
+	const FAruProcessingParameters& InParameters)
+{
+	if (StructType == nullptr || StructValue == nullptr)
+	{
+		return false;
+	}
+
+	bool bExecutedSuccessfully = false;
+	for (TFieldIterator<FProperty> It{StructType}; It; ++It)
+	{
+		FProperty* Property = *It;
+		if (Property == nullptr)
+		{
+			continue;
+		}
+		void* ValuePtr = Property->ContainerPtrToValuePtr<void>(StructValue);
+		if (ValuePtr == nullptr)
+		{
+			continue;
+		}
+		bExecutedSuccessfully |= ProcessRootProperty(Property, ValuePtr, InParameters);
+	}
+	return bExecutedSuccessfully;
+}
+
 bool UAruFunctionLibrary::ProcessContainerValues(
 	FProperty* PropertyPtr,
 	void* ValuePtr,
@@ -225,11 +937,16 @@ bool UAruFunctionLibrary::ProcessContainerValues(
 		return false;
 	}
 
+	TRACE_COUNTER_INCREMENT(AruPropertiesVisited);
+	Aru::Memory::CountInRun(&FAruRunStats::PropertiesVisited);
+	const FAruPathScope PathScope{EAruPathSegment::Property, PropertyPtr->GetFName()};
+
 	bool bExecutedSuccessfully = false;
 	if (FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(PropertyPtr))
 	{
 		[&]
 		{
+			ARU_TRACE_SCOPE("Aru::TraverseObject");
 			UObject* NativeObject = ObjectProperty->GetObjectPropertyValue(ValuePtr);
 			if (NativeObject == nullptr)
 			{
@@ -248,6 +965,7 @@ bool UAruFunctionLibrary::ProcessContainerValues(
 				NativeObject = NativeClass->GetDefaultObject();
 			}
 
+			const FAruPathScope ObjectScope{NativeObject};
 			for (TFieldIterator<FProperty> It{NativeClass}; It; ++It)
 			{
 				FProperty* Property = *It;
@@ -260,7 +978,7 @@ bool UAruFunctionLibrary::ProcessContainerValues(
 				{
 					continue;
 				}
-				bExecutedSuccessfully |= ProcessContainerValues(Property, ObjectValuePtr, InParameters.GetSubsequentParameters());
+				bExecutedSuccessfully |= ProcessRootProperty(Property, ObjectValuePtr, InParameters.GetSubsequentParameters());
 			}
 		}();
 	}
@@ -268,6 +986,7 @@ bool UAruFunctionLibrary::ProcessContainerValues(
 	{
 		[&]
 		{
+			ARU_TRACE_SCOPE("Aru::TraverseStruct");
 			const UScriptStruct* StructType = StructProperty->Struct;
 			if (StructType == nullptr)
 			{
@@ -281,6 +1000,12 @@ bool UAruFunctionLibrary::ProcessContainerValues(
 				return;
 			}
 
+			if (const FAruProcessingContext* Context = FAruProcessingContext::Get();
+				Context && Context->GetConfigs().bTreatMathStructsAsLeaves && Aru::Math::GetMathStructType(StructType) != EAruMathStruct::None)
+			{
+				return;
+			}
+
 			if (StructType == FInstancedStruct::StaticStruct())
 			{
 				FInstancedStruct* InstancedStructPtr = static_cast<FInstancedStruct*>(ValuePtr);
@@ -335,30 +1060,40 @@ bool UAruFunctionLibrary::ProcessContainerValues(
 	}
 	else if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(PropertyPtr))
 	{
+		ARU_TRACE_SCOPE("Aru::TraverseArray");
 		FScriptArrayHelper ArrayHelper{ArrayProperty, ValuePtr};
+		const FAruArrayScope ArrayScope{ArrayProperty, ValuePtr};
 		for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
 		{
 			void* ItemPtr = ArrayHelper.GetRawPtr(Index);
+			const FAruPathScope ElementScope{EAruPathSegment::Element, NAME_None, Index};
 			bExecutedSuccessfully |= ProcessContainerValues(ArrayProperty->Inner, ItemPtr, InParameters.GetSubsequentParameters());
 		}
 	}
 	else if (FMapProperty* MapProperty = CastField<FMapProperty>(PropertyPtr))
 	{
+		ARU_TRACE_SCOPE("Aru::TraverseMap");
 		FScriptMapHelper MapHelper{MapProperty, ValuePtr};
 		for (int32 Index = 0; Index < MapHelper.Num(); ++Index)
 		{
 			void* MapKeyPtr = MapHelper.GetKeyPtr(Index);
 			void* MapValuePtr = MapHelper.GetValuePtr(Index);
-			bExecutedSuccessfully |= ProcessContainerValues(MapProperty->KeyProp, MapKeyPtr, InParameters.GetSubsequentParameters());
+			{
+				const FAruPathScope KeyScope{EAruPathSegment::MapKey, NAME_None, Index};
+				bExecutedSuccessfully |= ProcessContainerValues(MapProperty->KeyProp, MapKeyPtr, InParameters.GetSubsequentParameters());
+			}
+			const FAruPathScope ValueScope{EAruPathSegment::MapValue, NAME_None, Index};
 			bExecutedSuccessfully |= ProcessContainerValues(MapProperty->ValueProp, MapValuePtr, InParameters.GetSubsequentParameters());
 		}
 	}
 	else if (FSetProperty* SetProperty = CastField<FSetProperty>(PropertyPtr))
 	{
+		ARU_TRACE_SCOPE("Aru::TraverseSet");
 		FScriptSetHelper SetHelper{SetProperty, ValuePtr};
 		for (int32 Index = 0; Index < SetHelper.Num(); ++Index)
 		{
 			void* ItemPtr = SetHelper.GetElementPtr(Index);
+			const FAruPathScope ElementScope{EAruPathSegment::Element, NAME_None, Index};
 			bExecutedSuccessfully |= ProcessContainerValues(SetProperty->ElementProp, ItemPtr, InParameters.GetSubsequentParameters());
 		}
 	}
@@ -368,6 +1103,101 @@ bool UAruFunctionLibrary::ProcessContainerValues(
 	return bExecutedSuccessfully;
 }
 
+bool UAruFunctionLibrary::ProcessRootProperty(
+	FProperty* PropertyPtr,
+	void* ValuePtr,
+	const FAruProcessingParameters& InParameters)
+{
+	if (InParameters.ChangeSet == nullptr || PropertyPtr == nullptr || ValuePtr == nullptr)
+	{
+		return ProcessContainerValues(PropertyPtr, ValuePtr, InParameters);
+	}
+
+	const FAruScopedScratchValue Copy{PropertyPtr};
+	if (!Copy.IsValid())
+	{
+		return false;
+	}
+	PropertyPtr->CopyCompleteValue(Copy.Get(), ValuePtr);
+	if (!ProcessContainerValues(PropertyPtr, Copy.Get(), InParameters))
+	{
+		return false;
+	}
+
+	const FAruPathScope PathScope{EAruPathSegment::Property, PropertyPtr->GetFName()};
+	return InParameters.ChangeSet->RecordDifferences(PropertyPtr, ValuePtr, Copy.Get()) > 0;
+}
+
+bool UAruFunctionLibrary::WriteFoundProperty(
+	const FAruPropertyContext& PropertyContext,
+	const TFunctionRef<bool(const FProperty*, void*)> Writer)
+{
+	if (!PropertyContext.IsValid())
+	{
+		return false;
+	}
+
+	FProperty* Property = PropertyContext.PropertyPtr;
+	void* Value = PropertyContext.ValuePtr.GetValue();
+	if (PropertyContext.Owner == nullptr)
+	{
+		return Writer(Property, Value);
+	}
+
+	// The value isn't part of the copy the run processes, so a dry run writes another copy and records it under its own object.
+	FAruProcessingContext* Context = FAruProcessingContext::Get();
+	if (FAruChangeSet* ChangeSet = Context != nullptr ? Context->GetChangeSet() : nullptr)
+	{
+		const FAruScopedScratchValue Copy{Property};
+		if (!Copy.IsValid())
+		{
+			return false;
+		}
+		Property->CopyCompleteValue(Copy.Get(), Value);
+		if (!Writer(Property, Copy.Get()))
+		{
+			return false;
+		}
+
+		const FAruPathScope OwnerScope{PropertyContext.Owner, PropertyContext.OwnerPath};
+		return ChangeSet->RecordDifferences(Property, Value, Copy.Get()) > 0;
+	}
+
+	// Other workers may be reading the same object, and Modify isn't thread-safe.
+	if (!IsInGameThread())
+	{
+		ARU_LOG(Warning,
+			LOCTEXT("WriteFoundProperty_WorkerThread", "[WriteFoundProperty][{0}]'{1}' belongs to '{2}', which is only written on the game thread. Disable bAllowParallelProcessing for this rule."),
+			Aru::ProcessResult::Failed,
+			Property->GetFName(),
+			PropertyContext.Owner->GetPathName());
+		return false;
+	}
+
+	Aru::Private::MarkModified(PropertyContext.Owner);
+	FAruRunJournal* Journal = Context != nullptr ? Context->GetJournal() : nullptr;
+	if (Journal == nullptr)
+	{
+		return Writer(Property, Value);
+	}
+
+	// Journaled like a traversed value, under the object it belongs to.
+	const FAruScopedScratchValue OldValue{Property};
+	if (!OldValue.IsValid())
+	{
+		return false;
+	}
+	Property->CopyCompleteValue(OldValue.Get(), Value);
+	if (!Writer(Property, Value))
+	{
+		return false;
+	}
+
+	const FAruPathScope OwnerScope{PropertyContext.Owner, PropertyContext.OwnerPath};
+	Journal->Record(Property, OldValue.Get(), Value);
+	return true;
+}
+
 FString UAruFunctionLibrary::ResolveParameterizedString(const FInstancedPropertyBag& InParameters, const FString& SourceString)
 {
 	if (SourceString.IsEmpty())
@@ -509,6 +1339,10 @@ FAruPropertyContext UAruFunctionLibrary::FindPropertyByChain(
 	const FProperty* CurrentProperty = InProperty;
 	const void* CurrentPropertyValue = InPropertyValue;
 
+	// Values behind an object reference aren't part of the searched value, so the caller has to know whose they are.
+	UObject* Owner = nullptr;
+	FAruPropertyPath OwnerPath;
+
 	// If there are no more properties in the chain, return the current property
     if (PropertyChain.Num() == 0)
     {
@@ -546,6 +1380,9 @@ FAruPropertyContext UAruFunctionLibrary::FindPropertyByChain(
 
 			// Ignore nullptr check. If the value is nullptr, we will return nullptr.
 			CurrentPropertyValue = CurrentProperty->ContainerPtrToValuePtr<void>(ObjectPtr);
+			Owner = ObjectPtr;
+			OwnerPath.Segments.Reset();
+			OwnerPath.Segments.Add({EAruPathSegment::Property, CurrentProperty->GetFName()});
 		}
 		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(CurrentProperty))
 		{
@@ -587,6 +1424,10 @@ FAruPropertyContext UAruFunctionLibrary::FindPropertyByChain(
 				{
 					return {};
 				}
+				if (Owner != nullptr)
+				{
+					OwnerPath.Segments.Add({EAruPathSegment::Property, CurrentProperty->GetFName()});
+				}
 			}
 			else
 			{
@@ -602,6 +1443,10 @@ FAruPropertyContext UAruFunctionLibrary::FindPropertyByChain(
 				{
 					return {};
 				}
+				if (Owner != nullptr)
+				{
+					OwnerPath.Segments.Add({EAruPathSegment::Property, CurrentProperty->GetFName()});
+				}
 			}
 		}
 		else 
@@ -616,7 +1461,10 @@ FAruPropertyContext UAruFunctionLibrary::FindPropertyByChain(
 		// }
 	}
 
-	return FAruPropertyContext{ const_cast<FProperty*>(CurrentProperty), const_cast<void*>(CurrentPropertyValue) }; return FAruPropertyContext{ const_cast<FProperty*>(CurrentProperty), const_cast<void*>(CurrentPropertyValue) };
+	FAruPropertyContext Result{ const_cast<FProperty*>(CurrentProperty), const_cast<void*>(CurrentPropertyValue) };
+	Result.Owner = Owner;
+	Result.OwnerPath = MoveTemp(OwnerPath);
+	return Result;
 }
 
 bool UAruFunctionLibrary::IsTagMatching(const UAruAssetObject* AssetObject, const TArray<FName>& Tags)
@@ -633,12 +1481,6 @@ bool UAruFunctionLibrary::IsTagMatching(const UAruAssetObject* AssetObject, cons
 		return true;
 	}
 
-	// If AssetObject has no tags but Definition requires tags, no match
-	if (AssetObject->GetAssetTags().IsEmpty())
-	{
-		return false;
-	}
-
 	// Check if object's tags contain ALL tags from the definition
 	for (const FName& DefinitionTag : Tags)
 	{
@@ -653,4 +1495,9 @@ bool UAruFunctionLibrary::IsTagMatching(const UAruAssetObject* AssetObject, cons
 	return true;
 }
 
+bool UAruFunctionLibrary::IsTagMaskMatching(const FAruTagMask& AssetTags, const FAruTagMask& Tags)
+{
+	return AssetTags.ContainsAll(Tags);
+}
+
 #undef LOCTEXT_NAMESPACE
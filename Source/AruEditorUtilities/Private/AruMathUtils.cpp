@@ -0,0 +1,124 @@
+#include "AruMathUtils.h"
+
+EAruMathStruct Aru::Math::GetMathStructType(const UScriptStruct* Struct)
+{
+	if (Struct == nullptr)
+	{
+		return EAruMathStruct::None;
+	}
+
+	if (Struct == TBaseStructure<FVector>::Get())
+	{
+		return EAruMathStruct::Vector;
+	}
+	if (Struct == TBaseStructure<FRotator>::Get())
+	{
+		return EAruMathStruct::Rotator;
+	}
+	if (Struct == TBaseStructure<FLinearColor>::Get())
+	{
+		return EAruMathStruct::LinearColor;
+	}
+	if (Struct == TBaseStructure<FTransform>::Get())
+	{
+		return EAruMathStruct::Transform;
+	}
+	return EAruMathStruct::None;
+}
+
+EAruMathStruct Aru::Math::GetMathStructType(const FProperty* Property)
+{
+	const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+	return StructProperty != nullptr ? GetMathStructType(StructProperty->Struct) : EAruMathStruct::None;
+}
+
+VectorRegister4Double Aru::Math::Load(const EAruMathStruct Type, const void* Value, const EAruTransformComponent Component)
+{
+	switch (Type)
+	{
+	case EAruMathStruct::Vector:
+		return VectorLoadFloat3_W0(&static_cast<const FVector*>(Value)->X);
+	case EAruMathStruct::Rotator:
+		return VectorLoadFloat3_W0(&static_cast<const FRotator*>(Value)->Pitch);
+	case EAruMathStruct::LinearColor:
+		{
+			const FLinearColor& Color = *static_cast<const FLinearColor*>(Value);
+			return MakeVectorRegisterDouble(Color.R, Color.G, Color.B, Color.A);
+		}
+	case EAruMathStruct::Transform:
+		{
+			const FTransform& Transform = *static_cast<const FTransform*>(Value);
+			switch (Component)
+			{
+			case EAruTransformComponent::Translation:
+				{
+					const FVector Translation = Transform.GetTranslation();
+					return VectorLoadFloat3_W0(&Translation.X);
+				}
+			case EAruTransformComponent::Rotation:
+				{
+					const FRotator Rotation = Transform.Rotator();
+					return VectorLoadFloat3_W0(&Rotation.Pitch);
+				}
+			case EAruTransformComponent::Scale:
+				{
+					const FVector Scale = Transform.GetScale3D();
+					return VectorLoadFloat3_W0(&Scale.X);
+				}
+			}
+		}
+		break;
+	default:
+		break;
+	}
+	return VectorZeroDouble();
+}
+
+bool Aru::Math::StoreIfChanged(const EAruMathStruct Type, void* Value, const EAruTransformComponent Component, const VectorRegister4Double& NewValue)
+{
+	if (Type == EAruMathStruct::None || Value == nullptr)
+	{
+		return false;
+	}
+
+	const VectorRegister4Double Current = Load(Type, Value, Component);
+	if ((VectorMaskBits(VectorCompareNE(Current, NewValue)) & GetComponentMask(Type)) == 0)
+	{
+		return false;
+	}
+
+	switch (Type)
+	{
+	case EAruMathStruct::Vector:
+		VectorStoreFloat3(NewValue, &static_cast<FVector*>(Value)->X);
+		break;
+	case EAruMathStruct::Rotator:
+		VectorStoreFloat3(NewValue, &static_cast<FRotator*>(Value)->Pitch);
+		break;
+	case EAruMathStruct::LinearColor:
+		VectorStore(MakeVectorRegisterFloatFromDouble(NewValue), &static_cast<FLinearColor*>(Value)->R);
+		break;
+	case EAruMathStruct::Transform:
+		{
+			FTransform& Transform = *static_cast<FTransform*>(Value);
+			FVector Components;
+			VectorStoreFloat3(NewValue, &Components.X);
+			switch (Component)
+			{
+			case EAruTransformComponent::Translation:
+				Transform.SetTranslation(Components);
+				break;
+			case EAruTransformComponent::Rotation:
+				Transform.SetRotation(FRotator{Components.X, Components.Y, Components.Z}.Quaternion());
+				break;
+			case EAruTransformComponent::Scale:
+				Transform.SetScale3D(Components);
+				break;
+			}
+		}
+		break;
+	default:
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,760 @@
+#include "AruPatch.h"
+#include "AruChangeSet.h"
+#include "AruCompiledPath.h"
+#include "AruProcessingContext.h"
+#include "AruRunLog.h"
+#include "AruTrace.h"
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "Engine/DataTable.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "ScopedTransaction.h"
+#include "Serialization/ArchiveUObject.h"
+#include "Serialization/StructuredArchive.h"
+
+#define LOCTEXT_NAMESPACE "FAruPatch"
+
+/**
+ * File layout, little-endian, every table aligned to 8 bytes:
+ * header, then the string, package, object, value, segment and import tables, then a blob holding
+ * the new values and the UTF-8 text of the strings. Records only refer to each other by index,
+ * so the file is used in place without parsing.
+ */
+namespace Aru::Patch
+{
+	static constexpr uint32 Magic = 0x50555241; // "ARUP"
+	static constexpr uint32 Version = 2;
+	static constexpr uint32 NoString = MAX_uint32;
+
+	struct FHeader
+	{
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		uint32 NumStrings = 0;
+		uint32 NumPackages = 0;
+		uint32 NumObjects = 0;
+		uint32 NumValues = 0;
+		uint32 NumSegments = 0;
+		uint32 NumImports = 0;
+		uint64 StringsOffset = 0;
+		uint64 PackagesOffset = 0;
+		uint64 ObjectsOffset = 0;
+		uint64 ValuesOffset = 0;
+		uint64 SegmentsOffset = 0;
+		uint64 ImportsOffset = 0;
+		uint64 BlobOffset = 0;
+		uint64 BlobSize = 0;
+	};
+	static_assert(sizeof(FHeader) == 96);
+
+	/** Text in the blob. */
+	struct FStringRecord
+	{
+		uint64 Offset = 0;
+		uint32 Length = 0;
+		uint32 Padding = 0;
+	};
+	static_assert(sizeof(FStringRecord) == 16);
+
+	struct FPackageRecord
+	{
+		uint32 Name = NoString;
+		uint32 FirstObject = 0;
+		uint32 NumObjects = 0;
+		uint32 Padding = 0;
+	};
+	static_assert(sizeof(FPackageRecord) == 16);
+
+	struct FObjectRecord
+	{
+		uint32 Path = NoString;
+		uint32 FirstValue = 0;
+		uint32 NumValues = 0;
+		uint32 Padding = 0;
+	};
+	static_assert(sizeof(FObjectRecord) == 16);
+
+	struct FValueRecord
+	{
+		/** Hashes of the serialized value the patch replaces and of the one it writes. */
+		uint64 OldHash = 0;
+		uint64 NewHash = 0;
+		uint64 NewOffset = 0;
+		uint32 NewSize = 0;
+		uint32 FirstSegment = 0;
+		uint32 NumSegments = 0;
+		uint32 Padding = 0;
+	};
+	static_assert(sizeof(FValueRecord) == 40);
+
+	struct FSegmentRecord
+	{
+		uint32 Name = NoString;
+		int32 Index = INDEX_NONE;
+		uint8 Kind = 0;
+		uint8 Padding[7] = {};
+
+		/** Hash of the map key or set element the index picked when the patch was made, or zero if the step isn't checked. */
+		uint64 PickedHash = 0;
+	};
+	static_assert(sizeof(FSegmentRecord) == 24);
+
+	static uint64 HashBytes(TConstArrayView<uint8> InBytes)
+	{
+		return FXxHash64::HashBuffer(InBytes.GetData(), InBytes.Num()).Hash;
+	}
+
+	/**
+	 * Hash of the map key or set element a step picks from the container the steps before it lead to.
+	 * Sparse indices only name the same pair or element on identical content, so this is what tells them apart. Zero for other steps.
+	 */
+	static uint64 HashPickedElement(const FAruResolvedValue& InContainer, const FAruPathStep& InStep, TArray<uint8>& OutScratch)
+	{
+		if (!InContainer.IsValid())
+		{
+			return 0;
+		}
+
+		if (InStep.Kind == EAruPathSegment::MapKey || InStep.Kind == EAruPathSegment::MapValue)
+		{
+			const FMapProperty* MapProperty = CastField<FMapProperty>(InContainer.Property);
+			if (MapProperty == nullptr)
+			{
+				return 0;
+			}
+			FScriptMapHelper MapHelper{MapProperty, InContainer.Value};
+			if (!MapHelper.IsValidIndex(InStep.Index))
+			{
+				return 0;
+			}
+			Aru::Values::Serialize(MapProperty->KeyProp, MapHelper.GetKeyPtr(InStep.Index), OutScratch);
+			return HashBytes(OutScratch);
+		}
+
+		if (InStep.Kind == EAruPathSegment::Element)
+		{
+			const FSetProperty* SetProperty = CastField<FSetProperty>(InContainer.Property);
+			if (SetProperty == nullptr)
+			{
+				return 0;
+			}
+			FScriptSetHelper SetHelper{SetProperty, InContainer.Value};
+			if (!SetHelper.IsValidIndex(InStep.Index))
+			{
+				return 0;
+			}
+			Aru::Values::Serialize(SetProperty->ElementProp, SetHelper.GetElementPtr(InStep.Index), OutScratch);
+			return HashBytes(OutScratch);
+		}
+		return 0;
+	}
+
+	/** Whether a step is checked against the element it picks. A path ending at a key or element already compares it as its value. */
+	static bool IsPickChecked(const FAruPathStep& InStep, const bool bLastStep)
+	{
+		return InStep.Kind == EAruPathSegment::MapValue
+			|| (!bLastStep && (InStep.Kind == EAruPathSegment::MapKey || InStep.Kind == EAruPathSegment::Element));
+	}
+
+	/** Rebuilds the hashes of the sets and maps whose elements or keys the write changed, innermost first. */
+	static void RehashContainers(const FAruCompiledPath& InPath, UObject* InObject)
+	{
+		const TConstArrayView<FAruPathStep> Steps = InPath.GetSteps();
+		for (int32 StepIndex = Steps.Num() - 1; StepIndex >= 0; --StepIndex)
+		{
+			const EAruPathSegment Kind = Steps[StepIndex].Kind;
+			if (Kind != EAruPathSegment::Element && Kind != EAruPathSegment::MapKey)
+			{
+				continue;
+			}
+
+			const FAruResolvedValue Container = InPath.Resolve(InObject, StepIndex);
+			if (const FSetProperty* SetProperty = CastField<FSetProperty>(Container.Property); SetProperty != nullptr && Container.Value != nullptr)
+			{
+				FScriptSetHelper{SetProperty, Container.Value}.Rehash();
+			}
+			else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Container.Property); MapProperty != nullptr && Container.Value != nullptr)
+			{
+				FScriptMapHelper{MapProperty, Container.Value}.Rehash();
+			}
+		}
+	}
+
+	/** Gathers the objects a value references, so the apply step can load them before writing on workers. */
+	class FReferenceCollector : public FArchiveUObject
+	{
+	public:
+		explicit FReferenceCollector(TSet<FSoftObjectPath>& InPaths)
+			: Paths(InPaths)
+		{
+			SetIsSaving(true);
+		}
+
+		virtual FArchive& operator<<(UObject*& Object) override
+		{
+			if (Object != nullptr && !Object->HasAnyFlags(RF_Transient) && Object->GetOutermost() != GetTransientPackage())
+			{
+				Paths.Add(FSoftObjectPath{Object});
+			}
+			return *this;
+		}
+
+	private:
+		TSet<FSoftObjectPath>& Paths;
+	};
+
+	class FStringTable
+	{
+	public:
+		uint32 Add(const FString& InString)
+		{
+			if (const uint32* Found = Indices.Find(InString))
+			{
+				return *Found;
+			}
+			const uint32 Index = Strings.Add(InString);
+			Indices.Add(InString, Index);
+			return Index;
+		}
+
+		const TArray<FString>& GetStrings() const { return Strings; }
+
+	private:
+		TArray<FString> Strings;
+		TMap<FString, uint32> Indices;
+	};
+
+	template <typename RecordType>
+	static uint64 AppendTable(TArray64<uint8>& OutFile, const TArray<RecordType>& InRecords)
+	{
+		OutFile.SetNumZeroed(Align(OutFile.Num(), 8));
+		const uint64 Offset = OutFile.Num();
+		OutFile.Append(reinterpret_cast<const uint8*>(InRecords.GetData()), InRecords.Num() * sizeof(RecordType));
+		return Offset;
+	}
+}
+
+FAruPatch::~FAruPatch()
+{
+	// The region has to be unmapped before its file is closed.
+	MappedRegion.Reset();
+	MappedFile.Reset();
+}
+
+bool FAruPatch::Save(const FAruChangeSet& InChangeSet, const FString& InFilename)
+{
+	using namespace Aru::Patch;
+	ARU_TRACE_SCOPE("Aru::SavePatch");
+
+	// Group the objects by package, keeping the change set's order within each.
+	TArray<FName> PackageNames;
+	TMap<FName, TArray<int32>> ObjectsByPackage;
+	const TArray<FSoftObjectPath>& ChangedObjects = InChangeSet.GetObjects();
+	for (int32 ObjectIndex = 0; ObjectIndex < ChangedObjects.Num(); ++ObjectIndex)
+	{
+		const FName PackageName = ChangedObjects[ObjectIndex].GetLongPackageFName();
+		if (!ObjectsByPackage.Contains(PackageName))
+		{
+			PackageNames.Add(PackageName);
+		}
+		ObjectsByPackage.FindOrAdd(PackageName).Add(ObjectIndex);
+	}
+
+	TArray<TArray<int32>> ChangesByObject;
+	ChangesByObject.SetNum(ChangedObjects.Num());
+	const TArray<FAruPropertyChange>& Changes = InChangeSet.GetChanges();
+	for (int32 ChangeIndex = 0; ChangeIndex < Changes.Num(); ++ChangeIndex)
+	{
+		ChangesByObject[Changes[ChangeIndex].ObjectIndex].Add(ChangeIndex);
+	}
+
+	FStringTable Strings;
+	TArray<uint8> PickedBytes;
+	TArray<FPackageRecord> Packages;
+	TArray<FObjectRecord> Objects;
+	TArray<FValueRecord> Values;
+	TArray<FSegmentRecord> Segments;
+	TArray<uint8> Blob;
+	TSet<FSoftObjectPath> References;
+
+	for (const FName PackageName : PackageNames)
+	{
+		FPackageRecord& Package = Packages.AddDefaulted_GetRef();
+		Package.Name = Strings.Add(PackageName.ToString());
+		Package.FirstObject = Objects.Num();
+		for (const int32 ObjectIndex : ObjectsByPackage[PackageName])
+		{
+			// A dry run leaves its objects as they were, so the keys and elements its paths pick can be read from them.
+			UObject* ChangedObject = ChangedObjects[ObjectIndex].ResolveObject();
+			FObjectRecord& Object = Objects.AddDefaulted_GetRef();
+			Object.Path = Strings.Add(ChangedObjects[ObjectIndex].ToString());
+			Object.FirstValue = Values.Num();
+			for (const int32 ChangeIndex : ChangesByObject[ObjectIndex])
+			{
+				const FAruPropertyChange& Change = Changes[ChangeIndex];
+				FValueRecord& Value = Values.AddDefaulted_GetRef();
+				Value.OldHash = HashBytes(Change.OldValue);
+				Value.NewHash = HashBytes(Change.NewValue);
+				Value.NewOffset = Blob.Num();
+				Value.NewSize = Change.NewValue.Num();
+				Value.FirstSegment = Segments.Num();
+				Value.NumSegments = Change.Path.Segments.Num();
+				Blob.Append(Change.NewValue);
+
+				const FAruCompiledPath Compiled = FAruCompiledPath::Compile(ChangedObject, Change.Path);
+				const TConstArrayView<FAruPathStep> Steps = Compiled.GetSteps();
+				for (int32 SegmentIndex = 0; SegmentIndex < Change.Path.Segments.Num(); ++SegmentIndex)
+				{
+					const FAruPathSegment& Segment = Change.Path.Segments[SegmentIndex];
+					FSegmentRecord& Record = Segments.AddDefaulted_GetRef();
+					Record.Name = Segment.Name.IsNone() ? NoString : Strings.Add(Segment.Name.ToString());
+					Record.Index = Segment.Index;
+					Record.Kind = static_cast<uint8>(Segment.Kind);
+					if (Compiled.IsValid() && IsPickChecked(Steps[SegmentIndex], SegmentIndex == Steps.Num() - 1))
+					{
+						Record.PickedHash = HashPickedElement(Compiled.Resolve(ChangedObject, SegmentIndex), Steps[SegmentIndex], PickedBytes);
+					}
+				}
+
+				const FAruScopedScratchValue NewValue{Change.Property};
+				if (NewValue.IsValid() && Aru::Values::Deserialize(Change.Property, NewValue.Get(), Change.NewValue))
+				{
+					FReferenceCollector Collector{References};
+					FStructuredArchiveFromArchive StructuredArchive{Collector};
+					const_cast<FProperty*>(Change.Property)->SerializeItem(StructuredArchive.GetSlot(), NewValue.Get(), nullptr);
+				}
+			}
+			Object.NumValues = Values.Num() - Object.FirstValue;
+		}
+		Package.NumObjects = Objects.Num() - Package.FirstObject;
+	}
+
+	// Patched packages are loaded anyway, so only references to other packages are imports.
+	TArray<uint32> Imports;
+	for (const FSoftObjectPath& Reference : References)
+	{
+		if (!ObjectsByPackage.Contains(Reference.GetLongPackageFName()))
+		{
+			Imports.Add(Strings.Add(Reference.ToString()));
+		}
+	}
+
+	TArray<FStringRecord> StringRecords;
+	StringRecords.Reserve(Strings.GetStrings().Num());
+	for (const FString& String : Strings.GetStrings())
+	{
+		const FTCHARToUTF8 Utf8{*String};
+		StringRecords.Add({static_cast<uint64>(Blob.Num()), static_cast<uint32>(Utf8.Length()), 0});
+		Blob.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	}
+
+	FHeader Header;
+	Header.Magic = Magic;
+	Header.Version = Version;
+	Header.NumStrings = StringRecords.Num();
+	Header.NumPackages = Packages.Num();
+	Header.NumObjects = Objects.Num();
+	Header.NumValues = Values.Num();
+	Header.NumSegments = Segments.Num();
+	Header.NumImports = Imports.Num();
+
+	TArray64<uint8> File;
+	File.SetNumZeroed(sizeof(FHeader));
+	Header.StringsOffset = AppendTable(File, StringRecords);
+	Header.PackagesOffset = AppendTable(File, Packages);
+	Header.ObjectsOffset = AppendTable(File, Objects);
+	Header.ValuesOffset = AppendTable(File, Values);
+	Header.SegmentsOffset = AppendTable(File, Segments);
+	Header.ImportsOffset = AppendTable(File, Imports);
+	Header.BlobOffset = AppendTable(File, Blob);
+	Header.BlobSize = Blob.Num();
+	FMemory::Memcpy(File.GetData(), &Header, sizeof(FHeader));
+
+	if (!FFileHelper::SaveArrayToFile(File, *InFilename))
+	{
+		ARU_LOG(Error, LOCTEXT("Patch_SaveFailed", "[Patch] Failed to write '{0}'."), InFilename);
+		return false;
+	}
+
+	ARU_LOG(Info,
+		LOCTEXT("Patch_Saved", "[Patch] Saved {0} values in {1} packages to '{2}' ({3} bytes)."),
+		Values.Num(),
+		Packages.Num(),
+		FPaths::ConvertRelativePathToFull(InFilename),
+		File.Num());
+	return true;
+}
+
+TUniquePtr<FAruPatch> FAruPatch::Open(const FString& InFilename)
+{
+	TUniquePtr<FAruPatch> Patch{new FAruPatch()};
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (FOpenMappedResult Mapped = PlatformFile.OpenMappedEx(*InFilename); Mapped.HasValue())
+	{
+		Patch->MappedFile = Mapped.StealValue();
+		Patch->MappedRegion.Reset(Patch->MappedFile->MapRegion(0, Patch->MappedFile->GetFileSize()));
+	}
+
+	if (Patch->MappedRegion.IsValid())
+	{
+		Patch->Data = Patch->MappedRegion->GetMappedPtr();
+		Patch->Size = Patch->MappedRegion->GetMappedSize();
+	}
+	else
+	{
+		Patch->MappedFile.Reset();
+		if (!FFileHelper::LoadFileToArray(Patch->LoadedFile, *InFilename))
+		{
+			ARU_LOG(Error, LOCTEXT("Patch_OpenFailed", "[Patch] Failed to read '{0}'."), InFilename);
+			return nullptr;
+		}
+		Patch->Data = Patch->LoadedFile.GetData();
+		Patch->Size = Patch->LoadedFile.Num();
+	}
+
+	if (!Patch->Validate())
+	{
+		ARU_LOG(Error, LOCTEXT("Patch_Invalid", "[Patch] '{0}' is not a patch file of this version, or it is damaged."), InFilename);
+		return nullptr;
+	}
+	return Patch;
+}
+
+template <typename RecordType>
+TConstArrayView<RecordType> FAruPatch::GetTable(const uint64 InOffset, const uint32 InNum) const
+{
+	return TConstArrayView<RecordType>{reinterpret_cast<const RecordType*>(Data + InOffset), static_cast<int32>(InNum)};
+}
+
+bool FAruPatch::Validate() const
+{
+	using namespace Aru::Patch;
+	if (Data == nullptr || Size < static_cast<int64>(sizeof(FHeader)))
+	{
+		return false;
+	}
+
+	const FHeader& Header = *reinterpret_cast<const FHeader*>(Data);
+	if (Header.Magic != Magic || Header.Version != Version)
+	{
+		return false;
+	}
+
+	const auto IsTableInFile = [this](const uint64 Offset, const uint64 Num, const uint64 RecordSize)
+	{
+		return Offset % 8 == 0 && Num <= MAX_int32 && Offset <= static_cast<uint64>(Size) && Num * RecordSize <= static_cast<uint64>(Size) - Offset;
+	};
+	if (!IsTableInFile(Header.StringsOffset, Header.NumStrings, sizeof(FStringRecord))
+		|| !IsTableInFile(Header.PackagesOffset, Header.NumPackages, sizeof(FPackageRecord))
+		|| !IsTableInFile(Header.ObjectsOffset, Header.NumObjects, sizeof(FObjectRecord))
+		|| !IsTableInFile(Header.ValuesOffset, Header.NumValues, sizeof(FValueRecord))
+		|| !IsTableInFile(Header.SegmentsOffset, Header.NumSegments, sizeof(FSegmentRecord))
+		|| !IsTableInFile(Header.ImportsOffset, Header.NumImports, sizeof(uint32))
+		|| !IsTableInFile(Header.BlobOffset, Header.BlobSize, 1))
+	{
+		return false;
+	}
+
+	const auto IsRangeInTable = [](const uint64 First, const uint64 Num, const uint64 TableNum) { return First <= TableNum && Num <= TableNum - First; };
+	const auto IsString = [&Header](const uint32 Index) { return Index < Header.NumStrings; };
+
+	for (const FStringRecord& String : GetTable<FStringRecord>(Header.StringsOffset, Header.NumStrings))
+	{
+		if (!IsRangeInTable(String.Offset, String.Length, Header.BlobSize))
+		{
+			return false;
+		}
+	}
+	for (const FPackageRecord& Package : GetTable<FPackageRecord>(Header.PackagesOffset, Header.NumPackages))
+	{
+		if (!IsString(Package.Name) || !IsRangeInTable(Package.FirstObject, Package.NumObjects, Header.NumObjects))
+		{
+			return false;
+		}
+	}
+	for (const FObjectRecord& Object : GetTable<FObjectRecord>(Header.ObjectsOffset, Header.NumObjects))
+	{
+		if (!IsString(Object.Path) || !IsRangeInTable(Object.FirstValue, Object.NumValues, Header.NumValues))
+		{
+			return false;
+		}
+	}
+	for (const FValueRecord& Value : GetTable<FValueRecord>(Header.ValuesOffset, Header.NumValues))
+	{
+		if (!IsRangeInTable(Value.NewOffset, Value.NewSize, Header.BlobSize) || !IsRangeInTable(Value.FirstSegment, Value.NumSegments, Header.NumSegments))
+		{
+			return false;
+		}
+	}
+	for (const FSegmentRecord& Segment : GetTable<FSegmentRecord>(Header.SegmentsOffset, Header.NumSegments))
+	{
+		if ((Segment.Name != NoString && !IsString(Segment.Name)) || Segment.Kind > static_cast<uint8>(EAruPathSegment::Row))
+		{
+			return false;
+		}
+	}
+	for (const uint32 Import : GetTable<uint32>(Header.ImportsOffset, Header.NumImports))
+	{
+		if (!IsString(Import))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+FString FAruPatch::GetString(const uint32 InIndex) const
+{
+	using namespace Aru::Patch;
+	const FHeader& Header = *reinterpret_cast<const FHeader*>(Data);
+	if (InIndex >= Header.NumStrings)
+	{
+		return FString{};
+	}
+
+	const FStringRecord& String = GetTable<FStringRecord>(Header.StringsOffset, Header.NumStrings)[InIndex];
+	const FUTF8ToTCHAR Converted{reinterpret_cast<const UTF8CHAR*>(Data + Header.BlobOffset + String.Offset), static_cast<int32>(String.Length)};
+	return FString::ConstructFromPtrSize(Converted.Get(), Converted.Length());
+}
+
+int32 FAruPatch::GetNumPackages() const
+{
+	return reinterpret_cast<const Aru::Patch::FHeader*>(Data)->NumPackages;
+}
+
+int32 FAruPatch::GetNumValues() const
+{
+	return reinterpret_cast<const Aru::Patch::FHeader*>(Data)->NumValues;
+}
+
+FAruPatchApplyResult FAruPatch::Apply(const FAruPatchApplyOptions& InOptions) const
+{
+	using namespace Aru::Patch;
+	check(IsInGameThread());
+	ARU_TRACE_SCOPE("Aru::ApplyPatch");
+
+	const FHeader& Header = *reinterpret_cast<const FHeader*>(Data);
+	const TConstArrayView<FPackageRecord> Packages = GetTable<FPackageRecord>(Header.PackagesOffset, Header.NumPackages);
+	const TConstArrayView<FObjectRecord> ObjectRecords = GetTable<FObjectRecord>(Header.ObjectsOffset, Header.NumObjects);
+	const TConstArrayView<FValueRecord> ValueRecords = GetTable<FValueRecord>(Header.ValuesOffset, Header.NumValues);
+	const TConstArrayView<FSegmentRecord> SegmentRecords = GetTable<FSegmentRecord>(Header.SegmentsOffset, Header.NumSegments);
+
+	// Loading is the only part that waits on the disk, so every package is requested at once before any value is looked at.
+	TArray<FSoftObjectPath> ObjectPaths;
+	ObjectPaths.Reserve(ObjectRecords.Num());
+	for (const FObjectRecord& Object : ObjectRecords)
+	{
+		ObjectPaths.Add(FSoftObjectPath{GetString(Object.Path)});
+	}
+
+	TArray<FSoftObjectPath> PathsToLoad = ObjectPaths;
+	for (const uint32 Import : GetTable<uint32>(Header.ImportsOffset, Header.NumImports))
+	{
+		PathsToLoad.Add(FSoftObjectPath{GetString(Import)});
+	}
+
+	FAruAssetCache AssetCache;
+	AssetCache.Preload(PathsToLoad);
+
+	TArray<UObject*> Objects;
+	Objects.Reserve(ObjectPaths.Num());
+	for (const FSoftObjectPath& Path : ObjectPaths)
+	{
+		Objects.Add(AssetCache.Resolve(Path));
+	}
+
+	TArray<FString> SegmentNames;
+	SegmentNames.Reserve(Header.NumStrings);
+	for (uint32 Index = 0; Index < Header.NumStrings; ++Index)
+	{
+		SegmentNames.Add(GetString(Index));
+	}
+
+	struct FPendingWrite
+	{
+		int32 ObjectIndex = INDEX_NONE;
+		FAruCompiledPath Path;
+		TConstArrayView<uint8> NewValue;
+
+		/** Property of the object the value is in, for the edit notifications. Nullptr for DataTable rows. */
+		FProperty* MemberProperty = nullptr;
+	};
+
+	struct FPackageOutcome
+	{
+		FAruPatchApplyResult Result;
+		TArray<FPendingWrite> Writes;
+		TArray<FString> Conflicts;
+	};
+
+	TArray<FPackageOutcome> Outcomes;
+	Outcomes.SetNum(Packages.Num());
+
+	// Every value is checked against the hash of the value the patch was made from before anything is written.
+	ParallelFor(Packages.Num(), [&](const int32 PackageIndex)
+	{
+		ARU_TRACE_SCOPE("Aru::VerifyPatchPackage");
+		const FPackageRecord& Package = Packages[PackageIndex];
+		FPackageOutcome& Outcome = Outcomes[PackageIndex];
+		TArray<uint8> CurrentBytes;
+		TArray<uint8> PickedBytes;
+
+		for (uint32 ObjectIndex = Package.FirstObject; ObjectIndex < Package.FirstObject + Package.NumObjects; ++ObjectIndex)
+		{
+			const FObjectRecord& ObjectRecord = ObjectRecords[ObjectIndex];
+			UObject* Object = Objects[ObjectIndex];
+			for (uint32 ValueIndex = ObjectRecord.FirstValue; ValueIndex < ObjectRecord.FirstValue + ObjectRecord.NumValues; ++ValueIndex)
+			{
+				const FValueRecord& Value = ValueRecords[ValueIndex];
+				const TConstArrayView<FSegmentRecord> ValueSegments = SegmentRecords.Slice(Value.FirstSegment, Value.NumSegments);
+
+				FAruPropertyPath Path;
+				Path.Segments.Reserve(Value.NumSegments);
+				for (const FSegmentRecord& Segment : ValueSegments)
+				{
+					Path.Segments.Add({static_cast<EAruPathSegment>(Segment.Kind), Segment.Name != NoString ? FName{SegmentNames[Segment.Name]} : NAME_None, Segment.Index});
+				}
+
+				FAruCompiledPath Compiled = FAruCompiledPath::Compile(Object, Path);
+				const FAruResolvedValue Target = Compiled.Resolve(Object);
+				if (!Target.IsValid())
+				{
+					++Outcome.Result.NumUnresolved;
+					Outcome.Conflicts.Add(FString::Printf(TEXT("%s: %s does not exist"), *ObjectPaths[ObjectIndex].ToString(), *Path.ToString()));
+					continue;
+				}
+
+				// An index that now picks another key or element is a different value, whatever it holds.
+				const TConstArrayView<FAruPathStep> Steps = Compiled.GetSteps();
+				bool bPicksOther = false;
+				for (int32 StepIndex = 0; StepIndex < Steps.Num() && !bPicksOther; ++StepIndex)
+				{
+					const uint64 PickedHash = ValueSegments[StepIndex].PickedHash;
+					bPicksOther = PickedHash != 0 && PickedHash != HashPickedElement(Compiled.Resolve(Object, StepIndex), Steps[StepIndex], PickedBytes);
+				}
+				if (bPicksOther)
+				{
+					++Outcome.Result.NumConflicts;
+					Outcome.Conflicts.Add(FString::Printf(TEXT("%s: %s picks another element since the patch was made"), *ObjectPaths[ObjectIndex].ToString(), *Path.ToString()));
+					continue;
+				}
+
+				Aru::Values::Serialize(Target.Property, Target.Value, CurrentBytes);
+				const uint64 CurrentHash = HashBytes(CurrentBytes);
+				if (CurrentHash == Value.NewHash)
+				{
+					++Outcome.Result.NumAlreadyApplied;
+				}
+				else if (CurrentHash != Value.OldHash)
+				{
+					++Outcome.Result.NumConflicts;
+					Outcome.Conflicts.Add(FString::Printf(TEXT("%s: %s changed since the patch was made"), *ObjectPaths[ObjectIndex].ToString(), *Path.ToString()));
+				}
+				else
+				{
+					const TConstArrayView<uint8> NewValue{Data + Header.BlobOffset + Value.NewOffset, static_cast<int32>(Value.NewSize)};
+					FProperty* MemberProperty = Steps[0].Kind == EAruPathSegment::Property ? const_cast<FProperty*>(Steps[0].Property) : nullptr;
+					Outcome.Writes.Add({static_cast<int32>(ObjectIndex), MoveTemp(Compiled), NewValue, MemberProperty});
+				}
+			}
+		}
+
+		if (InOptions.bSkipConflictingPackages && Outcome.Result.HasConflicts())
+		{
+			Outcome.Result.NumSkipped += Outcome.Writes.Num();
+			Outcome.Writes.Empty();
+		}
+	});
+
+	TMap<UObject*, TSet<FProperty*>> ChangedObjects;
+	for (const FPackageOutcome& Outcome : Outcomes)
+	{
+		for (const FPendingWrite& Write : Outcome.Writes)
+		{
+			ChangedObjects.FindOrAdd(Objects[Write.ObjectIndex]).Add(Write.MemberProperty);
+		}
+	}
+
+	// One transaction snapshots every object before it changes, so the editor's undo restores what the patch overwrote.
+	const FScopedTransaction Transaction{LOCTEXT("Patch_Transaction", "Apply Patch"), !ChangedObjects.IsEmpty()};
+	for (const TPair<UObject*, TSet<FProperty*>>& Changed : ChangedObjects)
+	{
+		Changed.Key->Modify();
+		for (FProperty* MemberProperty : Changed.Value)
+		{
+			Changed.Key->PreEditChange(MemberProperty);
+		}
+	}
+
+	// Packages never share memory, so each one is written by its own task. Everything the values reference was loaded above.
+	ParallelFor(Packages.Num(), [&](const int32 PackageIndex)
+	{
+		ARU_TRACE_SCOPE("Aru::WritePatchPackage");
+		FPackageOutcome& Outcome = Outcomes[PackageIndex];
+		for (const FPendingWrite& Write : Outcome.Writes)
+		{
+			// Resolved again, since an earlier write may have reallocated the container this value lives in.
+			const FAruResolvedValue Target = Write.Path.Resolve(Objects[Write.ObjectIndex]);
+			const FAruScopedScratchValue NewValue{Target.Property};
+			if (Target.IsValid() && NewValue.IsValid() && Aru::Values::Deserialize(Target.Property, NewValue.Get(), Write.NewValue, false))
+			{
+				Target.Property->CopyCompleteValue(Target.Value, NewValue.Get());
+				RehashContainers(Write.Path, Objects[Write.ObjectIndex]);
+				++Outcome.Result.NumApplied;
+			}
+			else
+			{
+				++Outcome.Result.NumUnresolved;
+			}
+		}
+	});
+
+	// Notifications run on the game thread, once every value of the object is written.
+	for (const TPair<UObject*, TSet<FProperty*>>& Changed : ChangedObjects)
+	{
+		for (FProperty* MemberProperty : Changed.Value)
+		{
+			FPropertyChangedEvent ChangedEvent{MemberProperty, EPropertyChangeType::ValueSet};
+			Changed.Key->PostEditChangeProperty(ChangedEvent);
+		}
+		if (UDataTable* DataTable = Cast<UDataTable>(Changed.Key))
+		{
+			DataTable->HandleDataTableChanged();
+		}
+	}
+
+	FAruPatchApplyResult Result;
+	int32 NumReportedConflicts = 0;
+	for (const FPackageOutcome& Outcome : Outcomes)
+	{
+		Result.NumApplied += Outcome.Result.NumApplied;
+		Result.NumAlreadyApplied += Outcome.Result.NumAlreadyApplied;
+		Result.NumConflicts += Outcome.Result.NumConflicts;
+		Result.NumUnresolved += Outcome.Result.NumUnresolved;
+		Result.NumSkipped += Outcome.Result.NumSkipped;
+		Result.NumPackagesChanged += Outcome.Result.NumApplied > 0 ? 1 : 0;
+
+		for (const FString& Conflict : Outcome.Conflicts)
+		{
+			if (NumReportedConflicts++ < 100)
+			{
+				ARU_LOG(Warning, LOCTEXT("Patch_Conflict", "[Patch] {0}"), Conflict);
+			}
+		}
+	}
+
+	ARU_LOG(Info,
+		LOCTEXT("Patch_Applied", "[Patch] Applied {0} values in {1} packages. {2} were already applied, {3} conflicted, {4} could not be resolved and {5} were skipped with their package."),
+		Result.NumApplied,
+		Result.NumPackagesChanged,
+		Result.NumAlreadyApplied,
+		Result.NumConflicts,
+		Result.NumUnresolved,
+		Result.NumSkipped);
+	return Result;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,487 @@
+#include "AruProcessingContext.h"
+#include "AruChangeSet.h"
+#include "AruRunJournal.h"
+#include "AruTrace.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/StreamableManager.h"
+#include "ScopedTransaction.h"
+#include <atomic>
+
+#define LOCTEXT_NAMESPACE "FAruProcessingContext"
+
+namespace Aru::Private
+{
+	static thread_local FAruProcessingContext* CurrentContext = nullptr;
+	static thread_local const FAruArrayScope* CurrentArrayScope = nullptr;
+	static std::atomic<uint64> NextArrayScopeSerial{1};
+}
+
+FAruScratchPool::~FAruScratchPool()
+{
+	Reset();
+}
+
+FAruScratchPool::FSlotLayout FAruScratchPool::GetSlotLayout(const FProperty* InProperty)
+{
+	return FSlotLayout{InProperty->GetSize(), FMath::Max(InProperty->GetMinAlignment(), 1)};
+}
+
+void* FAruScratchPool::Acquire(const FProperty* InProperty)
+{
+	if (InProperty == nullptr)
+	{
+		return nullptr;
+	}
+
+	LLM_SCOPE_BYTAG(Aru_Scratch);
+	{
+		FScopeLock ScopeLock{&Lock};
+		if (TArray<void*>* Initialized = InitializedSlots.Find(InProperty); Initialized && !Initialized->IsEmpty())
+		{
+			return Initialized->Pop(EAllowShrinking::No);
+		}
+	}
+
+	TRACE_COUNTER_INCREMENT(AruScratchAllocations);
+	Aru::Memory::CountInRun(&FAruRunStats::ScratchAllocations);
+	const FSlotLayout Layout = GetSlotLayout(InProperty);
+	void* Value = FMemory::Malloc(Layout.Size, Layout.Alignment);
+	if (Value == nullptr)
+	{
+		return nullptr;
+	}
+
+	InProperty->InitializeValue(Value);
+	return Value;
+}
+
+void FAruScratchPool::Release(const FProperty* InProperty, void* InValue)
+{
+	if (InProperty == nullptr || InValue == nullptr)
+	{
+		return;
+	}
+
+	// Resetting keeps the value constructed, so the next Acquire skips InitializeValue.
+	InProperty->ClearValue(InValue);
+
+	LLM_SCOPE_BYTAG(Aru_Scratch);
+	FScopeLock ScopeLock{&Lock};
+	InitializedSlots.FindOrAdd(InProperty).Add(InValue);
+}
+
+void FAruScratchPool::Reset()
+{
+	FScopeLock ScopeLock{&Lock};
+	for (TPair<const FProperty*, TArray<void*>>& Pair : InitializedSlots)
+	{
+		for (void* Value : Pair.Value)
+		{
+			Pair.Key->DestroyValue(Value);
+			FMemory::Free(Value);
+		}
+	}
+	InitializedSlots.Empty();
+}
+
+FAruScopedScratchValue::FAruScopedScratchValue(const FProperty* InProperty)
+	: Property(InProperty)
+{
+	if (Property == nullptr)
+	{
+		return;
+	}
+
+	if (FAruProcessingContext* Context = FAruProcessingContext::Get())
+	{
+		Pool = &Context->GetScratchPool();
+		Value = Pool->Acquire(Property);
+		return;
+	}
+
+	LLM_SCOPE_BYTAG(Aru_Scratch);
+	TRACE_COUNTER_INCREMENT(AruScratchAllocations);
+	Value = FMemory::Malloc(Property->GetSize(), FMath::Max(Property->GetMinAlignment(), 1));
+	if (Value != nullptr)
+	{
+		Property->InitializeValue(Value);
+	}
+}
+
+FAruScopedScratchValue::~FAruScopedScratchValue()
+{
+	if (Value == nullptr)
+	{
+		return;
+	}
+
+	if (Pool != nullptr)
+	{
+		Pool->Release(Property, Value);
+		return;
+	}
+
+	Property->DestroyValue(Value);
+	FMemory::Free(Value);
+}
+
+FAruScratchArray::FAruScratchArray(const FProperty* InProperty, int32 InNum)
+	: Property(InProperty), NumValues(FMath::Max(InNum, 0))
+{
+	if (Property == nullptr || NumValues == 0)
+	{
+		return;
+	}
+
+	const int32 Alignment = FMath::Max(Property->GetMinAlignment(), 1);
+	Stride = Align(Property->GetSize(), Alignment);
+	LLM_SCOPE_BYTAG(Aru_Scratch);
+	TRACE_COUNTER_INCREMENT(AruScratchAllocations);
+	Aru::Memory::CountInRun(&FAruRunStats::ScratchAllocations);
+	Data = static_cast<uint8*>(FMemory::Malloc(static_cast<SIZE_T>(Stride) * NumValues, Alignment));
+	if (Data == nullptr)
+	{
+		return;
+	}
+
+	for (int32 Index = 0; Index < NumValues; ++Index)
+	{
+		Property->InitializeValue(GetRawPtr(Index));
+	}
+}
+
+FAruScratchArray::~FAruScratchArray()
+{
+	if (Data == nullptr)
+	{
+		return;
+	}
+
+	for (int32 Index = 0; Index < NumValues; ++Index)
+	{
+		Property->DestroyValue(GetRawPtr(Index));
+	}
+	FMemory::Free(Data);
+}
+
+FAruAssetCache::FAruAssetCache()
+	: StreamableManager(MakeUnique<FStreamableManager>())
+{
+}
+
+FAruAssetCache::~FAruAssetCache()
+{
+	for (const TSharedPtr<FStreamableHandle>& Handle : Handles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->ReleaseHandle();
+		}
+	}
+}
+
+void FAruAssetCache::Preload(TConstArrayView<FSoftObjectPath> InPaths)
+{
+	TSet<FSoftObjectPath> UniquePaths;
+	{
+		FScopeLock ScopeLock{&Lock};
+		for (const FSoftObjectPath& Path : InPaths)
+		{
+			if (!Path.IsNull() && !ResolvedAssets.Contains(Path) && !MissingAssets.Contains(Path))
+			{
+				UniquePaths.Add(Path);
+			}
+		}
+	}
+	TArray<FSoftObjectPath> PendingPaths = UniquePaths.Array();
+
+	if (PendingPaths.IsEmpty())
+	{
+		return;
+	}
+
+	ARU_TRACE_SCOPE("Aru::LoadAssets");
+	TRACE_COUNTER_ADD(AruAssetsLoaded, PendingPaths.Num());
+	TSharedPtr<FStreamableHandle> Handle;
+	{
+		LLM_SCOPE_BYTAG(Aru_Assets);
+		Handle = StreamableManager->RequestAsyncLoad(PendingPaths, FStreamableDelegate{}, FStreamableManager::AsyncLoadHighPriority);
+		if (Handle.IsValid())
+		{
+			Handle->WaitUntilComplete();
+		}
+	}
+
+	LLM_SCOPE_BYTAG(Aru_Caches);
+	TRACE_COUNTER_ADD(AruCacheEntries, PendingPaths.Num());
+	Aru::Memory::CountInRun(&FAruRunStats::CacheEntries, PendingPaths.Num());
+	FScopeLock ScopeLock{&Lock};
+	if (Handle.IsValid())
+	{
+		Handles.Add(Handle);
+	}
+
+	for (const FSoftObjectPath& Path : PendingPaths)
+	{
+		if (UObject* Object = Path.ResolveObject())
+		{
+			ResolvedAssets.Add(Path, Object);
+		}
+		else
+		{
+			MissingAssets.Add(Path);
+		}
+	}
+}
+
+UObject* FAruAssetCache::Resolve(const FSoftObjectPath& InPath)
+{
+	if (InPath.IsNull())
+	{
+		return nullptr;
+	}
+
+	{
+		FScopeLock ScopeLock{&Lock};
+		if (const TWeakObjectPtr<UObject>* Cached = ResolvedAssets.Find(InPath); Cached && Cached->IsValid())
+		{
+			return Cached->Get();
+		}
+
+		if (MissingAssets.Contains(InPath))
+		{
+			return nullptr;
+		}
+	}
+
+	UObject* Object = nullptr;
+	if (ensureMsgf(IsInGameThread(), TEXT("Assets can only be loaded on the game thread, '%s' is treated as missing."), *InPath.ToString()))
+	{
+		ARU_TRACE_SCOPE("Aru::LoadAsset");
+		LLM_SCOPE_BYTAG(Aru_Assets);
+		TRACE_COUNTER_INCREMENT(AruAssetsLoaded);
+		Object = InPath.TryLoad();
+	}
+
+	LLM_SCOPE_BYTAG(Aru_Caches);
+	TRACE_COUNTER_INCREMENT(AruCacheEntries);
+	Aru::Memory::CountInRun(&FAruRunStats::CacheEntries);
+	FScopeLock ScopeLock{&Lock};
+	if (Object != nullptr)
+	{
+		ResolvedAssets.Add(InPath, Object);
+	}
+	else
+	{
+		MissingAssets.Add(InPath);
+	}
+	return Object;
+}
+
+UObject* FAruAssetCache::LoadAsset(const FSoftObjectPath& InPath)
+{
+	if (FAruProcessingContext* Context = FAruProcessingContext::Get())
+	{
+		return Context->GetAssetCache().Resolve(InPath);
+	}
+
+	return InPath.TryLoad();
+}
+
+FAssetData FAruAssetCache::ResolveAssetData(const FSoftObjectPath& InPath)
+{
+	if (InPath.IsNull())
+	{
+		return {};
+	}
+
+	{
+		FScopeLock ScopeLock{&Lock};
+		if (const FAssetData* Cached = AssetDataCache.Find(InPath))
+		{
+			return *Cached;
+		}
+	}
+
+	FAssetData AssetData = IAssetRegistry::GetChecked().GetAssetByObjectPath(InPath);
+
+	LLM_SCOPE_BYTAG(Aru_Caches);
+	TRACE_COUNTER_INCREMENT(AruCacheEntries);
+	Aru::Memory::CountInRun(&FAruRunStats::CacheEntries);
+	FScopeLock ScopeLock{&Lock};
+	AssetDataCache.Add(InPath, AssetData);
+	return AssetData;
+}
+
+FAssetData FAruAssetCache::FindAssetData(const FSoftObjectPath& InPath)
+{
+	if (FAruProcessingContext* Context = FAruProcessingContext::Get())
+	{
+		return Context->GetAssetCache().ResolveAssetData(InPath);
+	}
+
+	return InPath.IsNull() ? FAssetData{} : IAssetRegistry::GetChecked().GetAssetByObjectPath(InPath);
+}
+
+FAruProcessingContext::FAruProcessingContext(const FAruProcessConfig& InConfigs)
+	: Configs(InConfigs)
+	, RunLog(InConfigs.LogVerbosity, InConfigs.LogBufferCapacity)
+{
+	if (Configs.bProfileRules)
+	{
+		RuleProfiler = MakeUnique<FAruRuleProfiler>();
+	}
+
+	if (Configs.bReportMemory)
+	{
+		RunMemory = MakeUnique<FAruRunMemory>(RunStats);
+	}
+
+	if (Configs.bDryRun)
+	{
+		ChangeSet = MakeShared<FAruChangeSet>();
+	}
+}
+
+FAruProcessingContext::~FAruProcessingContext()
+{
+	ensureMsgf(Aru::Private::CurrentContext != this, TEXT("Processing context destroyed while still bound to a thread."));
+
+	// The context is no longer bound here, so the report phase is driven directly.
+	const bool bReportPhase = RunMemory.IsValid() && RunMemory->BeginPhase(EAruRunPhase::Report);
+
+	RunLog.Flush();
+	if (RuleProfiler.IsValid())
+	{
+		FAruRuleProfiler::PublishReport(RuleProfiler->BuildReport());
+	}
+
+	if (ChangeSet.IsValid())
+	{
+		ChangeSet->Sort();
+		ChangeSet->Report();
+		FAruChangeSet::PublishLast(ChangeSet.ToSharedRef());
+	}
+
+	if (Journal.IsValid() && !Journal->IsEmpty())
+	{
+		FAruRunJournal::PushHistory(Journal.ToSharedRef());
+		ARU_LOG(Info,
+			LOCTEXT("Journal_Recorded", "[Journal] Recorded {0} changed values in {1} objects ({2} KiB). RollbackLastRun restores them."),
+			Journal->Num(),
+			Journal->GetNumObjects(),
+			Journal->GetNumValueBytes() / 1024);
+	}
+
+	if (bReportPhase)
+	{
+		RunMemory->EndPhase(EAruRunPhase::Report);
+		RunMemory->Report();
+	}
+}
+
+FAruRunJournal& FAruProcessingContext::EnableJournal()
+{
+	if (!Journal.IsValid())
+	{
+		LLM_SCOPE_BYTAG(Aru_Journal);
+		Journal = MakeShared<FAruRunJournal>();
+	}
+	return *Journal;
+}
+
+void FAruProcessingContext::ModifyBeforeWrite(UObject* InObject)
+{
+	if (!bTransacted || InObject == nullptr || !IsInGameThread())
+	{
+		return;
+	}
+
+	bool bAlreadyTransacted = false;
+	TransactedObjects.Add(InObject, &bAlreadyTransacted);
+	if (!bAlreadyTransacted)
+	{
+		// Only dirtied once a value actually changes, see UAruFunctionLibrary::ProcessAsset.
+		InObject->Modify(false);
+	}
+}
+
+FAruProcessingContext* FAruProcessingContext::Get()
+{
+	return Aru::Private::CurrentContext;
+}
+
+FAruRunTransactionScope::FAruRunTransactionScope(FAruProcessingContext& InContext, const FText& InDescription)
+{
+	if (InContext.bTransacted || InContext.GetChangeSet() != nullptr || InContext.GetJournal() != nullptr)
+	{
+		return;
+	}
+
+	Context = &InContext;
+	Transaction = MakeUnique<FScopedTransaction>(InDescription);
+	Context->bTransacted = true;
+}
+
+FAruRunTransactionScope::~FAruRunTransactionScope()
+{
+	if (Context != nullptr)
+	{
+		Context->bTransacted = false;
+		Context->TransactedObjects.Reset();
+	}
+}
+
+FAruProcessingContextScope::FAruProcessingContextScope(FAruProcessingContext* InContext)
+	: PreviousContext(Aru::Private::CurrentContext)
+{
+	Aru::Private::CurrentContext = InContext;
+}
+
+FAruProcessingContextScope::~FAruProcessingContextScope()
+{
+	Aru::Private::CurrentContext = PreviousContext;
+}
+
+FAruArrayScope::FAruArrayScope(const FArrayProperty* InArrayProperty, const void* InArrayValue)
+	: ArrayProperty(InArrayProperty)
+	, ArrayValue(InArrayValue)
+	, Serial(Aru::Private::NextArrayScopeSerial.fetch_add(1, std::memory_order_relaxed))
+	, PreviousScope(Aru::Private::CurrentArrayScope)
+{
+	Aru::Private::CurrentArrayScope = this;
+}
+
+FAruArrayScope::~FAruArrayScope()
+{
+	Aru::Private::CurrentArrayScope = PreviousScope;
+}
+
+const FAruArrayScope* FAruArrayScope::Get()
+{
+	return Aru::Private::CurrentArrayScope;
+}
+
+int32 FAruArrayScope::IndexOf(const FProperty* InElementProperty, const void* InElementValue) const
+{
+	if (ArrayProperty == nullptr || ArrayValue == nullptr || InElementProperty != ArrayProperty->Inner)
+	{
+		return INDEX_NONE;
+	}
+
+	FScriptArrayHelper ArrayHelper{ArrayProperty, ArrayValue};
+	if (ArrayHelper.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const UPTRINT Offset = reinterpret_cast<UPTRINT>(InElementValue) - reinterpret_cast<UPTRINT>(ArrayHelper.GetRawPtr(0));
+	const int32 ElementSize = ArrayProperty->Inner->GetSize();
+	if (Offset % ElementSize != 0 || Offset / ElementSize >= static_cast<UPTRINT>(ArrayHelper.Num()))
+	{
+		return INDEX_NONE;
+	}
+	return static_cast<int32>(Offset / ElementSize);
+}
+
+#undef LOCTEXT_NAMESPACE
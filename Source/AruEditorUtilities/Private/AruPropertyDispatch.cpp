@@ -0,0 +1,164 @@
+#include "AruPropertyDispatch.h"
+#include "AruProcessingContext.h"
+#include "AruTrace.h"
+#include "GameplayTagContainer.h"
+#include "StructUtils/InstancedStruct.h"
+
+FAruValueDispatch Aru::Dispatch::Resolve(const FProperty* Property)
+{
+	FAruValueDispatch Dispatch;
+	if (Property == nullptr)
+	{
+		return Dispatch;
+	}
+
+	if (Property->IsA<FBoolProperty>())
+	{
+		Dispatch.Kind = EAruValueKind::Bool;
+	}
+	else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+	{
+		if (ByteProperty->Enum != nullptr)
+		{
+			Dispatch.Kind = EAruValueKind::Enum;
+			Dispatch.UnderlyingProperty = ByteProperty;
+			Dispatch.Enum = ByteProperty->Enum;
+		}
+		else
+		{
+			Dispatch.Kind = EAruValueKind::Byte;
+		}
+	}
+	else if (Property->IsA<FInt8Property>())
+	{
+		Dispatch.Kind = EAruValueKind::Int8;
+	}
+	else if (Property->IsA<FInt16Property>())
+	{
+		Dispatch.Kind = EAruValueKind::Int16;
+	}
+	else if (Property->IsA<FIntProperty>())
+	{
+		Dispatch.Kind = EAruValueKind::Int32;
+	}
+	else if (Property->IsA<FInt64Property>())
+	{
+		Dispatch.Kind = EAruValueKind::Int64;
+	}
+	else if (Property->IsA<FUInt16Property>())
+	{
+		Dispatch.Kind = EAruValueKind::UInt16;
+	}
+	else if (Property->IsA<FUInt32Property>())
+	{
+		Dispatch.Kind = EAruValueKind::UInt32;
+	}
+	else if (Property->IsA<FUInt64Property>())
+	{
+		Dispatch.Kind = EAruValueKind::UInt64;
+	}
+	else if (Property->IsA<FFloatProperty>())
+	{
+		Dispatch.Kind = EAruValueKind::Float;
+	}
+	else if (Property->IsA<FDoubleProperty>())
+	{
+		Dispatch.Kind = EAruValueKind::Double;
+	}
+	else if (Property->IsA<FStrProperty>())
+	{
+		Dispatch.Kind = EAruValueKind::String;
+	}
+	else if (Property->IsA<FTextProperty>())
+	{
+		Dispatch.Kind = EAruValueKind::Text;
+	}
+	else if (Property->IsA<FNameProperty>())
+	{
+		Dispatch.Kind = EAruValueKind::Name;
+	}
+	else if (Property->IsA<FObjectProperty>())
+	{
+		Dispatch.Kind = EAruValueKind::Object;
+	}
+	else if (Property->IsA<FSoftObjectProperty>())
+	{
+		Dispatch.Kind = EAruValueKind::SoftObject;
+	}
+	else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+	{
+		Dispatch.UnderlyingProperty = EnumProperty->GetUnderlyingProperty();
+		Dispatch.Enum = EnumProperty->GetEnum();
+		Dispatch.Kind = Dispatch.UnderlyingProperty != nullptr ? EAruValueKind::Enum : EAruValueKind::Unsupported;
+	}
+	else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		const UScriptStruct* StructType = StructProperty->Struct;
+		if (StructType == nullptr)
+		{
+			Dispatch.Kind = EAruValueKind::Unsupported;
+		}
+		else if (StructType == FGameplayTag::StaticStruct())
+		{
+			Dispatch.Kind = EAruValueKind::GameplayTag;
+		}
+		else if (StructType == FGameplayTagContainer::StaticStruct())
+		{
+			Dispatch.Kind = EAruValueKind::GameplayTagContainer;
+		}
+		else if (StructType == FInstancedStruct::StaticStruct())
+		{
+			Dispatch.Kind = EAruValueKind::InstancedStruct;
+		}
+		else
+		{
+			Dispatch.Kind = EAruValueKind::Struct;
+			Dispatch.Struct = StructType;
+		}
+	}
+	return Dispatch;
+}
+
+FAruValueDispatch Aru::Dispatch::Find(const FProperty* Property)
+{
+	if (FAruProcessingContext* Context = FAruProcessingContext::Get())
+	{
+		return Context->GetDispatchCache().Find(Property);
+	}
+
+	return Resolve(Property);
+}
+
+int64 Aru::Dispatch::ClampToKind(const EAruValueKind Kind, const int64 Value)
+{
+	switch (Kind)
+	{
+	case EAruValueKind::Int8:	return FMath::Clamp<int64>(Value, MIN_int8, MAX_int8);
+	case EAruValueKind::Int16:	return FMath::Clamp<int64>(Value, MIN_int16, MAX_int16);
+	case EAruValueKind::Int32:	return FMath::Clamp<int64>(Value, MIN_int32, MAX_int32);
+	case EAruValueKind::Byte:	return FMath::Clamp<int64>(Value, 0, MAX_uint8);
+	case EAruValueKind::UInt16:	return FMath::Clamp<int64>(Value, 0, MAX_uint16);
+	case EAruValueKind::UInt32:	return FMath::Clamp<int64>(Value, 0, MAX_uint32);
+	default:					return Value;
+	}
+}
+
+FAruValueDispatch FAruDispatchCache::Find(const FProperty* Property)
+{
+	{
+		FReadScopeLock ReadLock{Lock};
+		if (const FAruValueDispatch* Cached = Entries.Find(Property))
+		{
+			return *Cached;
+		}
+	}
+
+	const FAruValueDispatch Dispatch = Aru::Dispatch::Resolve(Property);
+
+	LLM_SCOPE_BYTAG(Aru_Caches);
+	TRACE_COUNTER_INCREMENT(AruCacheEntries);
+	Aru::Memory::CountInRun(&FAruRunStats::CacheEntries);
+	FWriteScopeLock WriteLock{Lock};
+	Entries.Add(Property, Dispatch);
+	return Dispatch;
+}
@@ -0,0 +1,132 @@
+#include "AruPropertyPath.h"
+#include "AruProcessingContext.h"
+
+namespace Aru::Private
+{
+	struct FPathFrame
+	{
+		FAruPathSegment Segment;
+
+		/** Set for frames that enter an object. */
+		UObject* Object = nullptr;
+	};
+	static thread_local TArray<FPathFrame> PathFrames;
+}
+
+FString FAruPropertyPath::ToString() const
+{
+	TStringBuilder<256> Builder;
+	for (const FAruPathSegment& Segment : Segments)
+	{
+		switch (Segment.Kind)
+		{
+		case EAruPathSegment::Property:
+			if (Builder.Len() > 0)
+			{
+				Builder << TEXT('.');
+			}
+			Builder << Segment.Name;
+			break;
+		case EAruPathSegment::Element:
+			Builder << TEXT('[') << Segment.Index << TEXT(']');
+			break;
+		case EAruPathSegment::MapKey:
+			Builder << TEXT('[') << Segment.Index << TEXT("].Key");
+			break;
+		case EAruPathSegment::MapValue:
+			Builder << TEXT('[') << Segment.Index << TEXT("].Value");
+			break;
+		case EAruPathSegment::Row:
+			Builder << TEXT('(') << Segment.Name << TEXT(')');
+			break;
+		}
+	}
+	return Builder.ToString();
+}
+
+FAruPathScope::FAruPathScope(UObject* InObject)
+{
+	if (IsTracking())
+	{
+		Aru::Private::PathFrames.Add({FAruPathSegment{}, InObject});
+		NumPushed = 1;
+	}
+}
+
+FAruPathScope::FAruPathScope(UObject* InObject, const FAruPropertyPath& InPath)
+{
+	if (IsTracking())
+	{
+		TArray<Aru::Private::FPathFrame>& Frames = Aru::Private::PathFrames;
+		Frames.Add({FAruPathSegment{}, InObject});
+		for (const FAruPathSegment& Segment : InPath.Segments)
+		{
+			Frames.Add({Segment, nullptr});
+		}
+		NumPushed = 1 + InPath.Segments.Num();
+	}
+}
+
+FAruPathScope::FAruPathScope(const EAruPathSegment InKind, const FName InName, const int32 InIndex)
+{
+	if (IsTracking())
+	{
+		Aru::Private::PathFrames.Add({FAruPathSegment{InKind, InName, InIndex}, nullptr});
+		NumPushed = 1;
+	}
+}
+
+FAruPathScope::~FAruPathScope()
+{
+	if (NumPushed > 0)
+	{
+		TArray<Aru::Private::FPathFrame>& Frames = Aru::Private::PathFrames;
+		Frames.SetNum(Frames.Num() - NumPushed, EAllowShrinking::No);
+	}
+}
+
+bool FAruPathScope::IsTracking()
+{
+	const FAruProcessingContext* Context = FAruProcessingContext::Get();
+	return Context != nullptr && Context->ShouldTrackPaths();
+}
+
+UObject* FAruPathScope::GetCurrentObject()
+{
+	const TArray<Aru::Private::FPathFrame>& Frames = Aru::Private::PathFrames;
+	for (int32 Index = Frames.Num() - 1; Index >= 0; --Index)
+	{
+		if (Frames[Index].Object != nullptr)
+		{
+			return Frames[Index].Object;
+		}
+	}
+	return nullptr;
+}
+
+FAruPropertyPath FAruPathScope::GetCurrentPath()
+{
+	const TArray<Aru::Private::FPathFrame>& Frames = Aru::Private::PathFrames;
+	int32 FirstFrame = Frames.Num();
+	while (FirstFrame > 0 && Frames[FirstFrame - 1].Object == nullptr)
+	{
+		--FirstFrame;
+	}
+
+	FAruPropertyPath Path;
+	Path.Segments.Reserve(Frames.Num() - FirstFrame);
+	for (int32 Index = FirstFrame; Index < Frames.Num(); ++Index)
+	{
+		const FAruPathSegment& Segment = Frames[Index].Segment;
+
+		// Elements are visited through the container's inner property, whose name adds nothing to the path.
+		const EAruPathSegment PreviousKind = Index > FirstFrame ? Frames[Index - 1].Segment.Kind : EAruPathSegment::Property;
+		const bool bInnerProperty = Segment.Kind == EAruPathSegment::Property
+			&& (PreviousKind == EAruPathSegment::Element || PreviousKind == EAruPathSegment::MapKey || PreviousKind == EAruPathSegment::MapValue);
+		if (!bInnerProperty)
+		{
+			Path.Segments.Add(Segment);
+		}
+	}
+	return Path;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AruProcessingContext.h"
+
+/**
+ * Result of one batch proxy event over the array being visited, handed out element by element.
+ * The inputs are kept with the results, so an element changed since the call falls back to the scalar event.
+ */
+template <typename PropertyType, typename ValueType, typename ResultType>
+class TAruProxyBatch
+{
+public:
+	using FBatchEvent = TFunctionRef<TArray<ResultType>(const TArray<ValueType>&, const TArray<FAruProxyValueContext>&)>;
+
+	/** Returns the element's batched result, calling the event for the whole array on the first element of a visit. */
+	TOptional<ResultType> Find(const PropertyType* InProperty, const void* InValue, FBatchEvent BatchEvent)
+	{
+		const FAruArrayScope* ArrayScope = FAruArrayScope::Get();
+		const int32 Index = ArrayScope != nullptr ? ArrayScope->IndexOf(InProperty, InValue) : INDEX_NONE;
+		if (Index == INDEX_NONE)
+		{
+			return {};
+		}
+
+		FScopeLock ScopeLock{&Lock};
+		if (ArrayScope->GetSerial() != Serial)
+		{
+			Serial = ArrayScope->GetSerial();
+			FScriptArrayHelper ArrayHelper{ArrayScope->GetArrayProperty(), ArrayScope->GetArrayValue()};
+			const FName PropertyName = ArrayScope->GetArrayProperty()->GetFName();
+
+			TArray<FAruProxyValueContext> Contexts;
+			Inputs.Reset(ArrayHelper.Num());
+			Contexts.Reserve(ArrayHelper.Num());
+			for (int32 ElementIndex = 0; ElementIndex < ArrayHelper.Num(); ++ElementIndex)
+			{
+				Inputs.Add(InProperty->GetPropertyValue(ArrayHelper.GetRawPtr(ElementIndex)));
+				FAruProxyValueContext& Context = Contexts.AddDefaulted_GetRef();
+				Context.PropertyName = PropertyName;
+				Context.Index = ElementIndex;
+			}
+
+			Results = BatchEvent(Inputs, Contexts);
+			if (Results.Num() != Inputs.Num())
+			{
+				Results.Reset();
+			}
+		}
+
+		if (!Results.IsValidIndex(Index) || !IsSameInput(Inputs[Index], InProperty->GetPropertyValue(InValue)))
+		{
+			return {};
+		}
+		return Results[Index];
+	}
+
+private:
+	// Strings and names compare case-insensitively by default, which would hide a case-only edit.
+	static bool IsSameInput(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+	static bool IsSameInput(const FName& A, const FName& B) { return A.IsEqual(B, ENameCase::CaseSensitive); }
+	template <typename T>
+	static bool IsSameInput(const T& A, const T& B) { return A == B; }
+
+	FCriticalSection Lock;
+	uint64 Serial = 0;
+	TArray<ValueType> Inputs;
+	TArray<ResultType> Results;
+};
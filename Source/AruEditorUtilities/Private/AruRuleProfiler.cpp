@@ -0,0 +1,287 @@
+#include "AruRuleProfiler.h"
+#include "AruProcessingContext.h"
+#include "AruRunLog.h"
+#include "SAruProfileReport.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
+
+#define LOCTEXT_NAMESPACE "FAruRuleProfiler"
+
+namespace Aru::Private
+{
+	static std::atomic<uint64> NextProfilerSerial{1};
+
+	/** Counters of the profiler the calling thread last recorded into. The serial tells a new profiler at a reused address apart. */
+	struct FThreadProfilerStats
+	{
+		uint64 Serial = 0;
+		void* Stats = nullptr;
+	};
+	static thread_local FThreadProfilerStats ThreadProfilerStats;
+
+	/** Innermost asset scope of the calling thread. */
+	static thread_local FAruAssetProfileScope* CurrentAssetScope = nullptr;
+
+	static FCriticalSection LastReportLock;
+	static TSharedPtr<const FAruProfileReport> LastReport;
+
+	static FString EscapeCsv(const FString& Value)
+	{
+		if (!Value.Contains(TEXT(",")) && !Value.Contains(TEXT("\"")) && !Value.Contains(TEXT("\n")))
+		{
+			return Value;
+		}
+		return FString::Printf(TEXT("\"%s\""), *Value.Replace(TEXT("\""), TEXT("\"\"")));
+	}
+}
+
+FString FAruProfileReport::LexKind(const EAruRuleKind Kind)
+{
+	switch (Kind)
+	{
+	case EAruRuleKind::Action:
+		return TEXT("Action");
+	case EAruRuleKind::Validation:
+		return TEXT("Validation");
+	case EAruRuleKind::Condition:
+		return TEXT("Condition");
+	default:
+		return TEXT("Predicate");
+	}
+}
+
+FString FAruProfileReport::ToJson() const
+{
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("Timestamp"), Timestamp.ToIso8601());
+
+	Writer->WriteArrayStart(TEXT("Rules"));
+	for (const FAruRuleStats& Stats : Rules)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("Definition"), Stats.Definition);
+		Writer->WriteValue(TEXT("Rule"), Stats.Rule);
+		Writer->WriteValue(TEXT("Kind"), LexKind(Stats.Kind));
+		Writer->WriteValue(TEXT("Evaluations"), Stats.Evaluations);
+		Writer->WriteValue(TEXT("Matches"), Stats.Matches);
+		Writer->WriteValue(TEXT("Writes"), Stats.Writes);
+		Writer->WriteValue(TEXT("Seconds"), Stats.GetSeconds());
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteArrayStart(TEXT("Assets"));
+	for (const FAruAssetStats& Stats : Assets)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("Asset"), Stats.AssetPath);
+		Writer->WriteValue(TEXT("Evaluations"), Stats.Evaluations);
+		Writer->WriteValue(TEXT("Writes"), Stats.Writes);
+		Writer->WriteValue(TEXT("Seconds"), Stats.GetSeconds());
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+	return Json;
+}
+
+FString FAruProfileReport::ToCsv() const
+{
+	using Aru::Private::EscapeCsv;
+
+	FString Csv = TEXT("Definition,Rule,Kind,Evaluations,Matches,Writes,Seconds\n");
+	for (const FAruRuleStats& Stats : Rules)
+	{
+		Csv += FString::Printf(TEXT("%s,%s,%s,%lld,%lld,%lld,%.6f\n"),
+			*EscapeCsv(Stats.Definition), *EscapeCsv(Stats.Rule), *LexKind(Stats.Kind),
+			Stats.Evaluations, Stats.Matches, Stats.Writes, Stats.GetSeconds());
+	}
+
+	Csv += TEXT("\nAsset,Evaluations,Writes,Seconds\n");
+	for (const FAruAssetStats& Stats : Assets)
+	{
+		Csv += FString::Printf(TEXT("%s,%lld,%lld,%.6f\n"),
+			*EscapeCsv(Stats.AssetPath), Stats.Evaluations, Stats.Writes, Stats.GetSeconds());
+	}
+	return Csv;
+}
+
+bool FAruProfileReport::SaveToFiles(const FString& BasePath) const
+{
+	const bool bSavedJson = FFileHelper::SaveStringToFile(ToJson(), *(BasePath + TEXT(".json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	const bool bSavedCsv = FFileHelper::SaveStringToFile(ToCsv(), *(BasePath + TEXT(".csv")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	return bSavedJson && bSavedCsv;
+}
+
+FAruRuleProfiler::FAruRuleProfiler()
+	: Serial(Aru::Private::NextProfilerSerial.fetch_add(1, std::memory_order_relaxed))
+{
+}
+
+FAruRuleProfiler::~FAruRuleProfiler() = default;
+
+FAruRuleProfiler* FAruRuleProfiler::Get()
+{
+	FAruProcessingContext* Context = FAruProcessingContext::Get();
+	return Context != nullptr ? Context->GetRuleProfiler() : nullptr;
+}
+
+FAruRuleProfiler::FThreadStats& FAruRuleProfiler::GetThreadStats()
+{
+	Aru::Private::FThreadProfilerStats& Current = Aru::Private::ThreadProfilerStats;
+	if (Current.Serial != Serial || Current.Stats == nullptr)
+	{
+		FScopeLock ScopeLock{&Lock};
+		Current.Stats = ThreadStats.Add_GetRef(MakeUnique<FThreadStats>()).Get();
+		Current.Serial = Serial;
+	}
+	return *static_cast<FThreadStats*>(Current.Stats);
+}
+
+void FAruRuleProfiler::RecordRule(
+	const void* InRule,
+	const EAruRuleKind InKind,
+	const UScriptStruct* InRuleType,
+	const FString& InDefinition,
+	const bool bMatched,
+	const bool bWrote,
+	const uint64 InCycles)
+{
+	FThreadStats& Stats = GetThreadStats();
+	FAruRuleStats* RuleStats = Stats.Rules.Find(InRule);
+	if (RuleStats == nullptr)
+	{
+		RuleStats = &Stats.Rules.Add(InRule);
+		RuleStats->Definition = InDefinition;
+		RuleStats->Rule = InRuleType != nullptr ? InRuleType->GetDisplayNameText().ToString() : FString{};
+		RuleStats->Kind = InKind;
+	}
+
+	++RuleStats->Evaluations;
+	RuleStats->Matches += bMatched ? 1 : 0;
+	RuleStats->Writes += bWrote ? 1 : 0;
+	RuleStats->Cycles += InCycles;
+
+	// Definitions only wrap their rules, so counting them too would count every evaluation twice.
+	FAruAssetProfileScope* AssetScope = Aru::Private::CurrentAssetScope;
+	if (AssetScope != nullptr && AssetScope->Profiler == this && (InKind == EAruRuleKind::Condition || InKind == EAruRuleKind::Predicate))
+	{
+		++AssetScope->Evaluations;
+		AssetScope->Writes += bWrote ? 1 : 0;
+	}
+}
+
+void FAruRuleProfiler::RecordAsset(const UObject* InAsset, const int64 InEvaluations, const int64 InWrites, const uint64 InCycles)
+{
+	if (InAsset == nullptr)
+	{
+		return;
+	}
+
+	FString AssetPath = InAsset->GetPathName();
+	FScopeLock ScopeLock{&Lock};
+	FAruAssetStats& Stats = AssetStats.FindOrAdd(AssetPath);
+	Stats.AssetPath = MoveTemp(AssetPath);
+	Stats.Evaluations += InEvaluations;
+	Stats.Writes += InWrites;
+	Stats.Cycles += InCycles;
+}
+
+FAruProfileReport FAruRuleProfiler::BuildReport() const
+{
+	FAruProfileReport Report;
+	Report.Timestamp = FDateTime::Now();
+
+	FScopeLock ScopeLock{&Lock};
+	TMap<const void*, FAruRuleStats> MergedRules;
+	for (const TUniquePtr<FThreadStats>& Stats : ThreadStats)
+	{
+		for (const TPair<const void*, FAruRuleStats>& Pair : Stats->Rules)
+		{
+			FAruRuleStats* Merged = MergedRules.Find(Pair.Key);
+			if (Merged == nullptr)
+			{
+				MergedRules.Add(Pair.Key, Pair.Value);
+				continue;
+			}
+			Merged->Evaluations += Pair.Value.Evaluations;
+			Merged->Matches += Pair.Value.Matches;
+			Merged->Writes += Pair.Value.Writes;
+			Merged->Cycles += Pair.Value.Cycles;
+		}
+	}
+
+	MergedRules.GenerateValueArray(Report.Rules);
+	AssetStats.GenerateValueArray(Report.Assets);
+
+	Report.Rules.Sort([](const FAruRuleStats& A, const FAruRuleStats& B) { return A.Cycles > B.Cycles; });
+	Report.Assets.Sort([](const FAruAssetStats& A, const FAruAssetStats& B) { return A.Cycles > B.Cycles; });
+	return Report;
+}
+
+TSharedPtr<const FAruProfileReport> FAruRuleProfiler::GetLastReport()
+{
+	FScopeLock ScopeLock{&Aru::Private::LastReportLock};
+	return Aru::Private::LastReport;
+}
+
+void FAruRuleProfiler::PublishReport(FAruProfileReport&& Report)
+{
+	const TSharedRef<const FAruProfileReport> SharedReport = MakeShared<const FAruProfileReport>(MoveTemp(Report));
+	{
+		FScopeLock ScopeLock{&Aru::Private::LastReportLock};
+		Aru::Private::LastReport = SharedReport;
+	}
+
+	const FString BasePath = FPaths::ProjectSavedDir() / TEXT("AruEditorUtilities") / TEXT("Profiles")
+		/ FString::Printf(TEXT("Run-%s"), *SharedReport->Timestamp.ToString());
+	if (SharedReport->SaveToFiles(BasePath))
+	{
+		ARU_LOG(Info,
+			LOCTEXT("ProfileReportSaved", "Rule profile saved to '{0}.json' and '{0}.csv'."),
+			FPaths::ConvertRelativePathToFull(BasePath));
+	}
+	else
+	{
+		ARU_LOG(Warning,
+			LOCTEXT("ProfileReportNotSaved", "Failed to save the rule profile to '{0}'."),
+			FPaths::ConvertRelativePathToFull(BasePath));
+	}
+
+	if (IsInGameThread() && FSlateApplication::IsInitialized() && !IsRunningCommandlet())
+	{
+		SAruProfileReport::OpenWindow(SharedReport);
+	}
+}
+
+FAruAssetProfileScope::FAruAssetProfileScope(const UObject* InAsset, const bool bInTimed)
+	: Profiler(FAruRuleProfiler::Get())
+	, Asset(InAsset)
+	, bTimed(bInTimed)
+{
+	if (Profiler != nullptr)
+	{
+		Outer = Exchange(Aru::Private::CurrentAssetScope, this);
+		StartCycles = bTimed ? FPlatformTime::Cycles64() : 0;
+	}
+}
+
+FAruAssetProfileScope::~FAruAssetProfileScope()
+{
+	if (Profiler == nullptr)
+	{
+		return;
+	}
+
+	Aru::Private::CurrentAssetScope = Outer;
+	const uint64 Cycles = bTimed ? FPlatformTime::Cycles64() - StartCycles : 0;
+	Profiler->RecordAsset(Asset, Evaluations, Writes, Cycles);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,134 @@
+#include "AruRunJournal.h"
+#include "AruChangeSet.h"
+#include "AruRunLog.h"
+#include "AruRunMemory.h"
+#include "AruTrace.h"
+#include "Engine/DataTable.h"
+
+#define LOCTEXT_NAMESPACE "FAruRunJournal"
+
+namespace Aru::Private
+{
+	static FCriticalSection JournalHistoryLock;
+	static TArray<TSharedRef<const FAruRunJournal>> JournalHistory;
+}
+
+bool FAruRunJournal::Record(const FProperty* InProperty, const void* InOldValue, const void* InNewValue)
+{
+	if (InProperty == nullptr || InOldValue == nullptr || InNewValue == nullptr || InProperty->Identical(InOldValue, InNewValue, PPF_None))
+	{
+		return false;
+	}
+
+	UObject* Object = FAruPathScope::GetCurrentObject();
+	if (Object == nullptr)
+	{
+		return false;
+	}
+
+	LLM_SCOPE_BYTAG(Aru_Journal);
+	FAruJournalEntry Entry;
+	Entry.Path = FAruCompiledPath::Compile(Object, FAruPathScope::GetCurrentPath());
+	if (!Entry.Path.IsValid())
+	{
+		return false;
+	}
+	Aru::Values::Serialize(InProperty, InOldValue, Entry.OldValue);
+
+	FScopeLock ScopeLock{&Lock};
+	if (const int32* Found = ObjectIndices.Find(Object))
+	{
+		Entry.ObjectIndex = *Found;
+	}
+	else
+	{
+		Entry.ObjectIndex = Objects.Add(Object);
+		ObjectPaths.Add(FSoftObjectPath{Object});
+		ObjectIndices.Add(Object, Entry.ObjectIndex);
+	}
+	NumValueBytes += Entry.OldValue.Num();
+	Entries.Add(MoveTemp(Entry));
+	return true;
+}
+
+int32 FAruRunJournal::Rollback() const
+{
+	check(IsInGameThread());
+	ARU_TRACE_SCOPE("Aru::Rollback");
+
+	// Objects unloaded since the run are loaded again, and their paths recompiled against the new instance.
+	TArray<UObject*> ResolvedObjects;
+	TBitArray<> Reloaded{false, Objects.Num()};
+	ResolvedObjects.Reserve(Objects.Num());
+	for (int32 Index = 0; Index < Objects.Num(); ++Index)
+	{
+		UObject* Object = Objects[Index].Get();
+		if (Object == nullptr)
+		{
+			Object = ObjectPaths[Index].TryLoad();
+			Reloaded[Index] = true;
+		}
+		ResolvedObjects.Add(Object);
+	}
+
+	int32 NumRestored = 0;
+	int32 NumUnresolved = 0;
+	TSet<UObject*> RestoredObjects;
+	for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		const FAruJournalEntry& Entry = Entries[Index];
+		UObject* Object = ResolvedObjects[Entry.ObjectIndex];
+		const FAruResolvedValue Target = Reloaded[Entry.ObjectIndex]
+			? FAruCompiledPath::Compile(Object, Entry.Path.ToPropertyPath()).Resolve(Object)
+			: Entry.Path.Resolve(Object);
+
+		const FAruScopedScratchValue OldValue{Target.Property};
+		if (!Target.IsValid() || !OldValue.IsValid() || !Aru::Values::Deserialize(Target.Property, OldValue.Get(), Entry.OldValue))
+		{
+			++NumUnresolved;
+			continue;
+		}
+
+		Target.Property->CopyCompleteValue(Target.Value, OldValue.Get());
+		RestoredObjects.Add(Object);
+		++NumRestored;
+	}
+
+	for (UObject* Object : RestoredObjects)
+	{
+		Object->MarkPackageDirty();
+		if (UDataTable* DataTable = Cast<UDataTable>(Object))
+		{
+			DataTable->HandleDataTableChanged();
+		}
+	}
+
+	ARU_LOG(Info,
+		LOCTEXT("Journal_RolledBack", "[Journal] Restored {0} values in {1} objects. {2} values could not be found anymore."),
+		NumRestored,
+		RestoredObjects.Num(),
+		NumUnresolved);
+	return NumRestored;
+}
+
+void FAruRunJournal::PushHistory(const TSharedRef<const FAruRunJournal>& InJournal)
+{
+	FScopeLock ScopeLock{&Aru::Private::JournalHistoryLock};
+	Aru::Private::JournalHistory.Add(InJournal);
+	if (Aru::Private::JournalHistory.Num() > MaxHistory)
+	{
+		Aru::Private::JournalHistory.RemoveAt(0);
+	}
+}
+
+TSharedPtr<const FAruRunJournal> FAruRunJournal::PopHistory()
+{
+	FScopeLock ScopeLock{&Aru::Private::JournalHistoryLock};
+	if (Aru::Private::JournalHistory.IsEmpty())
+	{
+		return nullptr;
+	}
+	return Aru::Private::JournalHistory.Pop();
+}
+
+#undef LOCTEXT_NAMESPACE
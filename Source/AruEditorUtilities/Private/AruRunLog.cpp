@@ -0,0 +1,207 @@
+#include "AruRunLog.h"
+#include "AruProcessingContext.h"
+#include "AruTrace.h"
+#include "Logging/MessageLog.h"
+
+#define LOCTEXT_NAMESPACE "FAruRunLog"
+
+namespace Aru::Private
+{
+	static std::atomic<uint64> NextRunLogSerial{1};
+
+	/** Buffer of the run log the calling thread last wrote to. The serial tells a new log at a reused address apart. */
+	struct FThreadLogBuffer
+	{
+		uint64 Serial = 0;
+		FAruLogRingBuffer* Buffer = nullptr;
+	};
+	static thread_local FThreadLogBuffer ThreadLogBuffer;
+
+	static FFormatArgumentValue ToFormatArgument(const FAruLogArg& Arg)
+	{
+		if (const int64* Int = Arg.TryGet<int64>())
+		{
+			return FFormatArgumentValue{*Int};
+		}
+		if (const double* Double = Arg.TryGet<double>())
+		{
+			return FFormatArgumentValue{*Double};
+		}
+		if (const FName* Name = Arg.TryGet<FName>())
+		{
+			return FFormatArgumentValue{FText::FromName(*Name)};
+		}
+		if (const FString* String = Arg.TryGet<FString>())
+		{
+			return FFormatArgumentValue{FText::FromString(*String)};
+		}
+		return FFormatArgumentValue{Arg.Get<FText>()};
+	}
+}
+
+FAruLogRingBuffer::FAruLogRingBuffer(const int32 InCapacity)
+	: Capacity(FMath::Max(InCapacity, 1))
+{
+}
+
+void FAruLogRingBuffer::Push(FAruLogRecord&& Record)
+{
+	if (Record.Event->Severity != EAruLogSeverity::Info)
+	{
+		Problems.Add(MoveTemp(Record));
+		return;
+	}
+
+	// Storage grows on demand up to the capacity, so short runs never pay for a full buffer.
+	if (Records.Num() < Capacity)
+	{
+		Records.Add(MoveTemp(Record));
+		return;
+	}
+
+	Records[Head] = MoveTemp(Record);
+	Head = (Head + 1) % Capacity;
+	++NumDropped;
+}
+
+int64 FAruLogRingBuffer::Drain(TArray<FAruLogRecord>& OutRecords)
+{
+	OutRecords.Reserve(OutRecords.Num() + Problems.Num() + Records.Num());
+	OutRecords.Append(MoveTemp(Problems));
+	Problems.Reset();
+	for (int32 Offset = 0; Offset < Records.Num(); ++Offset)
+	{
+		OutRecords.Add(MoveTemp(Records[(Head + Offset) % Records.Num()]));
+	}
+	Records.Reset();
+	Head = 0;
+	return Exchange(NumDropped, 0);
+}
+
+FAruRunLog::FAruRunLog(const EAruLogVerbosity InVerbosity, const int32 InBufferCapacity)
+	: Verbosity(InVerbosity)
+	, BufferCapacity(FMath::Max(InBufferCapacity, 1))
+	, Serial(Aru::Private::NextRunLogSerial.fetch_add(1, std::memory_order_relaxed))
+{
+}
+
+FAruRunLog::~FAruRunLog()
+{
+	Flush();
+}
+
+bool FAruRunLog::IsEnabled(const EAruLogSeverity Severity) const
+{
+	switch (Severity)
+	{
+	case EAruLogSeverity::Error:
+		return true;
+	case EAruLogSeverity::Warning:
+		return Verbosity != EAruLogVerbosity::Errors;
+	default:
+		return Verbosity == EAruLogVerbosity::All;
+	}
+}
+
+FAruLogRingBuffer& FAruRunLog::GetThreadBuffer()
+{
+	Aru::Private::FThreadLogBuffer& ThreadBuffer = Aru::Private::ThreadLogBuffer;
+	if (ThreadBuffer.Serial != Serial || ThreadBuffer.Buffer == nullptr)
+	{
+		FScopeLock ScopeLock{&Lock};
+		ThreadBuffer.Buffer = Buffers.Add_GetRef(MakeUnique<FAruLogRingBuffer>(BufferCapacity)).Get();
+		ThreadBuffer.Serial = Serial;
+	}
+	return *ThreadBuffer.Buffer;
+}
+
+void FAruRunLog::Write(const FAruLogEvent& Event, TArray<FAruLogArg, TInlineAllocator<6>>&& Args)
+{
+	LLM_SCOPE_BYTAG(Aru_RunLog);
+	FAruLogRecord Record;
+	Record.Event = &Event;
+	Record.Sequence = NextSequence.fetch_add(1, std::memory_order_relaxed);
+	Record.Args = MoveTemp(Args);
+	GetThreadBuffer().Push(MoveTemp(Record));
+}
+
+void FAruRunLog::Flush()
+{
+	LLM_SCOPE_BYTAG(Aru_RunLog);
+	TArray<FAruLogRecord> Records;
+	int64 NumDropped = 0;
+	{
+		FScopeLock ScopeLock{&Lock};
+		for (const TUniquePtr<FAruLogRingBuffer>& Buffer : Buffers)
+		{
+			NumDropped += Buffer->Drain(Records);
+		}
+	}
+
+	if (Records.IsEmpty() && NumDropped == 0)
+	{
+		return;
+	}
+
+	Records.Sort([](const FAruLogRecord& A, const FAruLogRecord& B) { return A.Sequence < B.Sequence; });
+
+	if (NumDropped > 0)
+	{
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(FText::Format(
+			LOCTEXT("Dropped run log records", "{0} older info messages were dropped because the run log buffer was full. Raise LogBufferCapacity to keep them."),
+			FText::AsNumber(NumDropped)));
+	}
+
+	for (const FAruLogRecord& Record : Records)
+	{
+		Emit(*Record.Event, Record.Args);
+	}
+}
+
+void FAruRunLog::Emit(const FAruLogEvent& Event, TConstArrayView<FAruLogArg> Args)
+{
+	FFormatOrderedArguments FormatArguments;
+	FormatArguments.Reserve(Args.Num());
+	for (const FAruLogArg& Arg : Args)
+	{
+		FormatArguments.Add(Aru::Private::ToFormatArgument(Arg));
+	}
+
+	const FText Message = FText::Format(Event.Format, MoveTemp(FormatArguments));
+	FMessageLog MessageLog{FName{"AruEditorUtilitiesModule"}};
+	switch (Event.Severity)
+	{
+	case EAruLogSeverity::Error:
+		MessageLog.Error(Message);
+		break;
+	case EAruLogSeverity::Warning:
+		MessageLog.Warning(Message);
+		break;
+	default:
+		MessageLog.Info(Message);
+		break;
+	}
+}
+
+bool Aru::Log::IsEnabled(const FAruLogEvent& Event)
+{
+	if (FAruProcessingContext* Context = FAruProcessingContext::Get())
+	{
+		return Context->GetRunLog().IsEnabled(Event.Severity);
+	}
+	return true;
+}
+
+void Aru::Log::WriteArgs(const FAruLogEvent& Event, TArray<FAruLogArg, TInlineAllocator<6>>&& Args)
+{
+	TRACE_COUNTER_INCREMENT(AruLogRecords);
+	if (FAruProcessingContext* Context = FAruProcessingContext::Get())
+	{
+		Context->GetRunStats().LogRecords.fetch_add(1, std::memory_order_relaxed);
+		Context->GetRunLog().Write(Event, MoveTemp(Args));
+		return;
+	}
+	FAruRunLog::Emit(Event, Args);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,174 @@
+#include "AruRunMemory.h"
+#include "AruProcessingContext.h"
+#include "AruRunLog.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+
+#define LOCTEXT_NAMESPACE "FAruRunMemory"
+
+LLM_DEFINE_TAG(Aru);
+LLM_DEFINE_TAG(Aru_Traversal, NAME_None, TEXT("Aru"));
+LLM_DEFINE_TAG(Aru_Scratch, NAME_None, TEXT("Aru"));
+LLM_DEFINE_TAG(Aru_RunLog, NAME_None, TEXT("Aru"));
+LLM_DEFINE_TAG(Aru_Caches, NAME_None, TEXT("Aru"));
+LLM_DEFINE_TAG(Aru_Proxies, NAME_None, TEXT("Aru"));
+LLM_DEFINE_TAG(Aru_Assets, NAME_None, TEXT("Aru"));
+LLM_DEFINE_TAG(Aru_Journal, NAME_None, TEXT("Aru"));
+
+void Aru::Memory::CountInRun(std::atomic<int64> FAruRunStats::* Counter, const int64 Amount)
+{
+	if (FAruProcessingContext* Context = FAruProcessingContext::Get())
+	{
+		(Context->GetRunStats().*Counter).fetch_add(Amount, std::memory_order_relaxed);
+	}
+}
+
+const TCHAR* LexToString(const EAruRunPhase Phase)
+{
+	switch (Phase)
+	{
+	case EAruRunPhase::Collect:	return TEXT("Collect");
+	case EAruRunPhase::Load:	return TEXT("Load");
+	case EAruRunPhase::Process:	return TEXT("Process");
+	case EAruRunPhase::Report:	return TEXT("Report");
+	default:					return TEXT("Unknown");
+	}
+}
+
+FAruRunMemory::FAruRunMemory(const FAruRunStats& InStats)
+	: Stats(InStats)
+{
+}
+
+FAruRunMemory::FCounters FAruRunMemory::ReadCounters() const
+{
+	FCounters Counters;
+	Counters.ScratchAllocations = Stats.ScratchAllocations.load(std::memory_order_relaxed);
+	Counters.LogRecords = Stats.LogRecords.load(std::memory_order_relaxed);
+	Counters.CacheEntries = Stats.CacheEntries.load(std::memory_order_relaxed);
+	Counters.ProxyInstances = Stats.ProxyInstances.load(std::memory_order_relaxed);
+	return Counters;
+}
+
+bool FAruRunMemory::BeginPhase(const EAruRunPhase Phase)
+{
+	const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+
+	FScopeLock ScopeLock{&Lock};
+	if (ActivePhase.IsSet())
+	{
+		return false;
+	}
+
+	ActivePhase = Phase;
+	PhaseStartTime = FPlatformTime::Seconds();
+	PhaseStartUsedPhysical = UsedPhysical;
+	PhaseStartCounters = ReadCounters();
+	++Phases[static_cast<int32>(Phase)].NumEntries;
+	SampleLocked(UsedPhysical);
+	return true;
+}
+
+void FAruRunMemory::EndPhase(const EAruRunPhase Phase)
+{
+	const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+
+	FScopeLock ScopeLock{&Lock};
+	if (!ActivePhase.IsSet() || ActivePhase.GetValue() != Phase)
+	{
+		return;
+	}
+
+	SampleLocked(UsedPhysical);
+
+	FAruPhaseMemory& Memory = Phases[static_cast<int32>(Phase)];
+	const FCounters Counters = ReadCounters();
+	Memory.Seconds += FPlatformTime::Seconds() - PhaseStartTime;
+	Memory.UsedPhysicalDelta += static_cast<int64>(UsedPhysical) - static_cast<int64>(PhaseStartUsedPhysical);
+	Memory.ScratchAllocations += Counters.ScratchAllocations - PhaseStartCounters.ScratchAllocations;
+	Memory.LogRecords += Counters.LogRecords - PhaseStartCounters.LogRecords;
+	Memory.CacheEntries += Counters.CacheEntries - PhaseStartCounters.CacheEntries;
+	Memory.ProxyInstances += Counters.ProxyInstances - PhaseStartCounters.ProxyInstances;
+	ActivePhase.Reset();
+}
+
+void FAruRunMemory::Sample()
+{
+	const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+
+	FScopeLock ScopeLock{&Lock};
+	SampleLocked(UsedPhysical);
+}
+
+void FAruRunMemory::SampleLocked(const uint64 UsedPhysical)
+{
+	if (!ActivePhase.IsSet())
+	{
+		return;
+	}
+
+	FAruPhaseMemory& Memory = Phases[static_cast<int32>(ActivePhase.GetValue())];
+	Memory.PeakUsedPhysical = FMath::Max(Memory.PeakUsedPhysical, UsedPhysical);
+	Memory.SumUsedPhysical += UsedPhysical;
+	++Memory.NumSamples;
+}
+
+uint64 FAruRunMemory::GetPeakUsedPhysical() const
+{
+	FScopeLock ScopeLock{&Lock};
+	uint64 PeakUsedPhysical = 0;
+	for (const FAruPhaseMemory& Memory : Phases)
+	{
+		PeakUsedPhysical = FMath::Max(PeakUsedPhysical, Memory.PeakUsedPhysical);
+	}
+	return PeakUsedPhysical;
+}
+
+void FAruRunMemory::Report() const
+{
+	FScopeLock ScopeLock{&Lock};
+	for (int32 Index = 0; Index < static_cast<int32>(EAruRunPhase::Num); ++Index)
+	{
+		const FAruPhaseMemory& Memory = Phases[Index];
+		if (Memory.NumEntries == 0)
+		{
+			continue;
+		}
+
+		constexpr double MiB = 1024.0 * 1024.0;
+		ARU_LOG(Info,
+			LOCTEXT("RunMemory_Phase", "[RunMemory][{0}] {1}s, used {2} MiB on average and {3} MiB at peak, {4} MiB retained. {5} scratch allocations, {6} log records, {7} cache entries, {8} proxy instances."),
+			LexToString(static_cast<EAruRunPhase>(Index)),
+			Memory.Seconds,
+			Memory.GetAverageUsedPhysical() / MiB,
+			Memory.PeakUsedPhysical / MiB,
+			Memory.UsedPhysicalDelta / MiB,
+			Memory.ScratchAllocations,
+			Memory.LogRecords,
+			Memory.CacheEntries,
+			Memory.ProxyInstances);
+	}
+}
+
+FAruRunPhaseScope::FAruRunPhaseScope(const EAruRunPhase InPhase)
+	: Phase(InPhase)
+{
+	if (FAruProcessingContext* Context = FAruProcessingContext::Get())
+	{
+		FAruRunMemory* Memory = Context->GetRunMemory();
+		if (Memory != nullptr && Memory->BeginPhase(Phase))
+		{
+			RunMemory = Memory;
+		}
+	}
+}
+
+FAruRunPhaseScope::~FAruRunPhaseScope()
+{
+	if (RunMemory != nullptr)
+	{
+		RunMemory->EndPhase(Phase);
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
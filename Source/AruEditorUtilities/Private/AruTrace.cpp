@@ -0,0 +1,12 @@
+#include "AruTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(AruChannel)
+
+TRACE_DECLARE_ATOMIC_INT_COUNTER(AruPropertiesVisited, TEXT("Aru/PropertiesVisited"));
+TRACE_DECLARE_ATOMIC_INT_COUNTER(AruFiltersEvaluated, TEXT("Aru/FiltersEvaluated"));
+TRACE_DECLARE_ATOMIC_INT_COUNTER(AruPredicatesExecuted, TEXT("Aru/PredicatesExecuted"));
+TRACE_DECLARE_ATOMIC_INT_COUNTER(AruScratchAllocations, TEXT("Aru/ScratchAllocations"));
+TRACE_DECLARE_ATOMIC_INT_COUNTER(AruAssetsLoaded, TEXT("Aru/AssetsLoaded"));
+TRACE_DECLARE_ATOMIC_INT_COUNTER(AruLogRecords, TEXT("Aru/LogRecords"));
+TRACE_DECLARE_ATOMIC_INT_COUNTER(AruCacheEntries, TEXT("Aru/CacheEntries"));
+TRACE_DECLARE_ATOMIC_INT_COUNTER(AruProxyInstances, TEXT("Aru/ProxyInstances"));
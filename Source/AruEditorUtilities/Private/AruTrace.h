@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/** Insights channel of the processing pipeline. Enable with -trace=cpu,counters,AruChannel. */
+UE_TRACE_CHANNEL_EXTERN(AruChannel)
+
+/** Named CPU scope on the plugin's channel, free when the channel is off. */
+#define ARU_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, AruChannel)
+
+/** CPU scope named after a runtime string, such as an asset or a rule type. The name is only built when the channel is on. */
+#define ARU_TRACE_SCOPE_TEXT(Name) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(UE_TRACE_CHANNELEXPR_IS_ENABLED(AruChannel) ? (Name) : TEXT(""), AruChannel)
+
+TRACE_DECLARE_ATOMIC_INT_COUNTER_EXTERN(AruPropertiesVisited);
+TRACE_DECLARE_ATOMIC_INT_COUNTER_EXTERN(AruFiltersEvaluated);
+TRACE_DECLARE_ATOMIC_INT_COUNTER_EXTERN(AruPredicatesExecuted);
+TRACE_DECLARE_ATOMIC_INT_COUNTER_EXTERN(AruScratchAllocations);
+TRACE_DECLARE_ATOMIC_INT_COUNTER_EXTERN(AruAssetsLoaded);
+TRACE_DECLARE_ATOMIC_INT_COUNTER_EXTERN(AruLogRecords);
+TRACE_DECLARE_ATOMIC_INT_COUNTER_EXTERN(AruCacheEntries);
+TRACE_DECLARE_ATOMIC_INT_COUNTER_EXTERN(AruProxyInstances);
@@ -1,27 +1,65 @@
 #include "AruTypes.h"
+#include "AruChangeSet.h"
+#include "AruRuleProfiler.h"
+#include "AruTrace.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruTypes)
 
-bool FAruActionDefinition::Invoke(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const
+bool FAruActionDefinition::Invoke(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters, FAruShadowValue* InShadow) const
 {
 	if (InProperty == nullptr || InValue == nullptr)
 	{
 		return false;
 	}
 
-	for (auto& Condition : ForEachCondition())
+	ARU_TRACE_SCOPE_TEXT(*Description);
+	FAruRuleProfiler* Profiler = FAruRuleProfiler::Get();
+	FAruRuleProfileScope ActionScope{Profiler, this, EAruRuleKind::Action, StaticStruct(), Description};
+
+	const void* ConditionValue = InShadow != nullptr ? InShadow->Read() : InValue;
+	for (const TInstancedStruct<FAruFilter>& Condition : ActionConditions)
 	{
-		if (!Condition.IsConditionMet(InProperty, InValue, InParameters))
+		ARU_TRACE_SCOPE_TEXT(*Condition.GetScriptStruct()->GetName());
+		TRACE_COUNTER_INCREMENT(AruFiltersEvaluated);
+		FAruRuleProfileScope ConditionScope{Profiler, Condition.GetPtr<const FAruFilter>(), EAruRuleKind::Condition, Condition.GetScriptStruct(), Description};
+		if (!ConditionScope.Matched(Condition.Get<const FAruFilter>().IsConditionMet(InProperty, ConditionValue, InParameters)))
 		{
 			return false;
 		}
 	}
+	ActionScope.Matched(true);
+
+	void* TargetValue = InShadow != nullptr ? InShadow->Write() : InValue;
+	if (TargetValue == nullptr)
+	{
+		return false;
+	}
 
 	bool bExecutedSuccessfully = false;
+	for (const TInstancedStruct<FAruPredicate>& Predicate : ActionPredicates)
+	{
+		ARU_TRACE_SCOPE_TEXT(*Predicate.GetScriptStruct()->GetName());
+		TRACE_COUNTER_INCREMENT(AruPredicatesExecuted);
+		FAruRuleProfileScope PredicateScope{Profiler, Predicate.GetPtr<const FAruPredicate>(), EAruRuleKind::Predicate, Predicate.GetScriptStruct(), Description};
+		bExecutedSuccessfully |= PredicateScope.Wrote(Predicate.Get<const FAruPredicate>().Execute(InProperty, TargetValue, InParameters));
+	}
+	return ActionScope.Wrote(bExecutedSuccessfully);
+}
+
+void FAruActionDefinition::GatherPreloads(
+	const FProperty* InProperty,
+	const void* InValue,
+	const FInstancedPropertyBag& InParameters,
+	TArray<FSoftObjectPath>& OutPaths) const
+{
+	if (InProperty == nullptr || InValue == nullptr)
+	{
+		return;
+	}
+
 	for (auto& Predicate : ForEachPredicates())
 	{
-		bExecutedSuccessfully |= Predicate.Execute(InProperty, InValue, InParameters);
+		Predicate.GatherPreloads(InProperty, InValue, InParameters, OutPaths);
 	}
-	return bExecutedSuccessfully;
 }
 
 bool FAruValidationDefinition::Validate(
@@ -34,13 +72,20 @@ bool FAruValidationDefinition::Validate(
 		return false;
 	}
 
-	for (auto& Condition : ForEachCondition())
+	ARU_TRACE_SCOPE_TEXT(*Description);
+	FAruRuleProfiler* Profiler = FAruRuleProfiler::Get();
+	FAruRuleProfileScope ValidationScope{Profiler, this, EAruRuleKind::Validation, StaticStruct(), Description};
+
+	for (const TInstancedStruct<FAruFilter>& Condition : ValidationConditions)
 	{
-		if (!Condition.IsConditionMet(InProperty, InValue, InParameters))
+		ARU_TRACE_SCOPE_TEXT(*Condition.GetScriptStruct()->GetName());
+		TRACE_COUNTER_INCREMENT(AruFiltersEvaluated);
+		FAruRuleProfileScope ConditionScope{Profiler, Condition.GetPtr<const FAruFilter>(), EAruRuleKind::Condition, Condition.GetScriptStruct(), Description};
+		if (!ConditionScope.Matched(Condition.Get<const FAruFilter>().IsConditionMet(InProperty, InValue, InParameters)))
 		{
 			return false;
 		}
 	}
 
-	return true;
+	return ValidationScope.Matched(true);
 }
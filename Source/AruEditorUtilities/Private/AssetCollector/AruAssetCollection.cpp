@@ -0,0 +1,214 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetCollector/AruAssetCollection.h"
+#include "AruProcessingContext.h"
+#include "UObject/UObjectGlobals.h"
+
+void FAruTagMask::SetBit(const int32 Index)
+{
+	check(Index >= 0);
+	const int32 WordIndex = Index / 64;
+	if (WordIndex >= Words.Num())
+	{
+		Words.SetNumZeroed(WordIndex + 1);
+	}
+	Words[WordIndex] |= uint64{1} << (Index % 64);
+}
+
+bool FAruTagMask::HasBit(const int32 Index) const
+{
+	const int32 WordIndex = Index / 64;
+	return Index >= 0 && WordIndex < Words.Num() && (Words[WordIndex] & (uint64{1} << (Index % 64))) != 0;
+}
+
+bool FAruTagMask::ContainsAll(const FAruTagMask& Other) const
+{
+	if (Other.Words.Num() > Words.Num())
+	{
+		return false;
+	}
+
+	for (int32 WordIndex = 0; WordIndex < Other.Words.Num(); ++WordIndex)
+	{
+		if ((Words[WordIndex] & Other.Words[WordIndex]) != Other.Words[WordIndex])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int32 FAruTagDictionary::FindOrAdd(const FName Tag)
+{
+	if (const int32* Found = TagToIndex.Find(Tag))
+	{
+		return *Found;
+	}
+
+	const int32 Index = Tags.Add(Tag);
+	TagToIndex.Add(Tag, Index);
+	return Index;
+}
+
+int32 FAruTagDictionary::Find(const FName Tag) const
+{
+	const int32* Found = TagToIndex.Find(Tag);
+	return Found != nullptr ? *Found : INDEX_NONE;
+}
+
+FAruTagMask FAruTagDictionary::MakeMask(TConstArrayView<FName> InTags)
+{
+	FAruTagMask Mask;
+	for (const FName Tag : InTags)
+	{
+		Mask.SetBit(FindOrAdd(Tag));
+	}
+	return Mask;
+}
+
+bool FAruTagDictionary::TryMakeMask(TConstArrayView<FName> InTags, FAruTagMask& OutMask) const
+{
+	OutMask = FAruTagMask{};
+	for (const FName Tag : InTags)
+	{
+		const int32 Index = Find(Tag);
+		if (Index == INDEX_NONE)
+		{
+			return false;
+		}
+		OutMask.SetBit(Index);
+	}
+	return true;
+}
+
+TArray<FName> FAruTagDictionary::GetTags(const FAruTagMask& Mask) const
+{
+	TArray<FName> Result;
+	for (int32 Index = 0; Index < Tags.Num(); ++Index)
+	{
+		if (Mask.HasBit(Index))
+		{
+			Result.Add(Tags[Index]);
+		}
+	}
+	return Result;
+}
+
+int32 FAruAssetCollection::Add(UObject* Object, TConstArrayView<FName> InTags)
+{
+	if (Object == nullptr)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Index = AddEntry(FSoftObjectPath{Object}, Object, Object->GetFName());
+	AddTags(Index, InTags);
+	return Index;
+}
+
+int32 FAruAssetCollection::Add(const FSoftObjectPath& Path, const FName Name, TConstArrayView<FName> InTags)
+{
+	if (Path.IsNull())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Index = AddEntry(Path, nullptr, Name);
+	AddTags(Index, InTags);
+	return Index;
+}
+
+int32 FAruAssetCollection::AddEntry(const FSoftObjectPath& Path, UObject* Object, const FName Name)
+{
+	// Only assets can be loaded back from their path once collected.
+	UObject* PinnedObject = Object != nullptr && !Object->IsAsset() ? Object : nullptr;
+	if (const int32* Found = PathToIndex.Find(Path))
+	{
+		if (Object != nullptr)
+		{
+			Objects[*Found] = Object;
+			PinnedObjects[*Found] = PinnedObject;
+		}
+		return *Found;
+	}
+
+	const int32 Index = Paths.Add(Path);
+	Names.Add(Name);
+	TagMasks.AddDefaulted();
+	Objects.Add(Object);
+	PinnedObjects.Add(PinnedObject);
+	PathToIndex.Add(Path, Index);
+	return Index;
+}
+
+int32 FAruAssetCollection::Find(const FSoftObjectPath& Path) const
+{
+	const int32* Found = PathToIndex.Find(Path);
+	return Found != nullptr ? *Found : INDEX_NONE;
+}
+
+void FAruAssetCollection::AddTags(const int32 Index, TConstArrayView<FName> InTags)
+{
+	if (!TagMasks.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	for (const FName Tag : InTags)
+	{
+		TagMasks[Index].SetBit(TagDictionary.FindOrAdd(Tag));
+	}
+}
+
+bool FAruAssetCollection::Remove(const FSoftObjectPath& Path)
+{
+	int32 Index = INDEX_NONE;
+	if (!PathToIndex.RemoveAndCopyValue(Path, Index))
+	{
+		return false;
+	}
+
+	Paths.RemoveAtSwap(Index, EAllowShrinking::No);
+	Names.RemoveAtSwap(Index, EAllowShrinking::No);
+	TagMasks.RemoveAtSwap(Index, EAllowShrinking::No);
+	Objects.RemoveAtSwap(Index, EAllowShrinking::No);
+	PinnedObjects.RemoveAtSwap(Index, EAllowShrinking::No);
+	if (Paths.IsValidIndex(Index))
+	{
+		PathToIndex[Paths[Index]] = Index;
+	}
+	return true;
+}
+
+void FAruAssetCollection::Reset()
+{
+	Paths.Reset();
+	Names.Reset();
+	TagMasks.Reset();
+	Objects.Reset();
+	PinnedObjects.Reset();
+	PathToIndex.Reset();
+	TagDictionary = FAruTagDictionary{};
+}
+
+UObject* FAruAssetCollection::ResolveObject(const int32 Index) const
+{
+	if (!Objects.IsValidIndex(Index))
+	{
+		return nullptr;
+	}
+
+	if (UObject* Object = Objects[Index].Get())
+	{
+		return Object;
+	}
+
+	UObject* Object = FAruAssetCache::LoadAsset(Paths[Index]);
+	Objects[Index] = Object;
+	return Object;
+}
+
+void FAruAssetCollection::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(PinnedObjects);
+}
@@ -12,10 +12,15 @@ UAruAssetCollector::UAruAssetCollector()
 
 UAruAssetCollector::~UAruAssetCollector()
 {
-	// Ensure proper cleanup of asset objects when this collector is destroyed
 	ClearAssets();
 }
 
+void UAruAssetCollector::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	Super::AddReferencedObjects(InThis, Collector);
+	CastChecked<UAruAssetCollector>(InThis)->Collection.AddReferencedObjects(Collector);
+}
+
 void UAruAssetCollector::Collect_Implementation()
 {
 	// Base implementation does nothing
@@ -25,6 +30,7 @@ void UAruAssetCollector::Collect_Implementation()
 TArray<UAruAssetObject*> UAruAssetCollector::Get() const
 {
 	TArray<UAruAssetObject*> Result;
+	Result.Reserve(AruAssetObjects.Num());
 	for (TObjectPtr<UAruAssetObject> AruAssetObject : AruAssetObjects)
 	{
 		Result.Add(AruAssetObject.Get());
@@ -32,17 +38,111 @@ TArray<UAruAssetObject*> UAruAssetCollector::Get() const
 	return Result;
 }
 
+TArray<UObject*> UAruAssetCollector::GetAssets() const
+{
+	TArray<UObject*> Result;
+	Result.Reserve(Collection.Num());
+	for (int32 Index = 0; Index < Collection.Num(); ++Index)
+	{
+		if (UObject* Object = Collection.ResolveObject(Index))
+		{
+			Result.Add(Object);
+		}
+	}
+	return Result;
+}
+
+TArray<UObject*> UAruAssetCollector::GetAssetsWithTags(const TArray<FName>& Tags) const
+{
+	TArray<UObject*> Result;
+
+	// A tag nobody carries matches nothing.
+	FAruTagMask RequiredMask;
+	if (!Collection.GetTagDictionary().TryMakeMask(Tags, RequiredMask))
+	{
+		return Result;
+	}
+
+	const TConstArrayView<FAruTagMask> TagMasks = Collection.GetTagMasks();
+	for (int32 Index = 0; Index < TagMasks.Num(); ++Index)
+	{
+		if (!TagMasks[Index].ContainsAll(RequiredMask))
+		{
+			continue;
+		}
+
+		if (UObject* Object = Collection.ResolveObject(Index))
+		{
+			Result.Add(Object);
+		}
+	}
+	return Result;
+}
+
+int32 UAruAssetCollector::GetNumAssets() const
+{
+	return Collection.Num();
+}
+
+TArray<FName> UAruAssetCollector::GetAssetTags(int32 Index) const
+{
+	return Collection.IsValidIndex(Index) ? Collection.GetTags(Index) : TArray<FName>{};
+}
+
 void UAruAssetCollector::ClearAssets()
 {
+	Collection.Reset();
 	AruAssetObjects.Empty();
 }
 
 void UAruAssetCollector::AddAruAssetObject(UAruAssetObject* AruAssetObject)
 {
-	if (AruAssetObject)
+	if (!AruAssetObject)
+	{
+		return;
+	}
+
+	AruAssetObjects.AddUnique(AruAssetObject);
+	const int32 Index = Collection.Add(AruAssetObject->GetReferencedObject(), AruAssetObject->GetAssetTags());
+
+	// The entry may already carry tags from an earlier add, which the asset object takes over before it reports its own
+	if (Index != INDEX_NONE)
+	{
+		for (const FName& Tag : Collection.GetTags(Index))
+		{
+			AruAssetObject->AddAssetTag(Tag);
+		}
+	}
+	AruAssetObject->Collectors.AddUnique(this);
+}
+
+void UAruAssetCollector::SyncAssetObjectTags(const UAruAssetObject* AruAssetObject)
+{
+	// Objects dropped by ClearAssets may still hold on to this collector
+	if (AruAssetObjects.Contains(AruAssetObject))
+	{
+		Collection.Add(AruAssetObject->GetReferencedObject(), AruAssetObject->GetAssetTags());
+	}
+}
+
+bool UAruAssetCollector::AddTaggedAsset(UObject* SourceObject, const TArray<FName>& Tags)
+{
+	if (Collection.Add(SourceObject, Tags) == INDEX_NONE)
+	{
+		return false;
+	}
+
+	for (TObjectPtr<UAruAssetObject> AruAssetObject : AruAssetObjects)
 	{
-		AruAssetObjects.AddUnique(AruAssetObject);
+		if (AruAssetObject && AruAssetObject->GetReferencedObject() == SourceObject)
+		{
+			for (const FName& Tag : Tags)
+			{
+				AruAssetObject->AddAssetTag(Tag);
+			}
+		}
 	}
+	return true;
 }
 
 UAruAssetObject* UAruAssetCollector::AddInstance(UObject* SourceObject, const TArray<FName>& Tags)
@@ -52,32 +152,14 @@ UAruAssetObject* UAruAssetCollector::AddInstance(UObject* SourceObject, const TA
 		return nullptr;
 	}
 
-	// Create a new asset object instance
 	UAruAssetObject* NewAssetObject = NewObject<UAruAssetObject>(this);
-	
-	// Set the referenced object
 	NewAssetObject->SetReferencedObject(SourceObject);
-	
-	// Set the asset name based on the object name if available
-	FName ObjectName = NAME_None;
-	if (SourceObject->GetName().Len() > 0)
-	{
-		ObjectName = FName(*SourceObject->GetName());
-	}
-	else if (SourceObject->GetClass())
-	{
-		ObjectName = FName(*FString::Printf(TEXT("%s_Instance"), *SourceObject->GetClass()->GetName()));
-	}
-	NewAssetObject->SetAssetName(ObjectName);
-	
-	// Add all tags
+	NewAssetObject->SetAssetName(SourceObject->GetFName());
 	for (const FName& Tag : Tags)
 	{
 		NewAssetObject->AddAssetTag(Tag);
 	}
-	
-	// Add the object to our collection
+
 	AddAruAssetObject(NewAssetObject);
-	
 	return NewAssetObject;
 }
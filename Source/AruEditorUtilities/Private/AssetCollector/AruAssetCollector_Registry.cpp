@@ -0,0 +1,143 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AssetCollector/AruAssetCollector_Registry.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AruAssetCollector_Registry)
+
+
+void UAruAssetCollector_Registry::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		return;
+	}
+
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetAddedHandle = AssetRegistry->OnAssetAdded().AddUObject(this, &UAruAssetCollector_Registry::OnAssetAdded);
+		AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddUObject(this, &UAruAssetCollector_Registry::OnAssetRemoved);
+		AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddUObject(this, &UAruAssetCollector_Registry::OnAssetRenamed);
+	}
+}
+
+void UAruAssetCollector_Registry::BeginDestroy()
+{
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+
+	Super::BeginDestroy();
+}
+
+#if WITH_EDITOR
+void UAruAssetCollector_Registry::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	InvalidateCache();
+}
+#endif
+
+FARFilter UAruAssetCollector_Registry::MakeFilter() const
+{
+	FARFilter Filter;
+	Filter.PackagePaths = PackagePaths;
+	Filter.bRecursivePaths = bRecursivePaths;
+	Filter.bRecursiveClasses = bRecursiveClasses;
+	for (const TSoftClassPtr<UObject>& AssetClass : AssetClasses)
+	{
+		if (!AssetClass.IsNull())
+		{
+			Filter.ClassPaths.Add(FTopLevelAssetPath{AssetClass.ToSoftObjectPath().GetAssetPathString()});
+		}
+	}
+	for (const TPair<FName, FString>& TagValue : RequiredTagValues)
+	{
+		Filter.TagsAndValues.Add(TagValue.Key, TagValue.Value.IsEmpty() ? TOptional<FString>{} : TOptional<FString>{TagValue.Value});
+	}
+	return Filter;
+}
+
+void UAruAssetCollector_Registry::Collect_Implementation()
+{
+	if (bCacheValid)
+	{
+		return;
+	}
+
+	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	if (AssetRegistry == nullptr)
+	{
+		return;
+	}
+
+	Collection.Reset();
+	AssetRegistry->CompileFilter(MakeFilter(), CompiledFilter);
+
+	// Assets the registry hasn't discovered yet arrive later through OnAssetAdded.
+	AssetRegistry->EnumerateAssets(CompiledFilter, [this](const FAssetData& AssetData)
+	{
+		AddAsset(AssetData);
+		return true;
+	});
+	bCacheValid = true;
+}
+
+void UAruAssetCollector_Registry::ClearAssets()
+{
+	Super::ClearAssets();
+	bCacheValid = false;
+}
+
+void UAruAssetCollector_Registry::InvalidateCache()
+{
+	ClearAssets();
+}
+
+bool UAruAssetCollector_Registry::IsIncluded(const FAssetData& AssetData) const
+{
+	const IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	return AssetRegistry != nullptr && AssetRegistry->IsAssetIncludedByFilter(AssetData, CompiledFilter);
+}
+
+void UAruAssetCollector_Registry::AddAsset(const FAssetData& AssetData)
+{
+	Collection.Add(AssetData.GetSoftObjectPath(), AssetData.AssetName, AssetTags);
+}
+
+void UAruAssetCollector_Registry::OnAssetAdded(const FAssetData& AssetData)
+{
+	if (bCacheValid && IsIncluded(AssetData))
+	{
+		AddAsset(AssetData);
+	}
+}
+
+void UAruAssetCollector_Registry::OnAssetRemoved(const FAssetData& AssetData)
+{
+	if (bCacheValid)
+	{
+		Collection.Remove(AssetData.GetSoftObjectPath());
+	}
+}
+
+void UAruAssetCollector_Registry::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (!bCacheValid)
+	{
+		return;
+	}
+
+	// The asset may have moved out of or into the searched folders, so it is filtered again under its new path.
+	Collection.Remove(FSoftObjectPath{OldObjectPath});
+	if (IsIncluded(AssetData))
+	{
+		AddAsset(AssetData);
+	}
+}
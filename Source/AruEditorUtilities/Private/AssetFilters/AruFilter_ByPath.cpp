@@ -1,5 +1,6 @@
 ﻿#include "AssetFilters/AruFilter_ByPath.h"
 #include "AruFunctionLibrary.h"
+#include "AruRunLog.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruFilter_ByPath)
 
 #define LOCTEXT_NAMESPACE "FAruEditorUtilitiesModule"
@@ -20,14 +21,9 @@ bool FAruFilter_ByAssetPath::IsConditionMet(const FProperty* InProperty, const v
 	UObject* ObjectPtr = ObjectProperty->GetObjectPropertyValue(InValue);
 	if (ObjectPtr == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"Failed to filter by object path",
-					"Failed to filter by object path. Property:{0}'s value is nullptr."),
-					FText::FromString(ObjectProperty->GetName())
-				)
-			);
+		ARU_LOG(Warning,
+			LOCTEXT("Failed to filter by object path", "Failed to filter by object path. Property:{0}'s value is nullptr."),
+			ObjectProperty->GetFName());
 		return false;
 	}
 
@@ -41,14 +37,9 @@ bool FAruFilter_ByAssetPath::IsConditionMet(const FProperty* InProperty, const v
 	const FString AssetPath = ObjectPtr->GetPathName();
 	if (AssetPath.IsEmpty())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"Failed to filter by object path",
-					"Failed to filter by object:'{0}''s path. Asset's path is empty."),
-					FText::FromString(ObjectPtr->GetName())
-				)
-			);
+		ARU_LOG(Warning,
+			LOCTEXT("Failed to filter by object path", "Failed to filter by object:'{0}''s path. Asset's path is empty."),
+			ObjectPtr->GetFName());
 		return false;
 	}
 
@@ -60,25 +51,15 @@ bool FAruFilter_ByAssetPath::IsConditionMet(const FProperty* InProperty, const v
 
 	if (Result == true)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"Filtering by object path",
-					"Asset path:'{0}' matched."),
-				FText::FromString(AssetPath)
-			)
-		);
+		ARU_LOG(Info,
+			LOCTEXT("Filtering by object path", "Asset path:'{0}' matched."),
+			AssetPath);
 	}
 	else
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"Filtering by object path",
-					"Asset path:'{0}' do not match."),
-				FText::FromString(AssetPath)
-			)
-		);
+		ARU_LOG(Info,
+			LOCTEXT("Filtering by object path", "Asset path:'{0}' do not match."),
+			AssetPath);
 	}
 
 	return Result;
@@ -0,0 +1,65 @@
+#include "AssetFilters/AruFilter_MathStruct.h"
+#include "AruMathUtils.h"
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AruFilter_MathStruct)
+
+bool FAruFilter_MathStructComponents::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
+{
+	if (InProperty == nullptr || InValue == nullptr)
+	{
+		return bInverseCondition;
+	}
+
+	const EAruMathStruct Type = Aru::Math::GetMathStructType(InProperty);
+	if (Type == EAruMathStruct::None)
+	{
+		return bInverseCondition;
+	}
+
+	const VectorRegister4Double Value = Aru::Math::Load(Type, InValue, TransformComponent);
+	const VectorRegister4Double Condition = VectorLoad(&ConditionValue.X);
+
+	VectorRegister4Double Result;
+	switch (CompareOp)
+	{
+	case EAruNumericCompareOp::Equip:
+		Result = VectorCompareLE(VectorAbs(VectorSubtract(Value, Condition)), VectorSetFloat1(Tolerance));
+		break;
+	case EAruNumericCompareOp::NotEqual:
+		Result = VectorCompareGT(VectorAbs(VectorSubtract(Value, Condition)), VectorSetFloat1(Tolerance));
+		break;
+	case EAruNumericCompareOp::GreaterThan:
+		Result = VectorCompareGT(Value, Condition);
+		break;
+	case EAruNumericCompareOp::LessThan:
+		Result = VectorCompareLT(Value, Condition);
+		break;
+	default:
+		return bInverseCondition;
+	}
+
+	const int32 ComponentMask = Aru::Math::GetComponentMask(Type);
+	const int32 PassedComponents = VectorMaskBits(Result) & ComponentMask;
+	const bool bConditionMet = ComponentMatch == EAruContainerCompareOp::HasAll
+		? PassedComponents == ComponentMask
+		: PassedComponents != 0;
+	return bConditionMet ^ bInverseCondition;
+}
+
+bool FAruFilter_MathStructLength::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
+{
+	if (InProperty == nullptr || InValue == nullptr)
+	{
+		return bInverseCondition;
+	}
+
+	const EAruMathStruct Type = Aru::Math::GetMathStructType(InProperty);
+	if (Type == EAruMathStruct::None)
+	{
+		return bInverseCondition;
+	}
+
+	// Unused lanes are loaded as zero, so the four-lane dot product is the squared length of every type.
+	const VectorRegister4Double Value = Aru::Math::Load(Type, InValue, TransformComponent);
+	const double Length = FMath::Sqrt(VectorGetComponent(VectorDot4(Value, Value), 0));
+	return FMath::IsWithinInclusive(Length, ConditionValue.X, ConditionValue.Y) ^ bInverseCondition;
+}
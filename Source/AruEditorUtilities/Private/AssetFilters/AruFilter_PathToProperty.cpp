@@ -1,5 +1,6 @@
 #include "AssetFilters/AruFilter_PathToProperty.h"
 #include "AruFunctionLibrary.h"
+#include "AruRunLog.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruFilter_PathToProperty)
 
 #define LOCTEXT_NAMESPACE "FAruEditorUtilitiesModule"
@@ -25,16 +26,12 @@ bool FAruFilter_PathToProperty::IsConditionMet(const FProperty* InProperty, cons
 		// Get Current Property Name
 		FString CurrentPropertyName = InProperty ? InProperty->GetName() : TEXT("Unknown");
 		
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"NoPropertyFound",
-					"[{0}][{1}]Failed to find property '{2}' by path:'{3}'."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(CurrentPropertyName),
-				FText::FromString(ResolvedPath)
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("NoPropertyFound", "[{0}][{1}]Failed to find property '{2}' by path:'{3}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			CurrentPropertyName,
+			ResolvedPath);
 		
 		return bInverseCondition;
 	}
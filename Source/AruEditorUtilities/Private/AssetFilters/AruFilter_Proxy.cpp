@@ -1,5 +1,22 @@
 #include "AssetFilters/AruFilter_Proxy.h"
+#include "AruPropertyDispatch.h"
+#include "AruProxyBatch.h"
+#include "AruTrace.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruFilter_Proxy)
+
+namespace Aru::Private
+{
+	/** Batch results of one filter proxy during a run, one slot per supported element type. */
+	struct FFilterProxyBatches
+	{
+		TAruProxyBatch<FBoolProperty, bool, bool> Bools;
+		TAruProxyBatch<FIntProperty, int32, bool> Ints;
+		TAruProxyBatch<FFloatProperty, float, bool> Floats;
+		TAruProxyBatch<FStrProperty, FString, bool> Strings;
+		TAruProxyBatch<FNameProperty, FName, bool> Names;
+	};
+}
+
 void FAruFilter_BlueprintProxy::InitializeProxy(UObject* InOwner)
 {
     // Check if there is already a valid ProxyInstance
@@ -27,6 +44,9 @@ void FAruFilter_BlueprintProxy::InitializeProxy(UObject* InOwner)
     UObject* Owner = InOwner ? InOwner : GetTransientPackage();
     
     // Create a new ProxyInstance
+    LLM_SCOPE_BYTAG(Aru_Proxies);
+    TRACE_COUNTER_INCREMENT(AruProxyInstances);
+    Aru::Memory::CountInRun(&FAruRunStats::ProxyInstances);
     ProxyInstance = NewObject<UAruFilterProxy>(Owner, ProxyClass);
 }
 
@@ -46,93 +66,151 @@ bool FAruFilter_BlueprintProxy::EnsureProxyInitialized() const
     return ProxyInstance != nullptr;
 }
 
-bool FAruFilter_Proxy::IsConditionMet(
+bool FAruFilter_BlueprintProxy::IsConditionMet(
 	const FProperty* InProperty,
 	const void* InValue,
 	const FInstancedPropertyBag& InParameters) const
 {
-	if (InProperty == nullptr)
+	// Runs are kept off worker threads by IsThreadSafe, Blueprint code must never get there.
+	if (!ensureMsgf(IsInGameThread(), TEXT("Blueprint filter proxies must run on the game thread.")))
 	{
 		return false;
 	}
 
-	if(InValue == nullptr)
+	if (const TOptional<bool> BatchedCondition = FindBatchedCondition(InProperty, InValue))
 	{
-		return false;
+		return BatchedCondition.GetValue();
 	}
 
-	if(const FBoolProperty* BoolProperty = CastField<FBoolProperty>(InProperty))
-	{
-		return IsConditionMet_Internal(BoolProperty->GetPropertyValue(InValue), InParameters);
-	}
-
-	if(const FIntProperty* IntProperty = CastField<FIntProperty>(InProperty))
-	{
-		return IsConditionMet_Internal(IntProperty->GetPropertyValue(InValue), InParameters);
-	}
-
-	if(const FFloatProperty* FloatProperty = CastField<FFloatProperty>(InProperty))
-	{
-		return IsConditionMet_Internal(FloatProperty->GetPropertyValue(InValue), InParameters);
-	}
-
-	if(const FStrProperty* StrProperty = CastField<FStrProperty>(InProperty))
-	{
-		return IsConditionMet_Internal(StrProperty->GetPropertyValue(InValue), InParameters);
-	}
-
-	if(const FTextProperty* TextProperty = CastField<FTextProperty>(InProperty))
-	{
-		return IsConditionMet_Internal(TextProperty->GetPropertyValue(InValue), InParameters);
-	}
-
-	if(const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(InProperty))
-	{
-		return IsConditionMet_Internal(ObjectProperty->GetObjectPropertyValue(InValue), InParameters);
-	}
-
-	if(const FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(InProperty))
-	{
-		return IsConditionMet_Internal(SoftObjectProperty->GetObjectPropertyValue(InValue), InParameters);
-	}
+	return FAruFilter_Proxy::IsConditionMet(InProperty, InValue, InParameters);
+}
 
-	if(const FNameProperty* NameProperty = CastField<FNameProperty>(InProperty))
+TOptional<bool> FAruFilter_BlueprintProxy::FindBatchedCondition(const FProperty* InProperty, const void* InValue) const
+{
+	FAruProcessingContext* Context = FAruProcessingContext::Get();
+	if (InProperty == nullptr || InValue == nullptr || Context == nullptr || FAruArrayScope::Get() == nullptr || !EnsureProxyInitialized())
 	{
-		return IsConditionMet_Internal(NameProperty->GetPropertyValue(InValue), InParameters);
+		return {};
 	}
 
-	if(const FEnumProperty* EnumProperty = CastField<FEnumProperty>(InProperty))
-	{
-		return IsConditionMet_Internal(EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(InValue), EnumProperty->GetEnum(), InParameters);
-	}
+	LLM_SCOPE_BYTAG(Aru_Proxies);
+	const UClass* ProxyType = ProxyInstance->GetClass();
+	const TSharedRef<Aru::Private::FFilterProxyBatches> Batches = Context->FindOrAddRuleCache<Aru::Private::FFilterProxyBatches>(
+		this, []
+		{
+			return MakeShared<Aru::Private::FFilterProxyBatches>();
+		});
 
-	if (const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty))
+	switch (Aru::Dispatch::Find(InProperty).Kind)
 	{
-		const UScriptStruct* StructType = StructProperty->Struct;
-		if(StructType == nullptr)
+	case EAruValueKind::Bool:
+		if (!ProxyType->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAruFilterProxy, CheckBoolValues)))
 		{
-			return false;
+			return {};
 		}
-
-		if(StructType == FGameplayTag::StaticStruct())
+		return Batches->Bools.Find(static_cast<const FBoolProperty*>(InProperty), InValue, [this](const TArray<bool>& Values, const TArray<FAruProxyValueContext>& Contexts)
+		{
+			return ProxyInstance->CheckBoolValues(Values, Contexts);
+		});
+	case EAruValueKind::Int32:
+		if (!ProxyType->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAruFilterProxy, CheckIntValues)))
 		{
-			return IsConditionMet_Internal(*static_cast<const FGameplayTag*>(InValue), InParameters);
+			return {};
 		}
-
-		if(StructType == FGameplayTagContainer::StaticStruct())
+		return Batches->Ints.Find(static_cast<const FIntProperty*>(InProperty), InValue, [this](const TArray<int32>& Values, const TArray<FAruProxyValueContext>& Contexts)
+		{
+			return ProxyInstance->CheckIntValues(Values, Contexts);
+		});
+	case EAruValueKind::Float:
+		if (!ProxyType->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAruFilterProxy, CheckFloatValues)))
 		{
-			return IsConditionMet_Internal(*static_cast<const FGameplayTagContainer*>(InValue), InParameters);
+			return {};
 		}
-
-		if(StructType == FInstancedStruct::StaticStruct())
+		return Batches->Floats.Find(static_cast<const FFloatProperty*>(InProperty), InValue, [this](const TArray<float>& Values, const TArray<FAruProxyValueContext>& Contexts)
+		{
+			return ProxyInstance->CheckFloatValues(Values, Contexts);
+		});
+	case EAruValueKind::String:
+		if (!ProxyType->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAruFilterProxy, CheckStringValues)))
 		{
-			return IsConditionMet_Internal(*static_cast<const FInstancedStruct*>(InValue), InParameters);
+			return {};
 		}
+		return Batches->Strings.Find(static_cast<const FStrProperty*>(InProperty), InValue, [this](const TArray<FString>& Values, const TArray<FAruProxyValueContext>& Contexts)
+		{
+			return ProxyInstance->CheckStringValues(Values, Contexts);
+		});
+	case EAruValueKind::Name:
+		if (!ProxyType->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAruFilterProxy, CheckNameValues)))
+		{
+			return {};
+		}
+		return Batches->Names.Find(static_cast<const FNameProperty*>(InProperty), InValue, [this](const TArray<FName>& Values, const TArray<FAruProxyValueContext>& Contexts)
+		{
+			return ProxyInstance->CheckNameValues(Values, Contexts);
+		});
+	default:
+		return {};
+	}
+}
 
-		return IsConditionMet_Internal(FConstStructView{StructType, static_cast<const uint8*>(InValue)}, InParameters);
+bool FAruFilter_Proxy::IsConditionMet(
+	const FProperty* InProperty,
+	const void* InValue,
+	const FInstancedPropertyBag& InParameters) const
+{
+	if (InProperty == nullptr)
+	{
+		return false;
+	}
+
+	if(InValue == nullptr)
+	{
+		return false;
+	}
+
+	const FAruValueDispatch Dispatch = Aru::Dispatch::Find(InProperty);
+	switch (Dispatch.Kind)
+	{
+	case EAruValueKind::Bool:
+		return IsConditionMet_Internal(static_cast<const FBoolProperty*>(InProperty)->GetPropertyValue(InValue), InParameters);
+	case EAruValueKind::Int32:
+		return IsConditionMet_Internal(FIntProperty::GetPropertyValue(InValue), InParameters);
+	case EAruValueKind::Int8:
+	case EAruValueKind::Int16:
+	case EAruValueKind::UInt16:
+	case EAruValueKind::UInt32:
+	case EAruValueKind::Int64:
+		return IsConditionMet_Internal(static_cast<const FNumericProperty*>(InProperty)->GetSignedIntPropertyValue(InValue), InParameters);
+	case EAruValueKind::UInt64:
+		return IsConditionMet_Internal(static_cast<int64>(FMath::Min<uint64>(FUInt64Property::GetPropertyValue(InValue), MAX_int64)), InParameters);
+	case EAruValueKind::Byte:
+		return IsConditionMet_Internal(FByteProperty::GetPropertyValue(InValue), InParameters);
+	case EAruValueKind::Float:
+		return IsConditionMet_Internal(FFloatProperty::GetPropertyValue(InValue), InParameters);
+	case EAruValueKind::Double:
+		return IsConditionMet_Internal(FDoubleProperty::GetPropertyValue(InValue), InParameters);
+	case EAruValueKind::String:
+		return IsConditionMet_Internal(FStrProperty::GetPropertyValue(InValue), InParameters);
+	case EAruValueKind::Text:
+		return IsConditionMet_Internal(FTextProperty::GetPropertyValue(InValue), InParameters);
+	case EAruValueKind::Object:
+	case EAruValueKind::SoftObject:
+		return IsConditionMet_Internal(static_cast<const FObjectPropertyBase*>(InProperty)->GetObjectPropertyValue(InValue), InParameters);
+	case EAruValueKind::Name:
+		return IsConditionMet_Internal(FNameProperty::GetPropertyValue(InValue), InParameters);
+	case EAruValueKind::Enum:
+		return IsConditionMet_Internal(static_cast<int32>(Dispatch.UnderlyingProperty->GetSignedIntPropertyValue(InValue)), Dispatch.Enum, InParameters);
+	case EAruValueKind::GameplayTag:
+		return IsConditionMet_Internal(*static_cast<const FGameplayTag*>(InValue), InParameters);
+	case EAruValueKind::GameplayTagContainer:
+		return IsConditionMet_Internal(*static_cast<const FGameplayTagContainer*>(InValue), InParameters);
+	case EAruValueKind::InstancedStruct:
+		return IsConditionMet_Internal(*static_cast<const FInstancedStruct*>(InValue), InParameters);
+	case EAruValueKind::Struct:
+		return IsConditionMet_Internal(FConstStructView{Dispatch.Struct, static_cast<const uint8*>(InValue)}, InParameters);
+	default:
+		return false;
 	}
-	
-	return false;
 }
 
 bool UAruFilterProxy::CheckBoolValue_Implementation(
@@ -147,6 +225,24 @@ bool UAruFilterProxy::CheckIntValue_Implementation(
 	return false;
 }
 
+bool UAruFilterProxy::CheckInt64Value_Implementation(
+	const int64 InInt64Value) const
+{
+	return false;
+}
+
+bool UAruFilterProxy::CheckByteValue_Implementation(
+	const uint8 InByteValue) const
+{
+	return false;
+}
+
+bool UAruFilterProxy::CheckDoubleValue_Implementation(
+	const double InDoubleValue) const
+{
+	return false;
+}
+
 bool UAruFilterProxy::CheckFloatValue_Implementation(
 	const float InFloatValue) const
 {
@@ -208,6 +304,71 @@ bool UAruFilterProxy::CheckEnumValue_Implementation(
 	return false;
 }
 
+TArray<bool> UAruFilterProxy::CheckBoolValues_Implementation(
+	const TArray<bool>& InValues,
+	const TArray<FAruProxyValueContext>& InContexts) const
+{
+	TArray<bool> Results;
+	Results.Reserve(InValues.Num());
+	for (const bool Value : InValues)
+	{
+		Results.Add(CheckBoolValue(Value));
+	}
+	return Results;
+}
+
+TArray<bool> UAruFilterProxy::CheckIntValues_Implementation(
+	const TArray<int32>& InValues,
+	const TArray<FAruProxyValueContext>& InContexts) const
+{
+	TArray<bool> Results;
+	Results.Reserve(InValues.Num());
+	for (const int32 Value : InValues)
+	{
+		Results.Add(CheckIntValue(Value));
+	}
+	return Results;
+}
+
+TArray<bool> UAruFilterProxy::CheckFloatValues_Implementation(
+	const TArray<float>& InValues,
+	const TArray<FAruProxyValueContext>& InContexts) const
+{
+	TArray<bool> Results;
+	Results.Reserve(InValues.Num());
+	for (const float Value : InValues)
+	{
+		Results.Add(CheckFloatValue(Value));
+	}
+	return Results;
+}
+
+TArray<bool> UAruFilterProxy::CheckStringValues_Implementation(
+	const TArray<FString>& InValues,
+	const TArray<FAruProxyValueContext>& InContexts) const
+{
+	TArray<bool> Results;
+	Results.Reserve(InValues.Num());
+	for (const FString& Value : InValues)
+	{
+		Results.Add(CheckStringValue(Value));
+	}
+	return Results;
+}
+
+TArray<bool> UAruFilterProxy::CheckNameValues_Implementation(
+	const TArray<FName>& InValues,
+	const TArray<FAruProxyValueContext>& InContexts) const
+{
+	TArray<bool> Results;
+	Results.Reserve(InValues.Num());
+	for (const FName& Value : InValues)
+	{
+		Results.Add(CheckNameValue(Value));
+	}
+	return Results;
+}
+
 bool FAruFilter_BlueprintProxy::IsConditionMet_Internal(
 	const bool InBoolValue,
 	const FInstancedPropertyBag& InParameters) const
@@ -232,6 +393,42 @@ bool FAruFilter_BlueprintProxy::IsConditionMet_Internal(
 	return ProxyInstance->CheckIntValue(InIntValue);
 }
 
+bool FAruFilter_BlueprintProxy::IsConditionMet_Internal(
+	const int64 InInt64Value,
+	const FInstancedPropertyBag& InParameters) const
+{
+	if (!EnsureProxyInitialized())
+	{
+		return false;
+	}
+
+	return ProxyInstance->CheckInt64Value(InInt64Value);
+}
+
+bool FAruFilter_BlueprintProxy::IsConditionMet_Internal(
+	const uint8 InByteValue,
+	const FInstancedPropertyBag& InParameters) const
+{
+	if (!EnsureProxyInitialized())
+	{
+		return false;
+	}
+
+	return ProxyInstance->CheckByteValue(InByteValue);
+}
+
+bool FAruFilter_BlueprintProxy::IsConditionMet_Internal(
+	const double InDoubleValue,
+	const FInstancedPropertyBag& InParameters) const
+{
+	if (!EnsureProxyInitialized())
+	{
+		return false;
+	}
+
+	return ProxyInstance->CheckDoubleValue(InDoubleValue);
+}
+
 bool FAruFilter_BlueprintProxy::IsConditionMet_Internal(
 	const float InFloatValue,
 	const FInstancedPropertyBag& InParameters) const
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "AssetObject/AruAssetObject.h"
+#include "AssetCollector/AruAssetCollector.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruAssetObject)
 
@@ -36,6 +37,13 @@ void UAruAssetObject::AddAssetTag(const FName& InTag)
 	if (!AssetTags.Contains(InTag))
 	{
 		AssetTags.Add(InTag);
+		for (const TWeakObjectPtr<UAruAssetCollector>& Collector : Collectors)
+		{
+			if (UAruAssetCollector* CollectorPtr = Collector.Get())
+			{
+				CollectorPtr->SyncAssetObjectTags(this);
+			}
+		}
 	}
 }
 
@@ -0,0 +1,252 @@
+#include "AssetPredicates/AruPredicate_Arithmetic.h"
+#include "AruRunLog.h"
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_Arithmetic)
+
+#define LOCTEXT_NAMESPACE "AruPredicate_Arithmetic"
+
+bool FAruPredicate_Arithmetic::Execute(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const
+{
+	if (InProperty == nullptr || InValue == nullptr)
+	{
+		return false;
+	}
+
+	const FNumericProperty* NumericProperty = CastField<FNumericProperty>(InProperty);
+	void* Values = InValue;
+	int32 NumValues = 1;
+	if (NumericProperty != nullptr)
+	{
+		// Array elements are transformed together when the array itself is visited.
+		if (bBatchArrays && CastField<FArrayProperty>(InProperty->GetOwner<FField>()) != nullptr)
+		{
+			return false;
+		}
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InProperty))
+	{
+		NumericProperty = CastField<FNumericProperty>(ArrayProperty->Inner);
+		if (NumericProperty != nullptr)
+		{
+			FScriptArrayHelper ArrayHelper{ArrayProperty, InValue};
+			if (!bBatchArrays || ArrayHelper.Num() == 0)
+			{
+				return false;
+			}
+			Values = ArrayHelper.GetRawPtr(0);
+			NumValues = ArrayHelper.Num();
+		}
+	}
+
+	const int32 NumChanged = NumericProperty != nullptr && !NumericProperty->IsEnum()
+		? ApplyToNumericValues(NumericProperty, Values, NumValues)
+		: INDEX_NONE;
+	if (NumChanged == INDEX_NONE)
+	{
+		ARU_LOG(Warning,
+			LOCTEXT("PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a numeric value or array."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
+		return false;
+	}
+
+	if (NumChanged == 0)
+	{
+		return false;
+	}
+
+	ARU_LOG(Info,
+		LOCTEXT("OperationSucceed", "[{0}][{1}]Property:'{2}' {3} of {4} values changed."),
+		GetCompactName(),
+		Aru::ProcessResult::Success,
+		InProperty->GetFName(),
+		NumChanged,
+		NumValues);
+	return true;
+}
+
+VectorRegister4Double FAruPredicate_Arithmetic::ApplyDoubleRegister(const VectorRegister4Double& Value) const
+{
+	alignas(16) double Lanes[4];
+	VectorStoreAligned(Value, Lanes);
+	for (double& Lane : Lanes)
+	{
+		Lane = ApplyScalar(Lane);
+	}
+	return VectorLoadAligned(Lanes);
+}
+
+int32 FAruPredicate_Arithmetic::ApplyToNumericValues(const FNumericProperty* NumericProperty, void* Values, const int32 Num) const
+{
+	if (NumericProperty->IsA<FFloatProperty>())
+	{
+		return ApplyToValues(static_cast<float*>(Values), Num);
+	}
+	if (NumericProperty->IsA<FDoubleProperty>())
+	{
+		return ApplyToValues(static_cast<double*>(Values), Num);
+	}
+	if (NumericProperty->IsA<FIntProperty>())
+	{
+		return ApplyToValues(static_cast<int32*>(Values), Num);
+	}
+	if (NumericProperty->IsA<FInt64Property>())
+	{
+		return ApplyToValues(static_cast<int64*>(Values), Num);
+	}
+	if (NumericProperty->IsA<FInt16Property>())
+	{
+		return ApplyToValues(static_cast<int16*>(Values), Num);
+	}
+	if (NumericProperty->IsA<FInt8Property>())
+	{
+		return ApplyToValues(static_cast<int8*>(Values), Num);
+	}
+	if (NumericProperty->IsA<FByteProperty>())
+	{
+		return ApplyToValues(static_cast<uint8*>(Values), Num);
+	}
+	if (NumericProperty->IsA<FUInt16Property>())
+	{
+		return ApplyToValues(static_cast<uint16*>(Values), Num);
+	}
+	if (NumericProperty->IsA<FUInt32Property>())
+	{
+		return ApplyToValues(static_cast<uint32*>(Values), Num);
+	}
+	if (NumericProperty->IsA<FUInt64Property>())
+	{
+		return ApplyToValues(static_cast<uint64*>(Values), Num);
+	}
+	return INDEX_NONE;
+}
+
+template <typename T>
+int32 FAruPredicate_Arithmetic::ApplyToValues(T* Values, const int32 Num) const
+{
+	int32 NumChanged = 0;
+	int32 Index = 0;
+	if constexpr (std::is_same_v<T, float>)
+	{
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			// Widened and narrowed exactly like a single value going through ApplyScalar.
+			const VectorRegister4Float Previous = VectorLoad(Values + Index);
+			const VectorRegister4Float Result = MakeVectorRegisterFloatFromDouble(ApplyDoubleRegister(VectorRegister4Double{Previous}));
+			NumChanged += FMath::CountBits(static_cast<uint64>(VectorMaskBits(VectorCompareNE(Previous, Result))));
+			VectorStore(Result, Values + Index);
+		}
+	}
+	else if constexpr (std::is_same_v<T, double>)
+	{
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			const VectorRegister4Double Previous = VectorLoad(Values + Index);
+			const VectorRegister4Double Result = ApplyDoubleRegister(Previous);
+			NumChanged += FMath::CountBits(static_cast<uint64>(VectorMaskBits(VectorCompareNE(Previous, Result))));
+			VectorStore(Result, Values + Index);
+		}
+	}
+
+	for (; Index < Num; ++Index)
+	{
+		const T Previous = Values[Index];
+		T Result;
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			Result = static_cast<T>(ApplyScalar(Previous));
+		}
+		else
+		{
+			// Compared in double so the limits of 64-bit types, which round up when converted, still clamp safely.
+			const double Rounded = FMath::RoundHalfFromZero(ApplyScalar(static_cast<double>(Previous)));
+			if (FMath::IsNaN(Rounded))
+			{
+				Result = Previous;
+			}
+			else if (Rounded <= static_cast<double>(TNumericLimits<T>::Lowest()))
+			{
+				Result = TNumericLimits<T>::Lowest();
+			}
+			else if (Rounded >= static_cast<double>(TNumericLimits<T>::Max()))
+			{
+				Result = TNumericLimits<T>::Max();
+			}
+			else
+			{
+				Result = static_cast<T>(Rounded);
+			}
+		}
+
+		if (Result != Previous)
+		{
+			Values[Index] = Result;
+			++NumChanged;
+		}
+	}
+	return NumChanged;
+}
+
+double FAruPredicate_ScaleNumeric::ApplyScalar(const double Value) const
+{
+	return Value * Factor;
+}
+
+VectorRegister4Double FAruPredicate_ScaleNumeric::ApplyDoubleRegister(const VectorRegister4Double& Value) const
+{
+	return VectorMultiply(Value, VectorSetFloat1(Factor));
+}
+
+double FAruPredicate_AddNumeric::ApplyScalar(const double Value) const
+{
+	return Value + Addend;
+}
+
+VectorRegister4Double FAruPredicate_AddNumeric::ApplyDoubleRegister(const VectorRegister4Double& Value) const
+{
+	return VectorAdd(Value, VectorSetFloat1(Addend));
+}
+
+double FAruPredicate_ClampNumeric::ApplyScalar(const double Value) const
+{
+	return FMath::Clamp(Value, Min, Max);
+}
+
+VectorRegister4Double FAruPredicate_ClampNumeric::ApplyDoubleRegister(const VectorRegister4Double& Value) const
+{
+	// Selects like FMath::Clamp instead of min/max, so NaN and Min > Max give the same value as a single one.
+	const VectorRegister4Double MinRegister = VectorSetFloat1(Min);
+	const VectorRegister4Double MaxRegister = VectorSetFloat1(Max);
+	return VectorSelect(VectorCompareLT(Value, MinRegister), MinRegister, VectorSelect(VectorCompareLT(Value, MaxRegister), Value, MaxRegister));
+}
+
+double FAruPredicate_RoundNumeric::ApplyScalar(const double Value) const
+{
+	if (Step <= 0.0)
+	{
+		return Value;
+	}
+	return FMath::FloorToDouble(Value / Step + 0.5) * Step;
+}
+
+VectorRegister4Double FAruPredicate_RoundNumeric::ApplyDoubleRegister(const VectorRegister4Double& Value) const
+{
+	if (Step <= 0.0)
+	{
+		return Value;
+	}
+	const VectorRegister4Double StepRegister = VectorSetFloat1(Step);
+	return VectorMultiply(VectorFloor(VectorAdd(VectorDivide(Value, StepRegister), VectorSetFloat1(0.5))), StepRegister);
+}
+
+double FAruPredicate_RemapNumericByCurve::ApplyScalar(const double Value) const
+{
+	const FRichCurve* RichCurve = Curve.GetRichCurveConst();
+	if (RichCurve == nullptr || !RichCurve->HasAnyData())
+	{
+		return Value;
+	}
+	return RichCurve->Eval(static_cast<float>(Value));
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -1,4 +1,7 @@
 #include "AssetPredicates/AruPredicate_Array.h"
+#include "AruContainerUtils.h"
+#include "AruProcessingContext.h"
+#include "AruRunLog.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_Array)
 #define LOCTEXT_NAMESPACE "AruPredicate_Array"
 
@@ -10,55 +13,37 @@ bool FAruPredicate_AddArrayValue::Execute(
 	const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InProperty);
 	if (ArrayProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"AddArrayValue_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not an array."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("AddArrayValue_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not an array."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	if (Predicates.Num() == 0)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"AddArrayValue_NoPredicates",
-					"[{0}][{1}]Array:'{2}'. At least one predicate is required to complete the process."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(ArrayProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("AddArrayValue_NoPredicates", "[{0}][{1}]Array:'{2}'. At least one predicate is required to complete the process."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			ArrayProperty->GetFName());
 		return false;
 	}
 
 	FProperty* ElementProperty = ArrayProperty->Inner;
-	void* PendingElementPtr = FMemory::Malloc(ElementProperty->GetSize());
+	const FAruScopedScratchValue PendingElement{ElementProperty};
+	void* PendingElementPtr = PendingElement.Get();
 	if (PendingElementPtr == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"AddArrayValue_MallocFailed",
-					"[{0}][{1}]Map:'{2}'. Malloc memory for element failed."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Error,
+			LOCTEXT("AddArrayValue_MallocFailed", "[{0}][{1}]Map:'{2}'. Malloc memory for element failed."),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
 		return false;
 	}
-	ElementProperty->InitializeValue(PendingElementPtr);
-	
-	ON_SCOPE_EXIT
-	{
-		ElementProperty->DestroyValue(PendingElementPtr);
-		FMemory::Free(PendingElementPtr);
-	};
-	
+
 	bool bExecutedSuccessfully = false;
 	for (auto& Predicate : Predicates)
 	{
@@ -73,15 +58,11 @@ bool FAruPredicate_AddArrayValue::Execute(
 
 	if(bExecutedSuccessfully == false)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"AddArrayValue_ExecutionFailure",
-					"[{0}][{1}]Array:'{2}'. Predicate(s) executed failed."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(ArrayProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("AddArrayValue_ExecutionFailure", "[{0}][{1}]Array:'{2}'. Predicate(s) executed failed."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			ArrayProperty->GetFName());
 		return false;
 	}
 
@@ -89,30 +70,22 @@ bool FAruPredicate_AddArrayValue::Execute(
 	int32 NewElementIndex = ArrayHelper.AddValue();
 	if (!ArrayHelper.IsValidIndex(NewElementIndex))
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"AddArrayValue_AddFailed",
-					"[{0}][{1}]Failed to add new element to array:'{2}'"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(ArrayProperty->GetName())
-			));
+		ARU_LOG(Error,
+			LOCTEXT("AddArrayValue_AddFailed", "[{0}][{1}]Failed to add new element to array:'{2}'"),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			ArrayProperty->GetFName());
 		return false;
 	}
 
 	void* NewElementPtr = ArrayHelper.GetRawPtr(NewElementIndex);
 	ElementProperty->CopyCompleteValue(NewElementPtr, PendingElementPtr);
 
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-		FText::Format(
-			LOCTEXT(
-				"AddArray_Result.",
-				"[{0}][{1}]Added element to array:'{2}'."),
-			FText::FromString(GetCompactName()),
-			FText::FromString(Aru::ProcessResult::Success),
-			FText::FromString(ArrayProperty->GetName())
-		));
+	ARU_LOG(Info,
+		LOCTEXT("AddArray_Result.", "[{0}][{1}]Added element to array:'{2}'."),
+		GetCompactName(),
+		Aru::ProcessResult::Success,
+		ArrayProperty->GetFName());
 
 	return true;
 }
@@ -125,29 +98,21 @@ bool FAruPredicate_RemoveArrayValue::Execute(
 	const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InProperty);
 	if (ArrayProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"RemoveFromArray_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not an array."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("RemoveFromArray_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not an array."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	if (Filters.Num() == 0)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"RemoveFromArray_NoFilters",
-					"[{0}][{1}]Array:'{2}'. At least one filter is required to complete the process."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(ArrayProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("RemoveFromArray_NoFilters", "[{0}][{1}]Array:'{2}'. At least one filter is required to complete the process."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			ArrayProperty->GetFName());
 		return false;
 	}
 
@@ -169,37 +134,17 @@ bool FAruPredicate_RemoveArrayValue::Execute(
 		return true;
 	};
 
-	TArray<int32> PendingRemove;
 	FScriptArrayHelper ArrayHelper{ArrayProperty, InValue};
-	for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
-	{
-		if (ShouldRemove(ArrayHelper.GetRawPtr(Index)))
-		{
-			PendingRemove.Add(Index);
-		}
-	}
-
-	// Sort indices in descending order to avoid invalid indices after removal
-	PendingRemove.Sort([](const int32& A, const int32& B) { return A > B; });
-	
-	// Remove elements from highest index to lowest
-	for (int32 Index : PendingRemove)
-	{
-		ArrayHelper.RemoveValues(Index);
-	}
+	const int32 RemovedCount = Aru::Container::CompactArray(ArrayHelper, ArrayProperty->Inner, ShouldRemove);
 
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-		FText::Format(
-			LOCTEXT(
-				"RemoveFromArray_Result.",
-				"[{0}][{1}]Removed {2} element(s) from array:'{3}'."),
-			FText::FromString(GetCompactName()),
-			FText::FromString(PendingRemove.Num() > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed),
-			PendingRemove.Num(),
-			FText::FromString(ArrayProperty->GetName()))
-	);
+	ARU_LOG(Info,
+		LOCTEXT("RemoveFromArray_Result.", "[{0}][{1}]Removed {2} element(s) from array:'{3}'."),
+		GetCompactName(),
+		RemovedCount > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed,
+		RemovedCount,
+		ArrayProperty->GetFName());
 
-	return PendingRemove.Num() > 0;
+	return RemovedCount > 0;
 }
 
 bool FAruPredicate_ModifyArrayValue::Execute(
@@ -210,29 +155,21 @@ bool FAruPredicate_ModifyArrayValue::Execute(
 	const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InProperty);
 	if (ArrayProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"ModifyArrayValue_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not an array."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("ModifyArrayValue_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not an array."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	if (Predicates.Num() == 0)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"ModifyArrayValue_NoPredicates",
-					"[{0}][{1}]Array:'{2}'. At least one predicate is required to complete the process."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(ArrayProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("ModifyArrayValue_NoPredicates", "[{0}][{1}]Array:'{2}'. At least one predicate is required to complete the process."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			ArrayProperty->GetFName());
 		return false;
 	}
 
@@ -283,18 +220,54 @@ bool FAruPredicate_ModifyArrayValue::Execute(
 		ModifiedCount += bElementModified ? 1 : 0;
 	}
 
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-		FText::Format(
-			LOCTEXT(
-				"ModifyArrayValue_Result",
-				"[{0}][{1}]Array:'{2}': {3} element(s) matched, {4} modified'."),
-			FText::FromString(GetCompactName()),
-			FText::FromString(ModifiedCount > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed),
-			FText::FromString(ArrayProperty->GetName()),
-			MatchedCount,
-			ModifiedCount
-		));
+	ARU_LOG(Info,
+		LOCTEXT("ModifyArrayValue_Result", "[{0}][{1}]Array:'{2}': {3} element(s) matched, {4} modified'."),
+		GetCompactName(),
+		ModifiedCount > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed,
+		ArrayProperty->GetFName(),
+		MatchedCount,
+		ModifiedCount);
 
 	return ModifiedCount > 0;
 }
+
+void FAruPredicate_AddArrayValue::GatherPreloads(
+	const FProperty* InProperty,
+	const void* InValue,
+	const FInstancedPropertyBag& InParameters,
+	TArray<FSoftObjectPath>& OutPaths) const
+{
+	const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InProperty);
+	if (ArrayProperty == nullptr)
+	{
+		return;
+	}
+
+	const FAruScopedScratchValue PendingElement{ArrayProperty->Inner};
+	if (PendingElement.IsValid())
+	{
+		Aru::GatherPreloads(Predicates, ArrayProperty->Inner, PendingElement.Get(), InParameters, OutPaths);
+	}
+}
+
+void FAruPredicate_ModifyArrayValue::GatherPreloads(
+	const FProperty* InProperty,
+	const void* InValue,
+	const FInstancedPropertyBag& InParameters,
+	TArray<FSoftObjectPath>& OutPaths) const
+{
+	const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InProperty);
+	if (ArrayProperty == nullptr || InValue == nullptr)
+	{
+		return;
+	}
+
+	// Element filters are left to the write pass, so every element reports what it could load.
+	FScriptArrayHelper ArrayHelper{ArrayProperty, InValue};
+	for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+	{
+		Aru::GatherPreloads(Predicates, ArrayProperty->Inner, ArrayHelper.GetRawPtr(Index), InParameters, OutPaths);
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -1,5 +1,7 @@
 ﻿#include "AssetPredicates/AruPredicate_AssetPathRedirector.h"
 #include "AruFunctionLibrary.h"
+#include "AruProcessingContext.h"
+#include "AruRunLog.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_AssetPathRedirector)
 
 #define LOCTEXT_NAMESPACE "AruPredicate_AssetPathRedirector"
@@ -14,124 +16,264 @@ bool FAruPredicate_AssetPathRedirector::Execute(
 		return false;
 	}
 
+	if (const FSoftObjectProperty* SoftProperty = CastField<FSoftObjectProperty>(InProperty))
+	{
+		return RedirectSoftReference(SoftProperty, InValue, InParameters);
+	}
+
 	const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(InProperty);
 	if (ObjectProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{1}' is not an uobject."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertyTypeMismatch", "[{0}][{1}]Property:'{1}' is not an uobject."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	UObject* ObjectPtr = ObjectProperty->GetObjectPropertyValue(InValue);
 	if (ObjectPtr == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertyValueNull",
-					"[{0}][{1}]Property:'{2}' is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(ObjectProperty->GetName())
-			)
-		);
+		ARU_LOG(Warning,
+			LOCTEXT("PropertyValueNull", "[{0}][{1}]Property:'{2}' is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			ObjectProperty->GetFName());
 		return false;
 	}
 
-	TMap<FString, FString> ResolvedReplacementMap;
-	Algo::Transform(
-		ReplacementMap, ResolvedReplacementMap, [&InParameters](const TTuple<FString, FString>& InTuple)
+	const FString NewPath = GetRedirectedPath(ObjectPtr->GetPathName(), InParameters);
+	const FSoftObjectPath TargetAssetPath{NewPath};
+	if (UObject* LoadedAsset = FAruAssetCache::LoadAsset(TargetAssetPath))
+	{
+		if(!LoadedAsset->IsA(ObjectPtr->GetClass()))
 		{
-			return TTuple<FString, FString>
+			ARU_LOG(Warning,
+				LOCTEXT("ClassTypeMismatch", "[{0}][{1}]Property:'{2}' object class:{3}, new object class:{4}."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				ObjectPtr->GetClass()?ObjectPtr->GetClass()->GetName():FString{"NULL"},
+				LoadedAsset->GetClass()?LoadedAsset->GetClass()->GetName():FString{"NULL"});
+
+			return false;
+		}
+		
+		if (ObjectProperty->GetObjectPropertyValue(InValue) == LoadedAsset)
+		{
+			return false;
+		}
+
+		ObjectProperty->SetObjectPropertyValue(InValue, LoadedAsset);
+		ARU_LOG(Info,
+			LOCTEXT("OperationSucceed", "[{0}][{1}]Previous asset:'{2}', New asset:'{3}' from '{4}'"),
+			GetCompactName(),
+			Aru::ProcessResult::Success,
+			ObjectPtr->GetFName(),
+			LoadedAsset->GetFName(),
+			NewPath);
+		return true;
+	}
+
+	ARU_LOG(Warning,
+		LOCTEXT("ObjectNotFound", "[{0}][{1}]Property:'{2}'. Object not found by path:'{3}'."),
+		GetCompactName(),
+		Aru::ProcessResult::Failed,
+		InProperty->GetFName(),
+		NewPath);
+
+	return false;
+}
+
+bool FAruPredicate_AssetPathRedirector::RedirectSoftReference(
+	const FSoftObjectProperty* SoftProperty,
+	void* InValue,
+	const FInstancedPropertyBag& InParameters) const
+{
+	if (SoftProperty->IsA<FSoftClassProperty>())
+	{
+		ARU_LOG(Warning,
+			LOCTEXT("SoftClassUnsupported", "[{0}][{1}]Property:'{2}' is a soft class reference, which can't be verified without loading."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			SoftProperty->GetFName());
+		return false;
+	}
+
+	const FSoftObjectPath SourcePath = SoftProperty->GetPropertyValue(InValue).ToSoftObjectPath();
+	if (SourcePath.IsNull())
+	{
+		ARU_LOG(Warning,
+			LOCTEXT("PropertyValueNull", "[{0}][{1}]Property:'{2}' is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			SoftProperty->GetFName());
+		return false;
+	}
+
+	const FString NewPath = GetRedirectedPath(SourcePath.ToString(), InParameters);
+	const FSoftObjectPath TargetAssetPath{NewPath};
+	if (TargetAssetPath == SourcePath)
+	{
+		return false;
+	}
+
+	const FAssetData TargetAssetData = FAruAssetCache::FindAssetData(TargetAssetPath);
+	if (!TargetAssetData.IsValid())
+	{
+		ARU_LOG(Warning,
+			LOCTEXT("ObjectNotFound", "[{0}][{1}]Property:'{2}'. Object not found by path:'{3}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			SoftProperty->GetFName(),
+			NewPath);
+		return false;
+	}
+
+	// The previous asset's class is the requirement, as for hard references; fall back to the property class when it is gone.
+	const FAssetData SourceAssetData = FAruAssetCache::FindAssetData(SourcePath);
+	const UClass* RequiredClass = SourceAssetData.IsValid() && SourceAssetData.GetClass() ? SourceAssetData.GetClass() : SoftProperty->PropertyClass.Get();
+	const UClass* TargetClass = TargetAssetData.GetClass();
+	if (TargetClass == nullptr || RequiredClass == nullptr || !TargetClass->IsChildOf(RequiredClass))
+	{
+		ARU_LOG(Warning,
+			LOCTEXT("ClassTypeMismatch", "[{0}][{1}]Property:'{2}' object class:{3}, new object class:{4}."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			SoftProperty->GetFName(),
+			RequiredClass ? RequiredClass->GetName() : FString{"NULL"},
+			TargetAssetData.AssetClassPath.GetAssetName().ToString());
+		return false;
+	}
+
+	SoftProperty->SetPropertyValue(InValue, FSoftObjectPtr{TargetAssetPath});
+	ARU_LOG(Info,
+		LOCTEXT("OperationSucceed", "[{0}][{1}]Previous asset:'{2}', New asset:'{3}' from '{4}'"),
+		GetCompactName(),
+		Aru::ProcessResult::Success,
+		SourcePath.GetAssetName(),
+		TargetAssetPath.GetAssetName(),
+		NewPath);
+	return true;
+}
+
+void FAruPredicate_AssetPathRedirector::GatherPreloads(
+	const FProperty* InProperty,
+	const void* InValue,
+	const FInstancedPropertyBag& InParameters,
+	TArray<FSoftObjectPath>& OutPaths) const
+{
+	const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(InProperty);
+	if (ObjectProperty == nullptr || InValue == nullptr)
+	{
+		return;
+	}
+
+	const UObject* ObjectPtr = ObjectProperty->GetObjectPropertyValue(InValue);
+	if (ObjectPtr == nullptr)
+	{
+		return;
+	}
+
+	const FString SourcePath = ObjectPtr->GetPathName();
+	FString NewPath = GetRedirectedPath(SourcePath, InParameters);
+	if (NewPath != SourcePath)
+	{
+		OutPaths.Emplace(MoveTemp(NewPath));
+	}
+}
+
+FString FAruPredicate_AssetPathRedirector::GetRedirectedPath(const FString& SourcePath, const FInstancedPropertyBag& InParameters) const
+{
+	if (FAruProcessingContext* Context = FAruProcessingContext::Get())
+	{
+		const TSharedRef<FAruCompiledRedirects> Redirects = Context->FindOrAddRuleCache<FAruCompiledRedirects>(
+			this, [this, &InParameters]
 			{
-				UAruFunctionLibrary::ResolveParameterizedString(InParameters, InTuple.Key),
-				UAruFunctionLibrary::ResolveParameterizedString(InParameters, InTuple.Value)
-			};
-		});
+				return MakeShared<FAruCompiledRedirects>(ReplacementMap, InParameters);
+			});
+		return Redirects->Redirect(SourcePath);
+	}
 
-	TArray<FString> SortedKeys;
-	ResolvedReplacementMap.GetKeys(SortedKeys);
-	SortedKeys.Sort(
-		[](const FString& A, const FString& B)
+	return FAruCompiledRedirects{ReplacementMap, InParameters}.Redirect(SourcePath);
+}
+
+FAruCompiledRedirects::FAruCompiledRedirects(const TMap<FString, FString>& InReplacementMap, const FInstancedPropertyBag& InParameters)
+{
+	TMap<FString, FString> ResolvedReplacementMap;
+	for (const TPair<FString, FString>& Pair : InReplacementMap)
+	{
+		ResolvedReplacementMap.Add(
+			UAruFunctionLibrary::ResolveParameterizedString(InParameters, Pair.Key),
+			UAruFunctionLibrary::ResolveParameterizedString(InParameters, Pair.Value));
+	}
+
+	Replacements.Reserve(ResolvedReplacementMap.Num());
+	for (TPair<FString, FString>& Pair : ResolvedReplacementMap)
+	{
+		if (!Pair.Key.IsEmpty())
+		{
+			Replacements.Emplace(MoveTemp(Pair.Key), MoveTemp(Pair.Value));
+		}
+	}
+
+	Replacements.StableSort(
+		[](const TPair<FString, FString>& A, const TPair<FString, FString>& B)
 		{
-			return A.Len() > B.Len();
+			return A.Key.Len() > B.Key.Len();
 		});
+}
+
+FString FAruCompiledRedirects::Redirect(const FString& SourcePath)
+{
+	{
+		FScopeLock ScopeLock{&Lock};
+		if (const FString* Cached = PathMemo.Find(SourcePath))
+		{
+			return *Cached;
+		}
+	}
 
 	TArray<FString> PathSegments;
-	ObjectPtr->GetPathName().ParseIntoArray(PathSegments, TEXT("/"), true);
+	SourcePath.ParseIntoArray(PathSegments, TEXT("/"), true);
 	for (FString& Segment : PathSegments)
 	{
-		FString ModifiedSegment = Segment;
-		for (const FString& Key : SortedKeys)
 		{
-			if (!ModifiedSegment.Contains(Key))
+			FScopeLock ScopeLock{&Lock};
+			if (const FString* Cached = SegmentMemo.Find(Segment))
 			{
+				Segment = *Cached;
 				continue;
 			}
-
-			if (const FString* Replacement = ResolvedReplacementMap.Find(Key))
-			{
-				ModifiedSegment = ModifiedSegment.Replace(*Key, **Replacement, ESearchCase::CaseSensitive);
-			}
 		}
-		Segment = ModifiedSegment;
+
+		FString ModifiedSegment = RedirectSegment(Segment);
+
+		FScopeLock ScopeLock{&Lock};
+		SegmentMemo.Add(Segment, ModifiedSegment);
+		Segment = MoveTemp(ModifiedSegment);
 	}
 
 	FString NewPath = FString::Printf(TEXT("/%s"), *FString::Join(PathSegments, TEXT("/")));
-	const FSoftObjectPath TargetAssetPath{NewPath};
-	if (UObject* LoadedAsset = TargetAssetPath.TryLoad())
+
+	FScopeLock ScopeLock{&Lock};
+	PathMemo.Add(SourcePath, NewPath);
+	return NewPath;
+}
+
+FString FAruCompiledRedirects::RedirectSegment(const FString& Segment) const
+{
+	// Keys are applied longest first, each to the output of the previous one, as the uncompiled table did.
+	FString ModifiedSegment = Segment;
+	for (const TPair<FString, FString>& Replacement : Replacements)
 	{
-		if(!LoadedAsset->IsA(ObjectPtr->GetClass()))
+		if (ModifiedSegment.Contains(Replacement.Key, ESearchCase::CaseSensitive))
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"ClassTypeMismatch",
-					"[{0}][{1}]Property:'{2}' object class:{3}, new object class:{4}."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
-				FText::FromString(ObjectPtr->GetClass()?ObjectPtr->GetClass()->GetName():FString{"NULL"}),
-				FText::FromString(LoadedAsset->GetClass()?LoadedAsset->GetClass()->GetName():FString{"NULL"})
-			));
-
-			return false;
+			ModifiedSegment.ReplaceInline(*Replacement.Key, *Replacement.Value, ESearchCase::CaseSensitive);
 		}
-		
-		ObjectProperty->SetObjectPropertyValue(InValue, LoadedAsset);
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"OperationSucceed",
-					"[{0}][{1}]Previous asset:'{2}', New asset:'{3}' from '{4}'"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(ObjectPtr->GetName()),
-				FText::FromString(LoadedAsset->GetName()),
-				FText::FromString(NewPath)
-			)
-		);
-		return true;
 	}
-
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-		FText::Format(
-			LOCTEXT(
-				"ObjectNotFound",
-				"[{0}][{1}]Property:'{2}'. Object not found by path:'{3}'."),
-			FText::FromString(GetCompactName()),
-			FText::FromString(Aru::ProcessResult::Failed),
-			FText::FromString(InProperty->GetName()),
-			FText::FromString(NewPath)
-		));
-
-	return false;
+	return ModifiedSegment;
 }
+
 #undef LOCTEXT_NAMESPACE
@@ -1,4 +1,6 @@
 ﻿#include "AssetPredicates/AruPredicate_GameplayTag.h"
+#include "AruValueUtils.h"
+#include "AruRunLog.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_GameplayTag)
 
 #define LOCTEXT_NAMESPACE "AruPredicate_GameplayTag"
@@ -10,57 +12,41 @@ bool FAruPredicate_SetGameplayTag::Execute(
 {
 	if (InProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InPropertyNull",
-					"[{0}][{1}]In Property is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InPropertyNull", "[{0}][{1}]In Property is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	if (InValue == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InValueNull",
-					"[{0}][{1}]In Value is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InValueNull", "[{0}][{1}]In Value is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty);
 	if (StructProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetInstancedStructProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a struct property."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetInstancedStructProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a struct property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	const UScriptStruct* SourceStructType = StructProperty->Struct;
 	if (SourceStructType == nullptr || SourceStructType != FGameplayTag::StaticStruct())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetInstancedStructProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a gameplay tag property."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetInstancedStructProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a gameplay tag property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
@@ -73,16 +59,12 @@ bool FAruPredicate_SetGameplayTag::Execute(
 	TOptional<const void*> OptionalValue = GetNewValueBySourceType<FStructProperty>(InParameters, FGameplayTag::StaticStruct());
 	if (!OptionalValue.IsSet())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_NewValueNoFound",
-					"[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
-				FText::FromString(StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource))
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_NewValueNoFound", "[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName(),
+			StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource));
 		return false;
 	}
 	
@@ -92,16 +74,15 @@ bool FAruPredicate_SetGameplayTag::Execute(
 		return false;
 	}
 
-	StructProperty->CopyCompleteValue(InValue, PendingValue);
-	
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-		FText::Format(
-			LOCTEXT(
-				"SetGameplayTag_Result",
-				"[{0}][{1}]Property:'{2}': operation succeeded."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Success)
-		));
+	if (Aru::Value::CopyIfChanged(StructProperty, InValue, PendingValue) != EAruWriteResult::Changed)
+	{
+		return false;
+	}
+
+	ARU_LOG(Info,
+		LOCTEXT("SetGameplayTag_Result", "[{0}][{1}]Property:'{2}': operation succeeded."),
+		GetCompactName(),
+		Aru::ProcessResult::Success);
 	
 	return true;
 }
@@ -113,57 +94,41 @@ bool FAruPredicate_SetGameplayTagContainer::Execute(
 {
 	if (InProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InPropertyNull",
-					"[{0}][{1}]In Property is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InPropertyNull", "[{0}][{1}]In Property is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	if (InValue == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InValueNull",
-					"[{0}][{1}]In Value is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InValueNull", "[{0}][{1}]In Value is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty);
 	if (StructProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetInstancedStructProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a struct property."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetInstancedStructProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a struct property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	const UScriptStruct* SourceStructType = StructProperty->Struct;
 	if (SourceStructType == nullptr || SourceStructType != FGameplayTagContainer::StaticStruct())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetInstancedStructProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a gameplay tag container property."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetInstancedStructProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a gameplay tag container property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
@@ -176,16 +141,12 @@ bool FAruPredicate_SetGameplayTagContainer::Execute(
 	TOptional<const void*> OptionalValue = GetNewValueBySourceType<FStructProperty>(InParameters, FGameplayTagContainer::StaticStruct());
 	if (!OptionalValue.IsSet())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_NewValueNoFound",
-					"[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
-				FText::FromString(StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource))
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_NewValueNoFound", "[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName(),
+			StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource));
 		return false;
 	}
 	
@@ -195,16 +156,15 @@ bool FAruPredicate_SetGameplayTagContainer::Execute(
 		return false;
 	}
 	
-	StructProperty->CopyCompleteValue(InValue, PendingValue);
-
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-		FText::Format(
-			LOCTEXT(
-				"SetGameplayTagContainer_Result",
-				"[{0}][{1}]Property:'{2}': operation succeeded."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Success)
-		));
+	if (Aru::Value::CopyIfChanged(StructProperty, InValue, PendingValue) != EAruWriteResult::Changed)
+	{
+		return false;
+	}
+
+	ARU_LOG(Info,
+		LOCTEXT("SetGameplayTagContainer_Result", "[{0}][{1}]Property:'{2}': operation succeeded."),
+		GetCompactName(),
+		Aru::ProcessResult::Success);
 	
 	return true;
 }
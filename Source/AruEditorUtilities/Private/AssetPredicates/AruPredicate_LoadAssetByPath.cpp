@@ -1,7 +1,9 @@
 ﻿#include "AssetPredicates/AruPredicate_LoadAssetByPath.h"
 
 #include "AruFunctionLibrary.h"
+#include "AruProcessingContext.h"
 
+#include "AruRunLog.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_LoadAssetByPath)
 
 #define LOCTEXT_NAMESPACE "AruPredicate_LoadAssetByPath"
@@ -15,88 +17,153 @@ bool FAruPredicate_LoadAssetByPath::Execute(const FProperty* InProperty, void* I
 
 	if (PathToAsset.IsEmpty())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"ObjectPathEmpty",
-					"[{0}][{1}]Property:'{1}'. Asset path is empty."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("ObjectPathEmpty", "[{0}][{1}]Property:'{1}'. Asset path is empty."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
-	const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(InProperty);
-	if (ObjectProperty == nullptr)
+	if (const FSoftObjectProperty* SoftProperty = CastField<FSoftObjectProperty>(InProperty))
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{1}' is not an uobject."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
-		return false;
+		return AssignSoftReference(SoftProperty, InValue, InParameters);
 	}
 
-	TArray<FString> PathSegments;
-	PathToAsset.ParseIntoArray(PathSegments, TEXT("/"), true);
-	for (auto& Segment : PathSegments)
+	const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(InProperty);
+	if (ObjectProperty == nullptr)
 	{
-		Segment = UAruFunctionLibrary::ResolveParameterizedString(InParameters, Segment);
+		ARU_LOG(Warning,
+			LOCTEXT("PropertyTypeMismatch", "[{0}][{1}]Property:'{1}' is not an uobject."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
+		return false;
 	}
 
-	const FString ResolvedPath = FString::Printf(TEXT("/%s"), *FString::Join(PathSegments, TEXT("/")));
+	const FString ResolvedPath = ResolveAssetPath(InParameters);
 	const FSoftObjectPath TargetAssetPath{ResolvedPath};
-	if (UObject* LoadedAsset = TargetAssetPath.TryLoad())
+	if (UObject* LoadedAsset = FAruAssetCache::LoadAsset(TargetAssetPath))
 	{
 		if (!LoadedAsset->IsA(ObjectProperty->PropertyClass))
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-				FText::Format(
-					LOCTEXT(
-						"ClassTypeMismatch",
-						"[{0}][{1}]Property:'{2}' class:{3}, new object class:{4}."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ObjectProperty->PropertyClass ? ObjectProperty->PropertyClass->GetName() : FString{"NULL"}),
-					FText::FromString(LoadedAsset->GetClass() ? LoadedAsset->GetClass()->GetName() : FString{"NULL"})
-				));
+			ARU_LOG(Warning,
+				LOCTEXT("ClassTypeMismatch", "[{0}][{1}]Property:'{2}' class:{3}, new object class:{4}."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				ObjectProperty->PropertyClass ? ObjectProperty->PropertyClass->GetName() : FString{"NULL"},
+				LoadedAsset->GetClass() ? LoadedAsset->GetClass()->GetName() : FString{"NULL"});
 
 			return false;
 		}
 
+		if (ObjectProperty->GetObjectPropertyValue(InValue) == LoadedAsset)
+		{
+			return false;
+		}
+
 		ObjectProperty->SetObjectPropertyValue(InValue, LoadedAsset);
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"OperationSucceed",
-					"[{0}][{1}]New asset:'{3}' from '{4}'"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(LoadedAsset->GetName()),
-				FText::FromString(ResolvedPath)
-			)
-		);
+		ARU_LOG(Info,
+			LOCTEXT("OperationSucceed", "[{0}][{1}]New asset:'{2}' from '{3}'"),
+			GetCompactName(),
+			Aru::ProcessResult::Success,
+			LoadedAsset->GetFName(),
+			ResolvedPath);
 		return true;
 	}
 
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-		FText::Format(
-			LOCTEXT(
-				"ObjectNotFound",
-				"[{0}][{1}]Property:'{2}'. Object not found by path:'{3}'."),
-			FText::FromString(GetCompactName()),
-			FText::FromString(Aru::ProcessResult::Failed),
-			FText::FromString(InProperty->GetName()),
-			FText::FromString(ResolvedPath)
-		));
+	ARU_LOG(Warning,
+		LOCTEXT("ObjectNotFound", "[{0}][{1}]Property:'{2}'. Object not found by path:'{3}'."),
+		GetCompactName(),
+		Aru::ProcessResult::Failed,
+		InProperty->GetFName(),
+		ResolvedPath);
 
 	return false;
 }
 
+void FAruPredicate_LoadAssetByPath::GatherPreloads(
+	const FProperty* InProperty,
+	const void* InValue,
+	const FInstancedPropertyBag& InParameters,
+	TArray<FSoftObjectPath>& OutPaths) const
+{
+	if (PathToAsset.IsEmpty() || CastField<FObjectProperty>(InProperty) == nullptr)
+	{
+		return;
+	}
+
+	OutPaths.Emplace(ResolveAssetPath(InParameters));
+}
+
+bool FAruPredicate_LoadAssetByPath::AssignSoftReference(
+	const FSoftObjectProperty* SoftProperty,
+	void* InValue,
+	const FInstancedPropertyBag& InParameters) const
+{
+	if (SoftProperty->IsA<FSoftClassProperty>())
+	{
+		ARU_LOG(Warning,
+			LOCTEXT("SoftClassUnsupported", "[{0}][{1}]Property:'{2}' is a soft class reference, which can't be verified without loading."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			SoftProperty->GetFName());
+		return false;
+	}
+
+	const FString ResolvedPath = ResolveAssetPath(InParameters);
+	const FSoftObjectPath TargetAssetPath{ResolvedPath};
+	const FAssetData TargetAssetData = FAruAssetCache::FindAssetData(TargetAssetPath);
+	if (!TargetAssetData.IsValid())
+	{
+		ARU_LOG(Warning,
+			LOCTEXT("ObjectNotFound", "[{0}][{1}]Property:'{2}'. Object not found by path:'{3}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			SoftProperty->GetFName(),
+			ResolvedPath);
+		return false;
+	}
+
+	const UClass* TargetClass = TargetAssetData.GetClass();
+	if (TargetClass == nullptr || !TargetClass->IsChildOf(SoftProperty->PropertyClass))
+	{
+		ARU_LOG(Warning,
+			LOCTEXT("ClassTypeMismatch", "[{0}][{1}]Property:'{2}' class:{3}, new object class:{4}."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			SoftProperty->GetFName(),
+			SoftProperty->PropertyClass ? SoftProperty->PropertyClass->GetName() : FString{"NULL"},
+			TargetAssetData.AssetClassPath.GetAssetName().ToString());
+		return false;
+	}
+
+	if (SoftProperty->GetPropertyValue(InValue).ToSoftObjectPath() == TargetAssetPath)
+	{
+		return false;
+	}
+
+	SoftProperty->SetPropertyValue(InValue, FSoftObjectPtr{TargetAssetPath});
+	ARU_LOG(Info,
+		LOCTEXT("OperationSucceed", "[{0}][{1}]New asset:'{2}' from '{3}'"),
+		GetCompactName(),
+		Aru::ProcessResult::Success,
+		TargetAssetPath.GetAssetName(),
+		ResolvedPath);
+	return true;
+}
+
+FString FAruPredicate_LoadAssetByPath::ResolveAssetPath(const FInstancedPropertyBag& InParameters) const
+{
+	TArray<FString> PathSegments;
+	PathToAsset.ParseIntoArray(PathSegments, TEXT("/"), true);
+	for (auto& Segment : PathSegments)
+	{
+		Segment = UAruFunctionLibrary::ResolveParameterizedString(InParameters, Segment);
+	}
+
+	return FString::Printf(TEXT("/%s"), *FString::Join(PathSegments, TEXT("/")));
+}
+
 #undef LOCTEXT_NAMESPACE
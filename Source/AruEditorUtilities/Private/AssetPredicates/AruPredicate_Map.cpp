@@ -1,4 +1,7 @@
 ﻿#include "AssetPredicates/AruPredicate_Map.h"
+#include "AruContainerUtils.h"
+#include "AruProcessingContext.h"
+#include "AruRunLog.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_Map)
 
 #define LOCTEXT_NAMESPACE "AruPredicate_Map"
@@ -11,29 +14,21 @@ bool FAruPredicate_AddMapPair::Execute(
 	const FMapProperty* MapProperty = CastField<FMapProperty>(InProperty);
 	if (MapProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"AddToMap_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a map."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("AddToMap_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a map."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	if (PredicatesForKey.Num() == 0)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"AddToMap_NoPredicatesForKey",
-					"[{0}][{1}]Map:'{2}'. At least one predicate is required to complete the process."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("AddToMap_NoPredicatesForKey", "[{0}][{1}]Map:'{2}'. At least one predicate is required to complete the process."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
@@ -41,43 +36,26 @@ bool FAruPredicate_AddMapPair::Execute(
 	FProperty* ValueProperty = MapProperty->ValueProp;
 	if (KeyProperty == nullptr || ValueProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"AddToMap_ErrorSetup",
-					"[{0}][{1}]Map:'{2}'. Can't get map inner property."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Error,
+			LOCTEXT("AddToMap_ErrorSetup", "[{0}][{1}]Map:'{2}'. Can't get map inner property."),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
 		return false;
 	}
 
-	void* PendingKeyPtr = FMemory::Malloc(KeyProperty->GetSize());
+	const FAruScopedScratchValue PendingKey{KeyProperty};
+	void* PendingKeyPtr = PendingKey.Get();
 	if (PendingKeyPtr == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"AddToMap_MallocFailed",
-					"[{0}][{1}]Map:'{2}'. Malloc memory for key failed."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Error,
+			LOCTEXT("AddToMap_MallocFailed", "[{0}][{1}]Map:'{2}'. Malloc memory for key failed."),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
 		return false;
 	}
-	KeyProperty->InitializeValue(PendingKeyPtr);
-
-	ON_SCOPE_EXIT
-	{
-		KeyProperty->DestroyValue(PendingKeyPtr);
-		FMemory::Free(PendingKeyPtr);
-	};
-
 	bool bExecutedSuccessfully = false;
-
-	KeyProperty->InitializeValue(PendingKeyPtr);
 	for (auto& Predicate : PredicatesForKey)
 	{
 		if (const FAruPredicate* PredicatePtr = Predicate.GetPtr<FAruPredicate>())
@@ -88,30 +66,22 @@ bool FAruPredicate_AddMapPair::Execute(
 
 	if (bExecutedSuccessfully == false)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"AddToMap_ExecutionFailure",
-					"[{0}][{1}]Map:'{2}'. Predicate(s) for key executed failed."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("AddToMap_ExecutionFailure", "[{0}][{1}]Map:'{2}'. Predicate(s) for key executed failed."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	FScriptMapHelper MapHelper{MapProperty, InValue};
 	if (MapHelper.FindMapPairIndexFromHash(PendingKeyPtr) != INDEX_NONE)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"AddToMap_DuplicateKeys",
-					"[{0}][{1}]The key pending to add already existed in this map:'{2}'."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("AddToMap_DuplicateKeys", "[{0}][{1}]The key pending to add already existed in this map:'{2}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
@@ -120,15 +90,11 @@ bool FAruPredicate_AddMapPair::Execute(
 	{
 		MapHelper.RemoveAt(NewElementIndex);
 
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"AddToMap_AddFailed",
-					"[{0}][{1}]Failed to add new pair to map:'{2}'"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Error,
+			LOCTEXT("AddToMap_AddFailed", "[{0}][{1}]Failed to add new pair to map:'{2}'"),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
 
 		return false;
 	}
@@ -143,15 +109,11 @@ bool FAruPredicate_AddMapPair::Execute(
 	{
 		MapHelper.RemoveAt(NewElementIndex);
 
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"AddToMap_GetKeyFailed",
-					"[{0}][{1}]Failed to get new key from map:'{2}'"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Error,
+			LOCTEXT("AddToMap_GetKeyFailed", "[{0}][{1}]Failed to get new key from map:'{2}'"),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
 
 		return false;
 	}
@@ -162,15 +124,11 @@ bool FAruPredicate_AddMapPair::Execute(
 	{
 		MapHelper.RemoveAt(NewElementIndex);
 
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"AddToMap_GetValueFailed",
-					"[{0}][{1}]Failed to get new value from map:'{2}'"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Error,
+			LOCTEXT("AddToMap_GetValueFailed", "[{0}][{1}]Failed to get new value from map:'{2}'"),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
 
 		return false;
 	}
@@ -183,15 +141,11 @@ bool FAruPredicate_AddMapPair::Execute(
 		}
 	}
 
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-		FText::Format(
-			LOCTEXT(
-				"AddToMap_Result.",
-				"[{0}][{1}]Added element to map:'{2}'."),
-			FText::FromString(GetCompactName()),
-			FText::FromString(Aru::ProcessResult::Success),
-			FText::FromString(InProperty->GetName())
-		));
+	ARU_LOG(Info,
+		LOCTEXT("AddToMap_Result.", "[{0}][{1}]Added element to map:'{2}'."),
+		GetCompactName(),
+		Aru::ProcessResult::Success,
+		InProperty->GetFName());
 
 	return bExecutedSuccessfully;
 }
@@ -204,29 +158,21 @@ bool FAruPredicate_RemoveMapPair::Execute(
 	const FMapProperty* MapProperty = CastField<FMapProperty>(InProperty);
 	if (MapProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"RemoveFromMap_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a map."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("RemoveFromMap_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a map."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	if (KeyFilters.Num() == 0 && ValueFilters.Num() == 0)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"RemoveFromMap_NoFilters",
-					"[{0}][{1}]Map:'{2}'. At least one filter is required to complete the process."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("RemoveFromMap_NoFilters", "[{0}][{1}]Map:'{2}'. At least one filter is required to complete the process."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
@@ -234,15 +180,11 @@ bool FAruPredicate_RemoveMapPair::Execute(
 	const FProperty* ValueProperty = MapProperty->ValueProp;
 	if (KeyProperty == nullptr || ValueProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"RemoveFromMap_ErrorSetup",
-					"[{0}][{1}]Map:'{2}'. Can't get map inner property."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Error,
+			LOCTEXT("RemoveFromMap_ErrorSetup", "[{0}][{1}]Map:'{2}'. Can't get map inner property."),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
 		return false;
 	}
 
@@ -279,42 +221,32 @@ bool FAruPredicate_RemoveMapPair::Execute(
 		return true;
 	};
 
-	TArray<int32> PendingRemove;
+	// Removing from the sparse storage doesn't shift the other pairs, so matches are removed during the scan
+	// and the hash is rebuilt once at the end.
+	int32 RemovedCount = 0;
 	FScriptMapHelper MapHelper{MapProperty, InValue};
-
-	ON_SCOPE_EXIT
+	for (int32 Index = 0; Index < MapHelper.GetMaxIndex(); ++Index)
 	{
-		MapHelper.Rehash();
-	};
-
-	for (int32 Index = 0; Index < MapHelper.Num(); ++Index)
-	{
-		void* MapKeyPtr = MapHelper.GetKeyPtr(Index);
-		void* MapValuePtr = MapHelper.GetValuePtr(Index);
-
-		if (ShouldRemove(MapKeyPtr, MapValuePtr))
+		if (MapHelper.IsValidIndex(Index) && ShouldRemove(MapHelper.GetKeyPtr(Index), MapHelper.GetValuePtr(Index)))
 		{
-			PendingRemove.Add(Index);
+			MapHelper.RemoveAt(Index);
+			RemovedCount++;
 		}
 	}
 
-	for (int32& Index : PendingRemove)
+	if (RemovedCount > 0)
 	{
-		MapHelper.RemoveAt(Index);
+		MapHelper.Rehash();
 	}
 
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-		FText::Format(
-			LOCTEXT(
-				"RemoveFromMap_Result.",
-				"[{0}][{1}]Removed {2} element(s) from map:'{3}'."),
-			FText::FromString(GetCompactName()),
-			FText::FromString(PendingRemove.Num() > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed),
-			PendingRemove.Num(),
-			FText::FromString(InProperty->GetName()))
-	);
-
-	return PendingRemove.Num() > 0;
+	ARU_LOG(Info,
+		LOCTEXT("RemoveFromMap_Result.", "[{0}][{1}]Removed {2} element(s) from map:'{3}'."),
+		GetCompactName(),
+		RemovedCount > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed,
+		RemovedCount,
+		InProperty->GetFName());
+
+	return RemovedCount > 0;
 }
 
 bool FAruPredicate_ModifyMapPair::Execute(
@@ -325,29 +257,21 @@ bool FAruPredicate_ModifyMapPair::Execute(
 	const FMapProperty* MapProperty = CastField<FMapProperty>(InProperty);
 	if (MapProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"ModifyMapValue_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a map."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("ModifyMapValue_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a map."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	if (KeyFilters.Num() == 0 && ValueFilters.Num() == 0)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"ModifyMapValue_NoFilters",
-					"[{0}][{1}]Map:'{2}'. At least one filter is required to complete the process."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("ModifyMapValue_NoFilters", "[{0}][{1}]Map:'{2}'. At least one filter is required to complete the process."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
@@ -355,15 +279,11 @@ bool FAruPredicate_ModifyMapPair::Execute(
 	const FProperty* ValueProperty = MapProperty->ValueProp;
 	if (KeyProperty == nullptr || ValueProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"ModifyMapValue_ErrorSetup",
-					"[{0}][{1}]Map:'{2}'. Can't get map inner property."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Error,
+			LOCTEXT("ModifyMapValue_ErrorSetup", "[{0}][{1}]Map:'{2}'. Can't get map inner property."),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
 		return false;
 	}
 
@@ -402,52 +322,35 @@ bool FAruPredicate_ModifyMapPair::Execute(
 
 	TArray<int32> PendingToModify;
 	FScriptMapHelper MapHelper{MapProperty, InValue};
-
-	ON_SCOPE_EXIT
+	for (int32 Index = 0; Index < MapHelper.GetMaxIndex(); ++Index)
 	{
-		MapHelper.Rehash();
-	};
-
-	for (int32 Index = 0; Index < MapHelper.Num(); ++Index)
-	{
-		void* MapKeyPtr = MapHelper.GetKeyPtr(Index);
-		void* MapValuePtr = MapHelper.GetValuePtr(Index);
-
-		if (ShouldModify(MapKeyPtr, MapValuePtr))
+		if (MapHelper.IsValidIndex(Index) && ShouldModify(MapHelper.GetKeyPtr(Index), MapHelper.GetValuePtr(Index)))
 		{
 			PendingToModify.Add(Index);
 		}
 	}
 
-	int32 ModifiedCount = 0;
-	for (int32& Index : PendingToModify)
+	// Stage every new key first, so the map is written and rehashed once instead of per pair.
+	const FAruScratchArray PendingKeys{KeyProperty, PredicatesForKey.Num() > 0 ? PendingToModify.Num() : 0};
+	if (!PendingKeys.IsValid())
 	{
-		void* MapKeyPtr = MapHelper.GetKeyPtr(Index);
-		void* PendingKeyPtr = FMemory::Malloc(KeyProperty->GetSize());
-		if (PendingKeyPtr == nullptr)
-		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"ModifyMapValue_MallocFailed",
-					"[{0}][{1}]Map:'{2}'. Malloc memory for key failed."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
-			
-			return false;
-		}
-		KeyProperty->InitializeValue(PendingKeyPtr);
+		ARU_LOG(Error,
+			LOCTEXT("ModifyMapValue_MallocFailed", "[{0}][{1}]Map:'{2}'. Malloc memory for key failed."),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
+		
+		return false;
+	}
 
-		ON_SCOPE_EXIT
-		{
-			KeyProperty->DestroyValue(PendingKeyPtr);
-			FMemory::Free(PendingKeyPtr);
-		};
+	TArray<int32> ChangedIndices;
+	TArray<const void*> StagedKeys;
+	for (int32 Slot = 0; Slot < PendingKeys.Num(); ++Slot)
+	{
+		void* PendingKeyPtr = PendingKeys.GetRawPtr(Slot);
+		KeyProperty->CopyCompleteValue(PendingKeyPtr, MapHelper.GetKeyPtr(PendingToModify[Slot]));
 
 		bool bKeyChanged = false;
-		KeyProperty->CopyCompleteValue(PendingKeyPtr, MapKeyPtr);
 		for (auto& Predicate : PredicatesForKey)
 		{
 			if (const FAruPredicate* PredicatePtr = Predicate.GetPtr<FAruPredicate>())
@@ -456,25 +359,51 @@ bool FAruPredicate_ModifyMapPair::Execute(
 			}
 		}
 
-		if (bKeyChanged == true)
+		if (bKeyChanged)
 		{
-			if (MapHelper.FindMapPairIndexFromHash(PendingKeyPtr) != INDEX_NONE)
-			{
-				FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-					FText::Format(
-						LOCTEXT(
-							"ModifyMapValue_DuplicateKeys",
-							"[{0}][{1}]The key pending to set already existed in this map:'{2}'."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
-					));
-				continue;
-			}
-			else
-			{
-				KeyProperty->CopyCompleteValue(MapKeyPtr, PendingKeyPtr);
-			}
+			ChangedIndices.Add(PendingToModify[Slot]);
+			StagedKeys.Add(PendingKeyPtr);
+		}
+	}
+
+	const TBitArray<> Accepted = Aru::Container::ResolveStagedKeys(
+		KeyProperty,
+		MapHelper.GetMaxIndex(),
+		[&MapHelper](int32 Index) -> const void* { return MapHelper.IsValidIndex(Index) ? MapHelper.GetKeyPtr(Index) : nullptr; },
+		ChangedIndices,
+		StagedKeys);
+
+	TSet<int32> RejectedIndices;
+	TSet<int32> KeyChangedIndices;
+	for (int32 ChangeIndex = 0; ChangeIndex < ChangedIndices.Num(); ++ChangeIndex)
+	{
+		if (!Accepted[ChangeIndex])
+		{
+			ARU_LOG(Warning,
+				LOCTEXT("ModifyMapValue_DuplicateKeys", "[{0}][{1}]The key pending to set already existed in this map:'{2}'."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName());
+			RejectedIndices.Add(ChangedIndices[ChangeIndex]);
+			continue;
+		}
+
+		KeyProperty->CopyCompleteValue(MapHelper.GetKeyPtr(ChangedIndices[ChangeIndex]), StagedKeys[ChangeIndex]);
+		KeyChangedIndices.Add(ChangedIndices[ChangeIndex]);
+	}
+
+	if (KeyChangedIndices.Num() > 0)
+	{
+		MapHelper.Rehash();
+	}
+
+	// Values don't take part in hashing, so they are modified in place after the keys settled.
+	int32 ModifiedCount = 0;
+	for (const int32 Index : PendingToModify)
+	{
+		if (RejectedIndices.Contains(Index))
+		{
+			continue;
 		}
 
 		bool bValueChanged = false;
@@ -487,22 +416,67 @@ bool FAruPredicate_ModifyMapPair::Execute(
 			}
 		}
 
-		ModifiedCount += bKeyChanged || bValueChanged ? 1 : 0;
-		MapHelper.Rehash();
+		ModifiedCount += KeyChangedIndices.Contains(Index) || bValueChanged ? 1 : 0;
 	}
 
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-		FText::Format(
-			LOCTEXT(
-				"ModifyMapValue_Result",
-				"[{0}][{1}]Map:'{2}': {3} element(s) matched, {4} modified'."),
-			FText::FromString(GetCompactName()),
-			FText::FromString(ModifiedCount > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed),
-			FText::FromString(InProperty->GetName()),
-			PendingToModify.Num(),
-			ModifiedCount
-		));
+	ARU_LOG(Info,
+		LOCTEXT("ModifyMapValue_Result", "[{0}][{1}]Map:'{2}': {3} element(s) matched, {4} modified'."),
+		GetCompactName(),
+		ModifiedCount > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed,
+		InProperty->GetFName(),
+		PendingToModify.Num(),
+		ModifiedCount);
 
 	return ModifiedCount > 0;
 }
+
+void FAruPredicate_AddMapPair::GatherPreloads(
+	const FProperty* InProperty,
+	const void* InValue,
+	const FInstancedPropertyBag& InParameters,
+	TArray<FSoftObjectPath>& OutPaths) const
+{
+	const FMapProperty* MapProperty = CastField<FMapProperty>(InProperty);
+	if (MapProperty == nullptr)
+	{
+		return;
+	}
+
+	const FAruScopedScratchValue PendingKey{MapProperty->KeyProp};
+	if (PendingKey.IsValid())
+	{
+		Aru::GatherPreloads(PredicatesForKey, MapProperty->KeyProp, PendingKey.Get(), InParameters, OutPaths);
+	}
+
+	const FAruScopedScratchValue PendingValue{MapProperty->ValueProp};
+	if (PendingValue.IsValid())
+	{
+		Aru::GatherPreloads(PredicatesForValue, MapProperty->ValueProp, PendingValue.Get(), InParameters, OutPaths);
+	}
+}
+
+void FAruPredicate_ModifyMapPair::GatherPreloads(
+	const FProperty* InProperty,
+	const void* InValue,
+	const FInstancedPropertyBag& InParameters,
+	TArray<FSoftObjectPath>& OutPaths) const
+{
+	const FMapProperty* MapProperty = CastField<FMapProperty>(InProperty);
+	if (MapProperty == nullptr || InValue == nullptr)
+	{
+		return;
+	}
+
+	// Pair filters are left to the write pass, so every pair reports what it could load.
+	FScriptMapHelper MapHelper{MapProperty, InValue};
+	for (int32 Index = 0; Index < MapHelper.GetMaxIndex(); ++Index)
+	{
+		if (MapHelper.IsValidIndex(Index))
+		{
+			Aru::GatherPreloads(PredicatesForKey, MapProperty->KeyProp, MapHelper.GetKeyPtr(Index), InParameters, OutPaths);
+			Aru::GatherPreloads(PredicatesForValue, MapProperty->ValueProp, MapHelper.GetValuePtr(Index), InParameters, OutPaths);
+		}
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,62 @@
+#include "AssetPredicates/AruPredicate_MathStruct.h"
+#include "AruMathUtils.h"
+#include "AruRunLog.h"
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_MathStruct)
+
+#define LOCTEXT_NAMESPACE "AruPredicate_MathStruct"
+
+bool FAruPredicate_MathStruct::Execute(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const
+{
+	if (InProperty == nullptr || InValue == nullptr)
+	{
+		return false;
+	}
+
+	const EAruMathStruct Type = Aru::Math::GetMathStructType(InProperty);
+	if (Type == EAruMathStruct::None)
+	{
+		ARU_LOG(Warning,
+			LOCTEXT("PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a vector, rotator, linear color or transform."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
+		return false;
+	}
+
+	const VectorRegister4Double PreviousValue = Aru::Math::Load(Type, InValue, TransformComponent);
+	const VectorRegister4Double NewValue = Apply(PreviousValue);
+	if (!Aru::Math::StoreIfChanged(Type, InValue, TransformComponent, NewValue))
+	{
+		return false;
+	}
+
+	FVector4 PreviousComponents;
+	FVector4 NewComponents;
+	VectorStore(PreviousValue, &PreviousComponents.X);
+	VectorStore(NewValue, &NewComponents.X);
+	ARU_LOG(Info,
+		LOCTEXT("OperationSucceed", "[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
+		GetCompactName(),
+		Aru::ProcessResult::Success,
+		InProperty->GetFName(),
+		PreviousComponents.ToString(),
+		NewComponents.ToString());
+	return true;
+}
+
+VectorRegister4Double FAruPredicate_ScaleMathStruct::Apply(const VectorRegister4Double& Value) const
+{
+	return VectorMultiply(Value, VectorLoad(&Factor.X));
+}
+
+VectorRegister4Double FAruPredicate_OffsetMathStruct::Apply(const VectorRegister4Double& Value) const
+{
+	return VectorAdd(Value, VectorLoad(&Offset.X));
+}
+
+VectorRegister4Double FAruPredicate_ClampMathStruct::Apply(const VectorRegister4Double& Value) const
+{
+	return VectorMin(VectorMax(Value, VectorLoad(&Min.X)), VectorLoad(&Max.X));
+}
+
+#undef LOCTEXT_NAMESPACE
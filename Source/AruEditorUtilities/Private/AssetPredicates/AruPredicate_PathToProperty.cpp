@@ -1,5 +1,6 @@
 ﻿#include "AssetPredicates/AruPredicate_PathToProperty.h"
 #include "AruFunctionLibrary.h"
+#include "AruRunLog.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_PathToProperty)
 
 #define LOCTEXT_NAMESPACE "AruPredicate_PathToProperty"
@@ -14,26 +15,15 @@ bool FAruPredicate_PathToProperty::Execute(
 		return false;
 	}
 
-	TArray<FString> PropertyChain;
-	PathToProperty.ParseIntoArray(PropertyChain, TEXT("."), true);
-	for (auto& Element : PropertyChain)
-	{
-		Element = UAruFunctionLibrary::ResolveParameterizedString(InParameters, Element);
-	}
-	const FString&& ResolvedPath = FString::Join(PropertyChain, TEXT("."));
-
+	const FString ResolvedPath = ResolvePath(InParameters);
 	FAruPropertyContext PropertyContext = UAruFunctionLibrary::FindPropertyByPath(InProperty, InValue, ResolvedPath);
 	if (!PropertyContext.IsValid())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"NoPropertyFound",
-					"[{0}][{1}]Failed to find property by path:'{2}'."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(ResolvedPath)
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("NoPropertyFound", "[{0}][{1}]Failed to find property by path:'{2}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			ResolvedPath);
 
 		return false;
 	}
@@ -41,21 +31,52 @@ bool FAruPredicate_PathToProperty::Execute(
 	bool bExecutedSuccessfully = false;
 	if (const FAruPredicate* PredicatePtr = Predicate.GetPtr<FAruPredicate>())
 	{
-		bExecutedSuccessfully |= PredicatePtr->Execute(PropertyContext.PropertyPtr, PropertyContext.ValuePtr.GetValue(), InParameters);
+		bExecutedSuccessfully |= UAruFunctionLibrary::WriteFoundProperty(PropertyContext,
+			[PredicatePtr, &InParameters](const FProperty* InFoundProperty, void* InFoundValue)
+			{
+				return PredicatePtr->Execute(InFoundProperty, InFoundValue, InParameters);
+			});
 	}
 
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-		FText::Format(
-			LOCTEXT(
-				"PathToProperty_Result",
-				"[{0}][{1}]Found property:'{2}' by Path:'{3}'. Execution {4}"),
-			FText::FromString(GetCompactName()),
-			FText::FromString(Aru::ProcessResult::Failed),
-			FText::FromString(PropertyContext.PropertyPtr->GetName()),
-			FText::FromString(ResolvedPath),
-			bExecutedSuccessfully ? LOCTEXT("Succeed", "Succeed") : LOCTEXT("Failure", "Failure")
-		));
+	ARU_LOG(Info,
+		LOCTEXT("PathToProperty_Result", "[{0}][{1}]Found property:'{2}' by Path:'{3}'. Execution {4}"),
+		GetCompactName(),
+		Aru::ProcessResult::Failed,
+		PropertyContext.PropertyPtr->GetFName(),
+		ResolvedPath,
+		bExecutedSuccessfully ? LOCTEXT("Succeed", "Succeed") : LOCTEXT("Failure", "Failure"));
 
 	return bExecutedSuccessfully;
 }
+
+void FAruPredicate_PathToProperty::GatherPreloads(
+	const FProperty* InProperty,
+	const void* InValue,
+	const FInstancedPropertyBag& InParameters,
+	TArray<FSoftObjectPath>& OutPaths) const
+{
+	const FAruPredicate* PredicatePtr = Predicate.GetPtr<const FAruPredicate>();
+	if (PathToProperty.IsEmpty() || InValue == nullptr || PredicatePtr == nullptr)
+	{
+		return;
+	}
+
+	const FAruPropertyContext PropertyContext = UAruFunctionLibrary::FindPropertyByPath(InProperty, InValue, ResolvePath(InParameters));
+	if (PropertyContext.IsValid())
+	{
+		PredicatePtr->GatherPreloads(PropertyContext.PropertyPtr, PropertyContext.ValuePtr.GetValue(), InParameters, OutPaths);
+	}
+}
+
+FString FAruPredicate_PathToProperty::ResolvePath(const FInstancedPropertyBag& InParameters) const
+{
+	TArray<FString> PropertyChain;
+	PathToProperty.ParseIntoArray(PropertyChain, TEXT("."), true);
+	for (auto& Element : PropertyChain)
+	{
+		Element = UAruFunctionLibrary::ResolveParameterizedString(InParameters, Element);
+	}
+	return FString::Join(PropertyChain, TEXT("."));
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -1,6 +1,8 @@
 #include "AssetPredicates/AruPredicate_PropertySetter.h"
 #include "AruFunctionLibrary.h"
+#include "AruValueUtils.h"
 #include "UObject/PropertyAccessUtil.h"
+#include "AruRunLog.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_PropertySetter)
 
 #define LOCTEXT_NAMESPACE "AruPredicate_PropertySetter"
@@ -94,32 +96,24 @@ TOptional<const void*> FAruPredicate_PropertySetter::GetValueFromStructProperty(
 
 	if (!TargetProperty->IsA(SourceProperty))
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_PropertyTypeMismatch",
-					"[{0}][{1}]Mismatch between target:'{2}' and source:'{3}' property types."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(TargetProperty->GetName()),
-				FText::FromString(SourceProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_PropertyTypeMismatch", "[{0}][{1}]Mismatch between target:'{2}' and source:'{3}' property types."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			TargetProperty->GetFName(),
+			SourceProperty->GetFName());
 		return {};
 	}
 
 	const void* PropertyValue = TargetProperty->ContainerPtrToValuePtr<void>(this);
 	if (!IsCompatibleType(TargetProperty, PropertyValue, SourceType))
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_PropertyValueMismatch",
-					"[{0}][{1}]Mismatch between target:'{2}' and source:'{3}' value types."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(TargetProperty->GetName()),
-				FText::FromString(SourceProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_PropertyValueMismatch", "[{0}][{1}]Mismatch between target:'{2}' and source:'{3}' value types."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			TargetProperty->GetFName(),
+			SourceProperty->GetFName());
 		return {};
 	}
 
@@ -133,27 +127,19 @@ TOptional<const void*> FAruPredicate_PropertySetter::GetValueFromObjectAsset(
 {
 	if (PathToProperty.IsEmpty())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_PathEmpty",
-					"[{0}][{1}]PathToProperty Empty, please check your config."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed)
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_PathEmpty", "[{0}][{1}]PathToProperty Empty, please check your config."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed);
 		return {};
 	}
 
 	if (Object == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_ObjectNull",
-					"[{0}][{1}]Object is NULL, please check your config."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed)
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_ObjectNull", "[{0}][{1}]Object is NULL, please check your config."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed);
 		return {};
 	}
 
@@ -176,47 +162,35 @@ TOptional<const void*> FAruPredicate_PropertySetter::GetValueFromObjectAsset(
 	auto&& PropertyContext = UAruFunctionLibrary::FindPropertyByPath(NativeClass, NativeObject, ResolvedPath);
 	if (!PropertyContext.IsValid())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_NoPropertyFound",
-					"[{0}][{1}]Can't find property by path: '{2}' in object: '{3}'."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(ResolvedPath),
-				FText::FromString(Object.GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_NoPropertyFound", "[{0}][{1}]Can't find property by path: '{2}' in object: '{3}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			ResolvedPath,
+			Object.GetFName());
 		return {};
 	}
 
 	if (!PropertyContext.PropertyPtr->IsA(SourceProperty))
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_PropertyTypeMismatch",
-					"[{0}][{1}]Mismatch between target:'{2}' and source:'{3}' property types."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(PropertyContext.PropertyPtr->GetName()),
-				FText::FromString(SourceProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_PropertyTypeMismatch", "[{0}][{1}]Mismatch between target:'{2}' and source:'{3}' property types."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			PropertyContext.PropertyPtr->GetFName(),
+			SourceProperty->GetFName());
 
 		return {};
 	}
 
 	if (!IsCompatibleType(PropertyContext.PropertyPtr, PropertyContext.ValuePtr.GetValue(), SourceType))
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_PropertyValueMismatch",
-					"[{0}][{1}]Mismatch between target:'{2}' and source:'{3}' value types."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(PropertyContext.PropertyPtr->GetName()),
-				FText::FromString(SourceProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_PropertyValueMismatch", "[{0}][{1}]Mismatch between target:'{2}' and source:'{3}' value types."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			PropertyContext.PropertyPtr->GetFName(),
+			SourceProperty->GetFName());
 
 		return {};
 	}
@@ -231,66 +205,52 @@ TOptional<const void*> FAruPredicate_PropertySetter::GetValueFromDataTable(
 {
 	if (PathToProperty.IsEmpty())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_PathEmpty",
-					"[{0}][{1}]PathToProperty Empty, please check your config."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed)
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_PathEmpty", "[{0}][{1}]PathToProperty Empty, please check your config."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed);
 		return {};
 	}
 
 	if (DataTable == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_DataTableNull",
-					"[{0}][{1}]DataTable is NULL, please check your config."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed)
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_DataTableNull", "[{0}][{1}]DataTable is NULL, please check your config."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed);
 		return {};
 	}
 
 	if (RowName.IsEmpty())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_RowNameEmpty",
-					"[{0}][{1}]RowName Empty, please check your config."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed)
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_RowNameEmpty", "[{0}][{1}]RowName Empty, please check your config."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed);
 	}
 
 	const FString&& ResolvedRowName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, RowName);
 	uint8* const* RowStructPtr = DataTable->GetRowMap().Find(FName{ResolvedRowName});
 	if (RowStructPtr == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT("PropertySetter_FindRowFailed", "[{0}][{1}]Can't find row: '{2}' in DataTable: '{3}'."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(ResolvedRowName),
-				FText::FromName(DataTable.GetFName())));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_FindRowFailed", "[{0}][{1}]Can't find row: '{2}' in DataTable: '{3}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			ResolvedRowName,
+			DataTable.GetFName());
 		return {};
 	}
 
 	const uint8* RowStruct = *RowStructPtr;
 	if (RowStruct == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT("PropertySetter_FindRowFailed", "[{0}][{1}]Can't find row: '{2}' in DataTable: '{3}'."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(ResolvedRowName),
-				FText::FromName(DataTable.GetFName())));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_FindRowFailed", "[{0}][{1}]Can't find row: '{2}' in DataTable: '{3}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			ResolvedRowName,
+			DataTable.GetFName());
 		return {};
 	}
 
@@ -305,43 +265,34 @@ TOptional<const void*> FAruPredicate_PropertySetter::GetValueFromDataTable(
 	auto&& PropertyContext = UAruFunctionLibrary::FindPropertyByPath(DataTable->RowStruct, RowStruct, ResolvedPath);
 	if (!PropertyContext.IsValid())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT("PropertySetter_NoPropertyFoundInStruct", "[{0}][{1}]Can't find property by path: '{2}' in struct: '{3}'."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(PathToProperty),
-				FText::FromName(DataTable->RowStruct.GetFName())));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_NoPropertyFoundInStruct", "[{0}][{1}]Can't find property by path: '{2}' in struct: '{3}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			PathToProperty,
+			DataTable->RowStruct.GetFName());
 		return {};
 	}
 
 	if (!PropertyContext.PropertyPtr->IsA(SourceProperty))
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_PropertyTypeMismatch",
-					"[{0}][{1}]Mismatch between target:'{2}' and source:'{3}' property types."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(PropertyContext.PropertyPtr->GetName()),
-				FText::FromString(SourceProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_PropertyTypeMismatch", "[{0}][{1}]Mismatch between target:'{2}' and source:'{3}' property types."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			PropertyContext.PropertyPtr->GetFName(),
+			SourceProperty->GetFName());
 		return {};
 	}
 
 	if (!IsCompatibleType(PropertyContext.PropertyPtr, PropertyContext.ValuePtr.GetValue(), SourceType))
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_PropertyValueMismatch",
-					"[{0}][{1}]Mismatch between target:'{2}' and source:'{3}' value types."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(PropertyContext.PropertyPtr->GetName()),
-				FText::FromString(SourceProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_PropertyValueMismatch", "[{0}][{1}]Mismatch between target:'{2}' and source:'{3}' value types."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			PropertyContext.PropertyPtr->GetFName(),
+			SourceProperty->GetFName());
 		return {};
 	}
 
@@ -355,46 +306,34 @@ bool FAruPredicate_SetBoolValue::Execute(
 {
 	if (InProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InPropertyNull",
-					"[{0}][{1}]In Property is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InPropertyNull", "[{0}][{1}]In Property is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	if (InValue == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InValueNull",
-					"[{0}][{1}]In Value is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InValueNull", "[{0}][{1}]In Value is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	const FBoolProperty* BoolProperty = CastField<FBoolProperty>(InProperty);
 	if (BoolProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetBoolProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a bool property."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetBoolProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a bool property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
-	bool Result = false;
+	EAruWriteResult WriteResult = EAruWriteResult::Failed;
 	const bool PreviousValue = BoolProperty->GetPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
@@ -402,54 +341,41 @@ bool FAruPredicate_SetBoolValue::Execute(
 		TValueOrError<bool, EPropertyBagResult> ParameterValue = InParameters.GetValueBool(FName{ResolvedParameterName});
 		if (!ParameterValue.HasValue())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-				FText::Format(
-					LOCTEXT(
-						"NoPropertyFoundInParameter",
-						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
-				));
+			ARU_LOG(Warning,
+				LOCTEXT("NoPropertyFoundInParameter", "[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				ResolvedParameterName);
 			return false;
 		}
-		BoolProperty->SetPropertyValue(InValue, ParameterValue.GetValue());
-		Result = true;
+		WriteResult = Aru::Value::WriteIfChanged(BoolProperty, InValue, [&](void* PendingValue) { BoolProperty->SetPropertyValue(PendingValue, ParameterValue.GetValue()); });
 	}
 	else
 	{
-		Result = SetPropertyValue<FBoolProperty>(InProperty, InValue, InParameters);
+		WriteResult = SetPropertyValue<FBoolProperty>(InProperty, InValue, InParameters);
 	}
 
-	if (Result == true)
+	if (WriteResult == EAruWriteResult::Changed)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"SetBoolProperty_Success",
-					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
-				PreviousValue ? LOCTEXT("True", "True") : LOCTEXT("False", "False"),
-				BoolProperty->GetPropertyValue(InValue) ? LOCTEXT("True", "True") : LOCTEXT("False", "False")
-			));
+		ARU_LOG(Info,
+			LOCTEXT("SetBoolProperty_Success", "[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
+			GetCompactName(),
+			Aru::ProcessResult::Success,
+			InProperty->GetFName(),
+			PreviousValue ? LOCTEXT("True", "True") : LOCTEXT("False", "False"),
+			BoolProperty->GetPropertyValue(InValue) ? LOCTEXT("True", "True") : LOCTEXT("False", "False"));
 	}
-	else
+	else if (WriteResult == EAruWriteResult::Failed)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetProperty_Failed",
-					"[{0}][{1}]Property:'{2}' operation failure."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetProperty_Failed", "[{0}][{1}]Property:'{2}' operation failure."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 	}
 
-	return Result;
+	return WriteResult == EAruWriteResult::Changed;
 }
 
 bool FAruPredicate_SetFloatValue::Execute(
@@ -459,60 +385,44 @@ bool FAruPredicate_SetFloatValue::Execute(
 {
 	if (InProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InPropertyNull",
-					"[{0}][{1}]In Property is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InPropertyNull", "[{0}][{1}]In Property is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	if (InValue == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InValueNull",
-					"[{0}][{1}]In Value is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InValueNull", "[{0}][{1}]In Value is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	const FNumericProperty* NumericProperty = CastField<FNumericProperty>(InProperty);
 	if (NumericProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetFloatProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a bool property."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetFloatProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a bool property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	if (!NumericProperty->IsFloatingPoint())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetFloatProperty_NumericTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a float property."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetFloatProperty_NumericTypeMismatch", "[{0}][{1}]Property:'{2}' is not a float property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
-	bool Result = false;
+	EAruWriteResult WriteResult = EAruWriteResult::Failed;
 	const float PreviousValue = NumericProperty->GetFloatingPointPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
@@ -520,54 +430,41 @@ bool FAruPredicate_SetFloatValue::Execute(
 		TValueOrError<double, EPropertyBagResult> ParameterValue = InParameters.GetValueDouble(FName{ResolvedParameterName});
 		if (!ParameterValue.HasValue())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-				FText::Format(
-					LOCTEXT(
-						"NoPropertyFoundInParameter",
-						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
-				));
+			ARU_LOG(Warning,
+				LOCTEXT("NoPropertyFoundInParameter", "[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				ResolvedParameterName);
 			return false;
 		}
-		NumericProperty->SetFloatingPointPropertyValue(InValue, ParameterValue.GetValue());
-		Result = true;
+		WriteResult = Aru::Value::WriteIfChanged(NumericProperty, InValue, [&](void* PendingValue) { NumericProperty->SetFloatingPointPropertyValue(PendingValue, ParameterValue.GetValue()); });
 	}
 	else
 	{
-		Result = SetPropertyValue<FNumericProperty>(InProperty, InValue, InParameters);
+		WriteResult = SetPropertyValue<FNumericProperty>(InProperty, InValue, InParameters);
 	}
 	
-	if (Result == true)
-	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"SetFloatProperty_Success",
-					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
-				PreviousValue,
-				NumericProperty->GetFloatingPointPropertyValue(InValue)
-			));
+	if (WriteResult == EAruWriteResult::Changed)
+	{
+		ARU_LOG(Info,
+			LOCTEXT("SetFloatProperty_Success", "[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
+			GetCompactName(),
+			Aru::ProcessResult::Success,
+			InProperty->GetFName(),
+			PreviousValue,
+			NumericProperty->GetFloatingPointPropertyValue(InValue));
 	}
-	else
+	else if (WriteResult == EAruWriteResult::Failed)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetProperty_Failed",
-					"[{0}][{1}]Property:'{2}' operation failure."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetProperty_Failed", "[{0}][{1}]Property:'{2}' operation failure."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 	}
 
-	return Result;
+	return WriteResult == EAruWriteResult::Changed;
 }
 
 bool FAruPredicate_SetIntegerValue::Execute(
@@ -577,60 +474,44 @@ bool FAruPredicate_SetIntegerValue::Execute(
 {
 	if (InProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InPropertyNull",
-					"[{0}][{1}]In Property is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InPropertyNull", "[{0}][{1}]In Property is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	if (InValue == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InValueNull",
-					"[{0}][{1}]In Value is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InValueNull", "[{0}][{1}]In Value is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	const FNumericProperty* NumericProperty = CastField<FNumericProperty>(InProperty);
 	if (NumericProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetIntegerProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a integer property."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetIntegerProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a integer property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	if (!NumericProperty->IsInteger())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetIntegerProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a integer property."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetIntegerProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a integer property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
-	bool Result = false;
+	EAruWriteResult WriteResult = EAruWriteResult::Failed;
 	const float PreviousValue = NumericProperty->GetSignedIntPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
@@ -638,54 +519,41 @@ bool FAruPredicate_SetIntegerValue::Execute(
 		TValueOrError<int64, EPropertyBagResult> ParameterValue = InParameters.GetValueInt64(FName{ResolvedParameterName});
 		if (!ParameterValue.HasValue())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-				FText::Format(
-					LOCTEXT(
-						"NoPropertyFoundInParameter",
-						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
-				));
+			ARU_LOG(Warning,
+				LOCTEXT("NoPropertyFoundInParameter", "[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				ResolvedParameterName);
 			return false;
 		}
-		NumericProperty->SetIntPropertyValue(InValue, ParameterValue.GetValue());
-		Result = true;
+		WriteResult = Aru::Value::WriteIfChanged(NumericProperty, InValue, [&](void* PendingValue) { NumericProperty->SetIntPropertyValue(PendingValue, ParameterValue.GetValue()); });
 	}
 	else
 	{
-		Result = SetPropertyValue<FNumericProperty>(InProperty, InValue, InParameters);
+		WriteResult = SetPropertyValue<FNumericProperty>(InProperty, InValue, InParameters);
 	}
 
-	if (Result == true)
+	if (WriteResult == EAruWriteResult::Changed)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"SetIntegerProperty_Success",
-					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
-				PreviousValue,
-				NumericProperty->GetSignedIntPropertyValue(InValue)
-			));
+		ARU_LOG(Info,
+			LOCTEXT("SetIntegerProperty_Success", "[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
+			GetCompactName(),
+			Aru::ProcessResult::Success,
+			InProperty->GetFName(),
+			PreviousValue,
+			NumericProperty->GetSignedIntPropertyValue(InValue));
 	}
-	else
+	else if (WriteResult == EAruWriteResult::Failed)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetProperty_Failed",
-					"[{0}][{1}]Property:'{2}' operation failure."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetProperty_Failed", "[{0}][{1}]Property:'{2}' operation failure."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 	}
 
-	return Result;
+	return WriteResult == EAruWriteResult::Changed;
 }
 
 bool FAruPredicate_SetStringValue::Execute(
@@ -695,46 +563,34 @@ bool FAruPredicate_SetStringValue::Execute(
 {
 	if (InProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InPropertyNull",
-					"[{0}][{1}]In Property is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InPropertyNull", "[{0}][{1}]In Property is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	if (InValue == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InValueNull",
-					"[{0}][{1}]In Value is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InValueNull", "[{0}][{1}]In Value is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	const FStrProperty* StrProperty = CastField<FStrProperty>(InProperty);
 	if (StrProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetStrProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a string property."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetStrProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a string property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
-	bool Result = false;
+	EAruWriteResult WriteResult = EAruWriteResult::Failed;
 	const FString PreviousValue = StrProperty->GetPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
@@ -742,53 +598,40 @@ bool FAruPredicate_SetStringValue::Execute(
 		TValueOrError<FString, EPropertyBagResult> ParameterValue = InParameters.GetValueString(FName{ResolvedParameterName});
 		if (!ParameterValue.HasValue())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-				FText::Format(
-					LOCTEXT(
-						"NoPropertyFoundInParameter",
-						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
-				));
+			ARU_LOG(Warning,
+				LOCTEXT("NoPropertyFoundInParameter", "[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				ResolvedParameterName);
 			return false;
 		}
-		StrProperty->SetPropertyValue(InValue, ParameterValue.GetValue());
-		Result = true;
+		WriteResult = Aru::Value::WriteIfChanged(StrProperty, InValue, [&](void* PendingValue) { StrProperty->SetPropertyValue(PendingValue, ParameterValue.GetValue()); });
 	}
 	else
 	{
-		Result = SetPropertyValue<FStrProperty>(InProperty, InValue, InParameters);
+		WriteResult = SetPropertyValue<FStrProperty>(InProperty, InValue, InParameters);
 	}
 
-	if (Result == true)
+	if (WriteResult == EAruWriteResult::Changed)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"SetStrProperty_Success",
-					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
-				FText::FromString(PreviousValue),
-				FText::FromString(StrProperty->GetPropertyValue(InValue))
-			));
+		ARU_LOG(Info,
+			LOCTEXT("SetStrProperty_Success", "[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
+			GetCompactName(),
+			Aru::ProcessResult::Success,
+			InProperty->GetFName(),
+			PreviousValue,
+			StrProperty->GetPropertyValue(InValue));
 	}
-	else
+	else if (WriteResult == EAruWriteResult::Failed)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetProperty_Failed",
-					"[{0}][{1}]Property:'{2}' operation failure."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
-	}
-	return Result;
+		ARU_LOG(Warning,
+			LOCTEXT("SetProperty_Failed", "[{0}][{1}]Property:'{2}' operation failure."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
+	}
+	return WriteResult == EAruWriteResult::Changed;
 }
 
 bool FAruPredicate_SetTextValue::Execute(
@@ -798,46 +641,34 @@ bool FAruPredicate_SetTextValue::Execute(
 {
 	if (InProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InPropertyNull",
-					"[{0}][{1}]In Property is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InPropertyNull", "[{0}][{1}]In Property is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	if (InValue == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InValueNull",
-					"[{0}][{1}]In Value is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InValueNull", "[{0}][{1}]In Value is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	const FTextProperty* TextProperty = CastField<FTextProperty>(InProperty);
 	if (TextProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetTextProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{0}' is not a text property."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetTextProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{0}' is not a text property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
-	bool Result = false;
+	EAruWriteResult WriteResult = EAruWriteResult::Failed;
 	const FText PreviousValue = TextProperty->GetPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
@@ -845,36 +676,27 @@ bool FAruPredicate_SetTextValue::Execute(
 		TValueOrError<FText, EPropertyBagResult> ParameterValue = InParameters.GetValueText(FName{ResolvedParameterName});
 		if (!ParameterValue.HasValue())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-				FText::Format(
-					LOCTEXT(
-						"NoPropertyFoundInParameter",
-						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
-				));
+			ARU_LOG(Warning,
+				LOCTEXT("NoPropertyFoundInParameter", "[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				ResolvedParameterName);
 			return false;
 		}
-		TextProperty->SetPropertyValue(InValue, ParameterValue.GetValue());
-		Result = true;
+		WriteResult = Aru::Value::WriteIfChanged(TextProperty, InValue, [&](void* PendingValue) { TextProperty->SetPropertyValue(PendingValue, ParameterValue.GetValue()); });
 	}
 	else
 	{
 		TOptional<const void*> OptionalValue = GetNewValueBySourceType<FStrProperty>(InParameters);
 		if (!OptionalValue.IsSet())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_NewValueNoFound",
-					"[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
-				FText::FromString(StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource))
-			));
+			ARU_LOG(Warning,
+				LOCTEXT("PropertySetter_NewValueNoFound", "[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource));
 			return false;
 		}
 
@@ -891,38 +713,29 @@ bool FAruPredicate_SetTextValue::Execute(
 		}
 
 		FText PendingTextValue = FText::FromString(*StringValue);
-		TextProperty->CopyCompleteValue(InValue, &PendingTextValue);
-		Result = true;
+		WriteResult = Aru::Value::CopyIfChanged(TextProperty, InValue, &PendingTextValue);
 	}
 
-	if (Result == true)
+	if (WriteResult == EAruWriteResult::Changed)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"SetTextProperty_Success",
-					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
-				PreviousValue,
-				TextProperty->GetPropertyValue(InValue)
-			));
+		ARU_LOG(Info,
+			LOCTEXT("SetTextProperty_Success", "[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
+			GetCompactName(),
+			Aru::ProcessResult::Success,
+			InProperty->GetFName(),
+			PreviousValue,
+			TextProperty->GetPropertyValue(InValue));
 	}
-	else
+	else if (WriteResult == EAruWriteResult::Failed)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetProperty_Failed",
-					"[{0}][{1}]Property:'{2}' operation failure."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetProperty_Failed", "[{0}][{1}]Property:'{2}' operation failure."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 	}
 	
-	return Result;
+	return WriteResult == EAruWriteResult::Changed;
 }
 
 bool FAruPredicate_SetNameValue::Execute(
@@ -932,46 +745,34 @@ bool FAruPredicate_SetNameValue::Execute(
 {
 	if (InProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InPropertyNull",
-					"[{0}][{1}]In Property is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InPropertyNull", "[{0}][{1}]In Property is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	if (InValue == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InValueNull",
-					"[{0}][{1}]In Value is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InValueNull", "[{0}][{1}]In Value is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	const FNameProperty* NameProperty = CastField<FNameProperty>(InProperty);
 	if (NameProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"Name_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not an FName property."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("Name_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not an FName property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 	
-	bool Result = false;
+	EAruWriteResult WriteResult = EAruWriteResult::Failed;
 	const FName PreviousValue = NameProperty->GetPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
@@ -979,54 +780,41 @@ bool FAruPredicate_SetNameValue::Execute(
 		TValueOrError<FName, EPropertyBagResult> ParameterValue = InParameters.GetValueName(FName{ResolvedParameterName});
 		if (!ParameterValue.HasValue())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-				FText::Format(
-					LOCTEXT(
-						"NoPropertyFoundInParameter",
-						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
-				));
+			ARU_LOG(Warning,
+				LOCTEXT("NoPropertyFoundInParameter", "[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				ResolvedParameterName);
 			return false;
 		}
-		NameProperty->SetPropertyValue(InValue, ParameterValue.GetValue());
-		Result = true;
+		WriteResult = Aru::Value::WriteIfChanged(NameProperty, InValue, [&](void* PendingValue) { NameProperty->SetPropertyValue(PendingValue, ParameterValue.GetValue()); });
 	}
 	else
 	{
-		Result = SetPropertyValue<FNameProperty>(InProperty, InValue, InParameters);
+		WriteResult = SetPropertyValue<FNameProperty>(InProperty, InValue, InParameters);
 	}
 	
-	if (Result == true)
-	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"SetNameProperty_Success",
-					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
-				FText::FromName(PreviousValue),
-				FText::FromName(NameProperty->GetPropertyValue(InValue))
-			));
+	if (WriteResult == EAruWriteResult::Changed)
+	{
+		ARU_LOG(Info,
+			LOCTEXT("SetNameProperty_Success", "[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
+			GetCompactName(),
+			Aru::ProcessResult::Success,
+			InProperty->GetFName(),
+			PreviousValue,
+			NameProperty->GetPropertyValue(InValue));
 	}
-	else
+	else if (WriteResult == EAruWriteResult::Failed)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetProperty_Failed",
-					"[{0}][{1}]Property:'{2}' operation failure."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetProperty_Failed", "[{0}][{1}]Property:'{2}' operation failure."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 	}
 
-	return Result;
+	return WriteResult == EAruWriteResult::Changed;
 }
 
 bool FAruPredicate_SetEnumValue::Execute(
@@ -1036,57 +824,41 @@ bool FAruPredicate_SetEnumValue::Execute(
 {
 	if (InProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InPropertyNull",
-					"[{0}][{1}]In Property is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InPropertyNull", "[{0}][{1}]In Property is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	if (InValue == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InValueNull",
-					"[{0}][{1}]In Value is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InValueNull", "[{0}][{1}]In Value is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	const FEnumProperty* EnumProperty = CastField<FEnumProperty>(InProperty);
 	if (EnumProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetEnumProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a enum property."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetEnumProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a enum property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	const UEnum* EnumType = EnumProperty->GetEnum();
 	if (EnumType == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetEnumProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' enum type is NULL."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetEnumProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' enum type is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
@@ -1096,7 +868,7 @@ bool FAruPredicate_SetEnumValue::Execute(
 		return false;
 	}
 
-	bool Result = false;
+	EAruWriteResult WriteResult = EAruWriteResult::Failed;
 	const int64 PreviousValue = UnderlyingProperty->GetSignedIntPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
@@ -1104,36 +876,27 @@ bool FAruPredicate_SetEnumValue::Execute(
 		TValueOrError<uint8, EPropertyBagResult> ParameterValue = InParameters.GetValueEnum(FName{ResolvedParameterName}, EnumType);
 		if (!ParameterValue.HasValue())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-				FText::Format(
-					LOCTEXT(
-						"NoPropertyFoundInParameter",
-						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
-				));
+			ARU_LOG(Warning,
+				LOCTEXT("NoPropertyFoundInParameter", "[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				ResolvedParameterName);
 			return false;
 		}
-		UnderlyingProperty->SetIntPropertyValue(InValue, static_cast<int64>(ParameterValue.GetValue()));
-		Result = true;
+		WriteResult = Aru::Value::WriteIfChanged(UnderlyingProperty, InValue, [&](void* PendingValue) { UnderlyingProperty->SetIntPropertyValue(PendingValue, static_cast<int64>(ParameterValue.GetValue())); });
 	}
 	else
 	{
 		TOptional<const void*> OptionalValue = GetNewValueBySourceType<FStrProperty>(InParameters);
 		if (!OptionalValue.IsSet())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_NewValueNoFound",
-					"[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
-				FText::FromString(StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource))
-			));
+			ARU_LOG(Warning,
+				LOCTEXT("PropertySetter_NewValueNoFound", "[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource));
 			return false;
 		}
 
@@ -1152,51 +915,38 @@ bool FAruPredicate_SetEnumValue::Execute(
 		const int64 PendingEnumValue = EnumType->GetValueByNameString(*StringValue);
 		if (PendingEnumValue == INDEX_NONE)
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"SetEnumProperty_NoEnumFound",
-					"[{0}][{1}]Property:'{2}', can't find valid enum value by '{3}'."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
-				FText::FromString(*StringValue)
-			));
+			ARU_LOG(Info,
+				LOCTEXT("SetEnumProperty_NoEnumFound", "[{0}][{1}]Property:'{2}', can't find valid enum value by '{3}'."),
+				GetCompactName(),
+				Aru::ProcessResult::Success,
+				InProperty->GetFName(),
+				*StringValue);
 			return false;
 		}
 
-		UnderlyingProperty->SetIntPropertyValue(InValue, PendingEnumValue);
-		Result = true;
+		WriteResult = Aru::Value::WriteIfChanged(UnderlyingProperty, InValue, [&](void* PendingValue) { UnderlyingProperty->SetIntPropertyValue(PendingValue, PendingEnumValue); });
 	}
 	
-	if (Result == true)
-	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"SetEnumProperty_Success",
-					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
-				PreviousValue,
-				UnderlyingProperty->GetSignedIntPropertyValue(InValue)
-			));
+	if (WriteResult == EAruWriteResult::Changed)
+	{
+		ARU_LOG(Info,
+			LOCTEXT("SetEnumProperty_Success", "[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
+			GetCompactName(),
+			Aru::ProcessResult::Success,
+			InProperty->GetFName(),
+			PreviousValue,
+			UnderlyingProperty->GetSignedIntPropertyValue(InValue));
 	}
-	else
+	else if (WriteResult == EAruWriteResult::Failed)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetProperty_Failed",
-					"[{0}][{1}]Property:'{2}' operation failure."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetProperty_Failed", "[{0}][{1}]Property:'{2}' operation failure."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 	}
 
-	return Result;
+	return WriteResult == EAruWriteResult::Changed;
 }
 
 bool FAruPredicate_SetObjectValue::Execute(
@@ -1206,61 +956,45 @@ bool FAruPredicate_SetObjectValue::Execute(
 {
 	if (InProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InPropertyNull",
-					"[{0}][{1}]In Property is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InPropertyNull", "[{0}][{1}]In Property is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	if (InValue == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InValueNull",
-					"[{0}][{1}]In Value is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InValueNull", "[{0}][{1}]In Value is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(InProperty);
 	if (ObjectProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetObjectProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not an uobject property."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetObjectProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not an uobject property."),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
 		return false;
 	}
 
 	const UClass* ClassType = ObjectProperty->PropertyClass;
 	if (ClassType == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetObjectProperty_ObjectClassNULL",
-					"[{0}][{1}]Property:'{2}' is not a valid uobject property."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetObjectProperty_ObjectClassNULL", "[{0}][{1}]Property:'{2}' is not a valid uobject property."),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
 		return false;
 	}
 
-	bool Result = false;
+	EAruWriteResult WriteResult = EAruWriteResult::Failed;
 	const UObject* PreviousValue = ObjectProperty->GetObjectPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
@@ -1268,23 +1002,19 @@ bool FAruPredicate_SetObjectValue::Execute(
 		TValueOrError<UObject*, EPropertyBagResult> ParameterValue = InParameters.GetValueObject(FName{ResolvedParameterName});
 		if (!ParameterValue.HasValue())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-				FText::Format(
-					LOCTEXT(
-						"NoPropertyFoundInParameter",
-						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
-				));
+			ARU_LOG(Warning,
+				LOCTEXT("NoPropertyFoundInParameter", "[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				ResolvedParameterName);
 			return false;
 		}
 		
 		const UObject* ObjectPtr = ParameterValue.GetValue();
 		if (ObjectPtr == nullptr)
 		{
-			ObjectProperty->SetObjectPropertyValue(InValue, nullptr);
+			WriteResult = Aru::Value::WriteIfChanged(ObjectProperty, InValue, [&](void* PendingValue) { ObjectProperty->SetObjectPropertyValue(PendingValue, nullptr); });
 		}
 		else
 		{
@@ -1296,56 +1026,41 @@ bool FAruPredicate_SetObjectValue::Execute(
 
 			if (!ObjectClass->IsChildOf(ClassType))
 			{
-				FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetObjectProperty_ObjectClassMismatch",
-					"Property:'{0}' is not a valid uobject property."),
-				FText::FromString(InProperty->GetName())
-			));
+				ARU_LOG(Warning,
+					LOCTEXT("SetObjectProperty_ObjectClassMismatch", "Property:'{0}' is not a valid uobject property."),
+					InProperty->GetFName());
 				return false;
 			}
 
-			ObjectProperty->SetObjectPropertyValue(InValue, ParameterValue.GetValue());
+			WriteResult = Aru::Value::WriteIfChanged(ObjectProperty, InValue, [&](void* PendingValue) { ObjectProperty->SetObjectPropertyValue(PendingValue, ParameterValue.GetValue()); });
 		}
-		
-		Result = true;
 	}
 	else if (auto* PendingValue = GetNewValueBySourceType<FObjectPropertyBase>(InParameters, ClassType).GetPtrOrNull())
 	{
-		ObjectProperty->CopyCompleteValue(InValue, *PendingValue);
-		Result = true;
+		WriteResult = Aru::Value::CopyIfChanged(ObjectProperty, InValue, *PendingValue);
 	}
 
-	if (Result == true)
+	if (WriteResult == EAruWriteResult::Changed)
 	{
 		const UObject* InNewValue = ObjectProperty->GetObjectPropertyValue(InValue);
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"SetUObjectProperty_Success",
-					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
-				FText::FromString(!!PreviousValue? PreviousValue->GetName() : FString{"nullptr"}),
-				FText::FromString(!!InNewValue? InNewValue->GetName() : FString{"nullptr"})
-			));
+		ARU_LOG(Info,
+			LOCTEXT("SetUObjectProperty_Success", "[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
+			GetCompactName(),
+			Aru::ProcessResult::Success,
+			InProperty->GetFName(),
+			!!PreviousValue? PreviousValue->GetName() : FString{"nullptr"},
+			!!InNewValue? InNewValue->GetName() : FString{"nullptr"});
 	}
-	else
+	else if (WriteResult == EAruWriteResult::Failed)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetProperty_Failed",
-					"[{0}][{1}]Property:'{2}' operation failure."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetProperty_Failed", "[{0}][{1}]Property:'{2}' operation failure."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 	}
 
-	return Result;
+	return WriteResult == EAruWriteResult::Changed;
 }
 
 bool FAruPredicate_SetStructValue::Execute(
@@ -1355,72 +1070,52 @@ bool FAruPredicate_SetStructValue::Execute(
 {
 	if (InProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InPropertyNull",
-					"[{0}][{1}]In Property is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InPropertyNull", "[{0}][{1}]In Property is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	if (InValue == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InValueNull",
-					"[{0}][{1}]In Value is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InValueNull", "[{0}][{1}]In Value is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty);
 	if (StructProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetStructProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a struct property."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetStructProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a struct property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	const UScriptStruct* SourceStructType = StructProperty->Struct;
 	if (SourceStructType == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-					FText::Format(
-						LOCTEXT(
-							"SetStructProperty_TypeNull",
-							"[{0}][{1}]Property:'{2}' struct type is NULL."),
-								FText::FromString(GetCompactName()),
-								FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
-					));
+		ARU_LOG(Warning,
+			LOCTEXT("SetStructProperty_TypeNull", "[{0}][{1}]Property:'{2}' struct type is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 	
 	if(SourceStructType == FInstancedStruct::StaticStruct())
 	{
 		
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-					FText::Format(
-						LOCTEXT(
-							"SetStructProperty_UnsupportedType",
-							"[{0}][{1}]Property:'{2}' struct type is instanced struct, use 'Set Instanced Struct' instead."),
-								FText::FromString(GetCompactName()),
-								FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
-					));
+		ARU_LOG(Warning,
+			LOCTEXT("SetStructProperty_UnsupportedType", "[{0}][{1}]Property:'{2}' struct type is instanced struct, use 'Set Instanced Struct' instead."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
@@ -1430,55 +1125,39 @@ bool FAruPredicate_SetStructValue::Execute(
 		TValueOrError<FStructView, EPropertyBagResult> ParameterValue = InParameters.GetValueStruct(FName{ResolvedParameterName}, SourceStructType);
 		if (!ParameterValue.HasValue())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-				FText::Format(
-					LOCTEXT(
-						"NoPropertyFoundInParameter",
-						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
-				));
+			ARU_LOG(Warning,
+				LOCTEXT("NoPropertyFoundInParameter", "[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				ResolvedParameterName);
 			return false;
 		}
 
 		FStructView& StructValue = ParameterValue.GetValue();
 		if (StructValue.GetScriptStruct() != nullptr && !StructValue.GetScriptStruct()->IsChildOf(SourceStructType))
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetStructProperty_StructTypeMismatch",
-					"[{0}][{1}]Property:'{2}'.Source type:{3}, target type:{4}."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
-				FText::FromString(SourceStructType->GetName()),
-				FText::FromString(StructValue.GetScriptStruct()->GetName())
-			));
+			ARU_LOG(Warning,
+				LOCTEXT("SetStructProperty_StructTypeMismatch", "[{0}][{1}]Property:'{2}'.Source type:{3}, target type:{4}."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				SourceStructType->GetFName(),
+				StructValue.GetScriptStruct()->GetName());
 			return false;
 		}
-		if (StructProperty->Struct)
-		{
-			StructProperty->Struct->CopyScriptStruct(InValue, StructValue.GetMemory());
-		}
-		return true;
+		return Aru::Value::CopyIfChanged(StructProperty, InValue, StructValue.GetMemory()) == EAruWriteResult::Changed;
 	}
 
 	TOptional<const void*> OptionalValue = GetNewValueBySourceType<FStructProperty>(InParameters, SourceStructType);
 	if (!OptionalValue.IsSet())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_NewValueNoFound",
-					"[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
-				FText::FromString(StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource))
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_NewValueNoFound", "[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName(),
+			StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource));
 		return false;
 	}
 
@@ -1491,41 +1170,32 @@ bool FAruPredicate_SetStructValue::Execute(
 	const FInstancedStruct* InstancedStructPtr = static_cast<const FInstancedStruct*>(PendingValue);
 	if (InstancedStructPtr == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"SetStructValue_InvalidValue",
-					"[{0}][{1}]Property:'{2}': invalid struct value."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("SetStructValue_InvalidValue", "[{0}][{1}]Property:'{2}': invalid struct value."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	const void* PendingStructValue = InstancedStructPtr->GetMemory();
 	if (PendingStructValue == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"SetStructValue_InvalidValue",
-					"[{0}][{1}]Property:'{2}': invalid struct value."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("SetStructValue_InvalidValue", "[{0}][{1}]Property:'{2}': invalid struct value."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
-	StructProperty->CopyCompleteValue(InValue, PendingStructValue);
+	if (Aru::Value::CopyIfChanged(StructProperty, InValue, PendingStructValue) != EAruWriteResult::Changed)
+	{
+		return false;
+	}
 
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-			FText::Format(
-				LOCTEXT(
-					"SetStructValue_Result",
-					"[{0}][{1}]Property:'{2}': operation succeeded."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Success)
-			));
+	ARU_LOG(Info,
+		LOCTEXT("SetStructValue_Result", "[{0}][{1}]Property:'{2}': operation succeeded."),
+		GetCompactName(),
+		Aru::ProcessResult::Success);
 	
 	return true;
 }
@@ -1537,72 +1207,52 @@ bool FAruPredicate_SetInstancedStructValue::Execute(
 {
 	if (InProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InPropertyNull",
-					"[{0}][{1}]In Property is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InPropertyNull", "[{0}][{1}]In Property is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	if (InValue == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"InValueNull",
-					"[{0}][{1}]In Value is NULL."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error)
-			));
+		ARU_LOG(Error,
+			LOCTEXT("InValueNull", "[{0}][{1}]In Value is NULL."),
+			GetCompactName(),
+			Aru::ProcessResult::Error);
 		return false;
 	}
 
 	const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty);
 	if (StructProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"SetInstancedStructProperty_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a struct property."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("SetInstancedStructProperty_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a struct property."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	const UScriptStruct* StructType = StructProperty->Struct;
 	if (StructType == nullptr || StructType != FInstancedStruct::StaticStruct())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-					FText::Format(
-						LOCTEXT(
-							"SetInstancedStructProperty_TypeNull",
-							"[{0}][{1}]Property:'{2}' struct type is NULL or not an instanced struct."),
-								FText::FromString(GetCompactName()),
-								FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
-					));
+		ARU_LOG(Warning,
+			LOCTEXT("SetInstancedStructProperty_TypeNull", "[{0}][{1}]Property:'{2}' struct type is NULL or not an instanced struct."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	FInstancedStruct* InstancedStructPtr = static_cast<FInstancedStruct*>(InValue);
 	if (InstancedStructPtr == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-					FText::Format(
-						LOCTEXT(
-							"SetInstancedStructProperty_TypeNull",
-							"[{0}][{1}]Property:'{2}' is an invalid instanced struct."),
-								FText::FromString(GetCompactName()),
-								FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
-					));
+		ARU_LOG(Warning,
+			LOCTEXT("SetInstancedStructProperty_TypeNull", "[{0}][{1}]Property:'{2}' is an invalid instanced struct."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
@@ -1613,51 +1263,38 @@ bool FAruPredicate_SetInstancedStructValue::Execute(
 			FName{ResolvedParameterName}, FInstancedStruct::StaticStruct());
 		if (!ParameterValue.HasValue())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-				FText::Format(
-					LOCTEXT(
-						"NoPropertyFoundInParameter",
-						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
-				));
+			ARU_LOG(Warning,
+				LOCTEXT("NoPropertyFoundInParameter", "[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				ResolvedParameterName);
 			return false;
 		}
 
 		FStructView& StructValue = ParameterValue.GetValue();
 		if (StructValue.GetScriptStruct() != FInstancedStruct::StaticStruct())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-					FText::Format(
-						LOCTEXT(
-							"SetInstancedStructProperty_TypeNull",
-							"[{0}][{1}]Property:'{2}' struct type is not an instanced struct."),
-								FText::FromString(GetCompactName()),
-								FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
-					));
+			ARU_LOG(Warning,
+				LOCTEXT("SetInstancedStructProperty_TypeNull", "[{0}][{1}]Property:'{2}' struct type is not an instanced struct."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName());
 			return false;
 		}
 
-		StructProperty->Struct->CopyScriptStruct(InValue, StructValue.GetMemory());
-		return true;
+		return Aru::Value::CopyIfChanged(StructProperty, InValue, StructValue.GetMemory()) == EAruWriteResult::Changed;
 	}
 
 	TOptional<const void*> OptionalValue = GetNewValueBySourceType<FStructProperty>(InParameters, StructType);
 	if (!OptionalValue.IsSet())
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_NewValueNoFound",
-					"[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
-				FText::FromString(StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource))
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("PropertySetter_NewValueNoFound", "[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName(),
+			StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource));
 		
 		return false;
 	}
@@ -1668,17 +1305,16 @@ bool FAruPredicate_SetInstancedStructValue::Execute(
 		return false;
 	}
 
-	StructProperty->CopyCompleteValue(InValue, PendingValue);
-	
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-		FText::Format(
-			LOCTEXT(
-				"SetInstancedStructValue_Result",
-				"[{0}][{1}]Property:'{2}': operation succeeded."),
-					FText::FromString(GetCompactName()),
-					FText::FromString(Aru::ProcessResult::Success),
-						FText::FromString(InProperty->GetName())
-		));
+	if (Aru::Value::CopyIfChanged(StructProperty, InValue, PendingValue) != EAruWriteResult::Changed)
+	{
+		return false;
+	}
+
+	ARU_LOG(Info,
+		LOCTEXT("SetInstancedStructValue_Result", "[{0}][{1}]Property:'{2}': operation succeeded."),
+		GetCompactName(),
+		Aru::ProcessResult::Success,
+		InProperty->GetFName());
 	
 	return true;
 }
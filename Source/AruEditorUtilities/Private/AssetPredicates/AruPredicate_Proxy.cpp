@@ -1,5 +1,23 @@
 #include "AssetPredicates/AruPredicate_Proxy.h"
+#include "AruValueUtils.h"
+#include "AruPropertyDispatch.h"
+#include "AruProxyBatch.h"
+#include "AruTrace.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_Proxy)
+
+namespace Aru::Private
+{
+	/** Batch results of one predicate proxy during a run, one slot per supported element type. */
+	struct FPredicateProxyBatches
+	{
+		TAruProxyBatch<FBoolProperty, bool, bool> Bools;
+		TAruProxyBatch<FIntProperty, int32, int32> Ints;
+		TAruProxyBatch<FFloatProperty, float, float> Floats;
+		TAruProxyBatch<FStrProperty, FString, FString> Strings;
+		TAruProxyBatch<FNameProperty, FName, FName> Names;
+	};
+}
+
 void FAruPredicate_BlueprintProxy::InitializeProxy(UObject* InOwner)
 {
     // Check if there is already a valid ProxyInstance
@@ -27,113 +45,350 @@ void FAruPredicate_BlueprintProxy::InitializeProxy(UObject* InOwner)
     UObject* Owner = InOwner ? InOwner : GetTransientPackage();
     
     // Create a new ProxyInstance
+    LLM_SCOPE_BYTAG(Aru_Proxies);
+    TRACE_COUNTER_INCREMENT(AruProxyInstances);
+    Aru::Memory::CountInRun(&FAruRunStats::ProxyInstances);
     ProxyInstance = NewObject<UAruPredicateProxy>(Owner, ProxyClass);
 }
 
-bool FAruPredicate_Proxy::Execute(
+// Ensure the proxy instance is properly initialized before use
+bool FAruPredicate_BlueprintProxy::EnsureProxyInitialized() const
+{
+    if (!ProxyInstance || (ProxyClass && !ProxyInstance->IsA(ProxyClass)))
+    {
+        // The proxy instance needs to be initialized
+        FAruPredicate_BlueprintProxy* MutableThis = const_cast<FAruPredicate_BlueprintProxy*>(this);
+        MutableThis->InitializeProxy();
+    }
+
+    return ProxyInstance != nullptr;
+}
+
+bool FAruPredicate_BlueprintProxy::Execute(
 	const FProperty* InProperty,
 	void* InValue,
 	const FInstancedPropertyBag& InParameters) const
 {
-	if (InProperty == nullptr)
+	// Runs are kept off worker threads by IsThreadSafe, Blueprint code must never get there.
+	if (!ensureMsgf(IsInGameThread(), TEXT("Blueprint predicate proxies must run on the game thread.")))
 	{
 		return false;
 	}
 
-	if(InValue == nullptr)
+	if (const TOptional<bool> bBatchedChange = ExecuteBatched(InProperty, InValue))
 	{
-		return false;
+		return bBatchedChange.GetValue();
 	}
 
-	if(const FBoolProperty* BoolProperty = CastField<FBoolProperty>(InProperty))
-	{
-		BoolProperty->SetPropertyValue(InValue, ExecuteBoolValue(BoolProperty->GetPropertyValue(InValue), InParameters));
-		return true;
-	}
+	return FAruPredicate_Proxy::Execute(InProperty, InValue, InParameters);
+}
 
-	if(const FIntProperty* IntProperty = CastField<FIntProperty>(InProperty))
-	{
-		IntProperty->SetPropertyValue(InValue, ExecuteIntegerValue(IntProperty->GetPropertyValue(InValue), InParameters));
-		return true;
-	}
-	
-	if(const FFloatProperty* FloatProperty = CastField<FFloatProperty>(InProperty))
+TOptional<bool> FAruPredicate_BlueprintProxy::ExecuteBatched(const FProperty* InProperty, void* InValue) const
+{
+	FAruProcessingContext* Context = FAruProcessingContext::Get();
+	if (InProperty == nullptr || InValue == nullptr || Context == nullptr || FAruArrayScope::Get() == nullptr || !EnsureProxyInitialized())
 	{
-		FloatProperty->SetPropertyValue(InValue, ExecuteFloatValue(FloatProperty->GetPropertyValue(InValue), InParameters));
-		return true;
+		return {};
 	}
 
-	if(const FStrProperty* StringProperty = CastField<FStrProperty>(InProperty))
-	{
-		StringProperty->SetPropertyValue(InValue, ExecuteStringValue(StringProperty->GetPropertyValue_InContainer(InValue), InParameters));
-		return true;
-	}
+	LLM_SCOPE_BYTAG(Aru_Proxies);
+	const UClass* ProxyType = ProxyInstance->GetClass();
+	const TSharedRef<Aru::Private::FPredicateProxyBatches> Batches = Context->FindOrAddRuleCache<Aru::Private::FPredicateProxyBatches>(
+		this, []
+		{
+			return MakeShared<Aru::Private::FPredicateProxyBatches>();
+		});
 
-	if(const FTextProperty* TextProperty = CastField<FTextProperty>(InProperty))
+	switch (Aru::Dispatch::Find(InProperty).Kind)
 	{
-		TextProperty->SetPropertyValue(InValue, ExecuteTextValue(TextProperty->GetPropertyValue_InContainer(InValue), InParameters));
-		return true;
+	case EAruValueKind::Bool:
+		{
+			const FBoolProperty* BoolProperty = static_cast<const FBoolProperty*>(InProperty);
+			if (!ProxyType->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAruPredicateProxy, ProcessBoolValues)))
+			{
+				return {};
+			}
+			const TOptional<bool> NewValue = Batches->Bools.Find(BoolProperty, InValue, [this](const TArray<bool>& Values, const TArray<FAruProxyValueContext>& Contexts)
+			{
+				return ProxyInstance->ProcessBoolValues(Values, Contexts);
+			});
+			if (!NewValue.IsSet())
+			{
+				return {};
+			}
+			if (NewValue.GetValue() == BoolProperty->GetPropertyValue(InValue))
+			{
+				return false;
+			}
+			BoolProperty->SetPropertyValue(InValue, NewValue.GetValue());
+			return true;
+		}
+	case EAruValueKind::Int32:
+		{
+			const FIntProperty* IntProperty = static_cast<const FIntProperty*>(InProperty);
+			if (!ProxyType->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAruPredicateProxy, ProcessIntValues)))
+			{
+				return {};
+			}
+			const TOptional<int32> NewValue = Batches->Ints.Find(IntProperty, InValue, [this](const TArray<int32>& Values, const TArray<FAruProxyValueContext>& Contexts)
+			{
+				return ProxyInstance->ProcessIntValues(Values, Contexts);
+			});
+			if (!NewValue.IsSet())
+			{
+				return {};
+			}
+			if (NewValue.GetValue() == IntProperty->GetPropertyValue(InValue))
+			{
+				return false;
+			}
+			IntProperty->SetPropertyValue(InValue, NewValue.GetValue());
+			return true;
+		}
+	case EAruValueKind::Float:
+		{
+			const FFloatProperty* FloatProperty = static_cast<const FFloatProperty*>(InProperty);
+			if (!ProxyType->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAruPredicateProxy, ProcessFloatValues)))
+			{
+				return {};
+			}
+			const TOptional<float> NewValue = Batches->Floats.Find(FloatProperty, InValue, [this](const TArray<float>& Values, const TArray<FAruProxyValueContext>& Contexts)
+			{
+				return ProxyInstance->ProcessFloatValues(Values, Contexts);
+			});
+			if (!NewValue.IsSet())
+			{
+				return {};
+			}
+			if (NewValue.GetValue() == FloatProperty->GetPropertyValue(InValue))
+			{
+				return false;
+			}
+			FloatProperty->SetPropertyValue(InValue, NewValue.GetValue());
+			return true;
+		}
+	case EAruValueKind::String:
+		{
+			const FStrProperty* StringProperty = static_cast<const FStrProperty*>(InProperty);
+			if (!ProxyType->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAruPredicateProxy, ProcessStringValues)))
+			{
+				return {};
+			}
+			const TOptional<FString> NewValue = Batches->Strings.Find(StringProperty, InValue, [this](const TArray<FString>& Values, const TArray<FAruProxyValueContext>& Contexts)
+			{
+				return ProxyInstance->ProcessStringValues(Values, Contexts);
+			});
+			if (!NewValue.IsSet())
+			{
+				return {};
+			}
+			return Aru::Value::CopyIfChanged(StringProperty, InValue, &NewValue.GetValue()) == EAruWriteResult::Changed;
+		}
+	case EAruValueKind::Name:
+		{
+			const FNameProperty* NameProperty = static_cast<const FNameProperty*>(InProperty);
+			if (!ProxyType->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAruPredicateProxy, ProcessNameValues)))
+			{
+				return {};
+			}
+			const TOptional<FName> NewValue = Batches->Names.Find(NameProperty, InValue, [this](const TArray<FName>& Values, const TArray<FAruProxyValueContext>& Contexts)
+			{
+				return ProxyInstance->ProcessNameValues(Values, Contexts);
+			});
+			if (!NewValue.IsSet())
+			{
+				return {};
+			}
+			if (NewValue.GetValue().IsEqual(NameProperty->GetPropertyValue(InValue), ENameCase::CaseSensitive))
+			{
+				return false;
+			}
+			NameProperty->SetPropertyValue(InValue, NewValue.GetValue());
+			return true;
+		}
+	default:
+		return {};
 	}
+}
 
-	if(const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(InProperty))
+bool FAruPredicate_Proxy::Execute(
+	const FProperty* InProperty,
+	void* InValue,
+	const FInstancedPropertyBag& InParameters) const
+{
+	if (InProperty == nullptr)
 	{
-		ObjectProperty->SetObjectPropertyValue(InValue, ExecuteObjectValue(ObjectProperty->GetObjectPropertyValue_InContainer(InValue), InParameters));
-		return true;
+		return false;
 	}
 
-	if(const FNameProperty* NameProperty = CastField<FNameProperty>(InProperty))
+	if(InValue == nullptr)
 	{
-		NameProperty->SetPropertyValue(InValue, ExecuteNameValue(NameProperty->GetPropertyValue(InValue), InParameters));
-		return true;
+		return false;
 	}
 
-	if(const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty))
+	// Every branch compares the proxy's result with the current value, so only real changes are written and reported.
+	const FAruValueDispatch Dispatch = Aru::Dispatch::Find(InProperty);
+	switch (Dispatch.Kind)
 	{
-		const UScriptStruct* StructType = StructProperty->Struct;
-		if(StructType == nullptr)
+	case EAruValueKind::Bool:
 		{
-			return false;
+			const FBoolProperty* BoolProperty = static_cast<const FBoolProperty*>(InProperty);
+			const bool PreviousValue = BoolProperty->GetPropertyValue(InValue);
+			const bool NewValue = ExecuteBoolValue(PreviousValue, InParameters);
+			if (NewValue == PreviousValue)
+			{
+				return false;
+			}
+			BoolProperty->SetPropertyValue(InValue, NewValue);
+			return true;
 		}
-
-		if(StructType == FGameplayTag::StaticStruct())
+	case EAruValueKind::Int32:
 		{
-			FGameplayTag* GameplayTag = static_cast<FGameplayTag*>(InValue);
-			*GameplayTag = ExecuteGameplayTagValue(*GameplayTag, InParameters);
+			const int32 PreviousValue = FIntProperty::GetPropertyValue(InValue);
+			const int32 NewValue = ExecuteIntegerValue(PreviousValue, InParameters);
+			if (NewValue == PreviousValue)
+			{
+				return false;
+			}
+			FIntProperty::SetPropertyValue(InValue, NewValue);
 			return true;
 		}
-
-		if(StructType == FGameplayTagContainer::StaticStruct())
+	case EAruValueKind::Int8:
+	case EAruValueKind::Int16:
+	case EAruValueKind::UInt16:
+	case EAruValueKind::UInt32:
+	case EAruValueKind::Int64:
 		{
-			FGameplayTagContainer* GameplayTagContainer = static_cast<FGameplayTagContainer*>(InValue);
-			*GameplayTagContainer = ExecuteGameplayTagContainerValue(*GameplayTagContainer, InParameters);
+			const FNumericProperty* NumericProperty = static_cast<const FNumericProperty*>(InProperty);
+			const int64 PreviousValue = NumericProperty->GetSignedIntPropertyValue(InValue);
+			const int64 NewValue = Aru::Dispatch::ClampToKind(Dispatch.Kind, ExecuteInt64Value(PreviousValue, InParameters));
+			if (NewValue == PreviousValue)
+			{
+				return false;
+			}
+			NumericProperty->SetIntPropertyValue(InValue, NewValue);
 			return true;
 		}
-
-		if(StructType == FInstancedStruct::StaticStruct())
+	case EAruValueKind::UInt64:
 		{
-			FInstancedStruct* InstancedStruct = static_cast<FInstancedStruct*>(InValue);
-			*InstancedStruct = ExecuteInstancedStructValue(*InstancedStruct, InParameters);
+			// The event sees values above MAX_int64 saturated, so they are only written back when the event changed them.
+			const uint64 PreviousValue = FUInt64Property::GetPropertyValue(InValue);
+			const int64 PreviousEventValue = static_cast<int64>(FMath::Min<uint64>(PreviousValue, MAX_int64));
+			const int64 EventValue = ExecuteInt64Value(PreviousEventValue, InParameters);
+			const uint64 NewValue = static_cast<uint64>(FMath::Max<int64>(EventValue, 0));
+			if (EventValue == PreviousEventValue || NewValue == PreviousValue)
+			{
+				return false;
+			}
+			FUInt64Property::SetPropertyValue(InValue, NewValue);
 			return true;
 		}
-
-		FInstancedStruct StructProxy;
-		StructProxy.InitializeAs(StructType, static_cast<uint8*>(InValue));
-		StructProperty->CopyCompleteValue(InValue, ExecuteStructValue(StructProxy, InParameters).GetMutableMemory());
-		return true;
-	}
-
-	if(const FEnumProperty* EnumProperty = CastField<FEnumProperty>(InProperty))
-	{
-		if(const FNumericProperty* NumericProperty = CastField<FNumericProperty>(EnumProperty->GetUnderlyingProperty()))
+	case EAruValueKind::Byte:
+		{
+			const uint8 PreviousValue = FByteProperty::GetPropertyValue(InValue);
+			const uint8 NewValue = ExecuteByteValue(PreviousValue, InParameters);
+			if (NewValue == PreviousValue)
+			{
+				return false;
+			}
+			FByteProperty::SetPropertyValue(InValue, NewValue);
+			return true;
+		}
+	case EAruValueKind::Float:
+		{
+			const float PreviousValue = FFloatProperty::GetPropertyValue(InValue);
+			const float NewValue = ExecuteFloatValue(PreviousValue, InParameters);
+			if (NewValue == PreviousValue)
+			{
+				return false;
+			}
+			FFloatProperty::SetPropertyValue(InValue, NewValue);
+			return true;
+		}
+	case EAruValueKind::Double:
 		{
-			NumericProperty->SetIntPropertyValue(InValue, ExecuteEnumValue(NumericProperty->GetSignedIntPropertyValue(InValue), EnumProperty->GetEnum(), InParameters));
+			const double PreviousValue = FDoubleProperty::GetPropertyValue(InValue);
+			const double NewValue = ExecuteDoubleValue(PreviousValue, InParameters);
+			if (NewValue == PreviousValue)
+			{
+				return false;
+			}
+			FDoubleProperty::SetPropertyValue(InValue, NewValue);
 			return true;
 		}
-		
+	case EAruValueKind::String:
+		{
+			const FString NewValue = ExecuteStringValue(FStrProperty::GetPropertyValue(InValue), InParameters);
+			return Aru::Value::CopyIfChanged(InProperty, InValue, &NewValue) == EAruWriteResult::Changed;
+		}
+	case EAruValueKind::Text:
+		{
+			const FText NewValue = ExecuteTextValue(FTextProperty::GetPropertyValue(InValue), InParameters);
+			return Aru::Value::CopyIfChanged(InProperty, InValue, &NewValue) == EAruWriteResult::Changed;
+		}
+	case EAruValueKind::Object:
+		{
+			const FObjectProperty* ObjectProperty = static_cast<const FObjectProperty*>(InProperty);
+			const UObject* PreviousValue = ObjectProperty->GetObjectPropertyValue(InValue);
+			UObject* NewValue = ExecuteObjectValue(PreviousValue, InParameters);
+			if (NewValue == PreviousValue)
+			{
+				return false;
+			}
+			ObjectProperty->SetObjectPropertyValue(InValue, NewValue);
+			return true;
+		}
+	case EAruValueKind::Name:
+		{
+			const FName PreviousValue = FNameProperty::GetPropertyValue(InValue);
+			const FName NewValue = ExecuteNameValue(PreviousValue, InParameters);
+			if (NewValue.IsEqual(PreviousValue, ENameCase::CaseSensitive))
+			{
+				return false;
+			}
+			FNameProperty::SetPropertyValue(InValue, NewValue);
+			return true;
+		}
+	case EAruValueKind::GameplayTag:
+		{
+			const FGameplayTag NewValue = ExecuteGameplayTagValue(*static_cast<const FGameplayTag*>(InValue), InParameters);
+			return Aru::Value::CopyIfChanged(InProperty, InValue, &NewValue) == EAruWriteResult::Changed;
+		}
+	case EAruValueKind::GameplayTagContainer:
+		{
+			const FGameplayTagContainer NewValue = ExecuteGameplayTagContainerValue(*static_cast<const FGameplayTagContainer*>(InValue), InParameters);
+			return Aru::Value::CopyIfChanged(InProperty, InValue, &NewValue) == EAruWriteResult::Changed;
+		}
+	case EAruValueKind::InstancedStruct:
+		{
+			const FInstancedStruct NewValue = ExecuteInstancedStructValue(*static_cast<const FInstancedStruct*>(InValue), InParameters);
+			return Aru::Value::CopyIfChanged(InProperty, InValue, &NewValue) == EAruWriteResult::Changed;
+		}
+	case EAruValueKind::Struct:
+		{
+			FInstancedStruct StructProxy;
+			StructProxy.InitializeAs(Dispatch.Struct, static_cast<uint8*>(InValue));
+			FInstancedStruct NewValue = ExecuteStructValue(StructProxy, InParameters);
+			if (NewValue.GetScriptStruct() == nullptr || !NewValue.GetScriptStruct()->IsChildOf(Dispatch.Struct))
+			{
+				return false;
+			}
+			return Aru::Value::CopyIfChanged(InProperty, InValue, NewValue.GetMemory()) == EAruWriteResult::Changed;
+		}
+	case EAruValueKind::Enum:
+		{
+			const int64 PreviousValue = Dispatch.UnderlyingProperty->GetSignedIntPropertyValue(InValue);
+			const int64 NewValue = ExecuteEnumValue(PreviousValue, Dispatch.Enum, InParameters);
+			if (NewValue == PreviousValue)
+			{
+				return false;
+			}
+			Dispatch.UnderlyingProperty->SetIntPropertyValue(InValue, NewValue);
+			return true;
+		}
+	default:
 		return false;
 	}
-
-	return false;
 }
 
 bool FAruPredicate_BlueprintProxy::ExecuteBoolValue(
@@ -160,6 +415,43 @@ int32 FAruPredicate_BlueprintProxy::ExecuteIntegerValue(
 	return InIntValue;
 }
 
+int64 FAruPredicate_BlueprintProxy::ExecuteInt64Value(
+	const int64 InInt64Value,
+	const FInstancedPropertyBag& InParameters) const
+{
+	// Unimplemented events return zero; these types were never touched before, so don't start zeroing them.
+	if (ProxyInstance && ProxyInstance->GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAruPredicateProxy, ProcessInt64Value)))
+	{
+		return ProxyInstance->ProcessInt64Value(InInt64Value);
+	}
+
+	return InInt64Value;
+}
+
+uint8 FAruPredicate_BlueprintProxy::ExecuteByteValue(
+	const uint8 InByteValue,
+	const FInstancedPropertyBag& InParameters) const
+{
+	if (ProxyInstance && ProxyInstance->GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAruPredicateProxy, ProcessByteValue)))
+	{
+		return ProxyInstance->ProcessByteValue(InByteValue);
+	}
+
+	return InByteValue;
+}
+
+double FAruPredicate_BlueprintProxy::ExecuteDoubleValue(
+	const double InDoubleValue,
+	const FInstancedPropertyBag& InParameters) const
+{
+	if (ProxyInstance && ProxyInstance->GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAruPredicateProxy, ProcessDoubleValue)))
+	{
+		return ProxyInstance->ProcessDoubleValue(InDoubleValue);
+	}
+
+	return InDoubleValue;
+}
+
 float FAruPredicate_BlueprintProxy::ExecuteFloatValue(
 	const float InFloatValue,
 	const FInstancedPropertyBag& InParameters) const
@@ -280,3 +572,68 @@ int64 FAruPredicate_BlueprintProxy::ExecuteEnumValue(
 
 	return InEnumValue;
 }
+
+TArray<bool> UAruPredicateProxy::ProcessBoolValues_Implementation(
+	const TArray<bool>& InValues,
+	const TArray<FAruProxyValueContext>& InContexts) const
+{
+	TArray<bool> Results;
+	Results.Reserve(InValues.Num());
+	for (const bool Value : InValues)
+	{
+		Results.Add(ProcessBoolValue(Value));
+	}
+	return Results;
+}
+
+TArray<int32> UAruPredicateProxy::ProcessIntValues_Implementation(
+	const TArray<int32>& InValues,
+	const TArray<FAruProxyValueContext>& InContexts) const
+{
+	TArray<int32> Results;
+	Results.Reserve(InValues.Num());
+	for (const int32 Value : InValues)
+	{
+		Results.Add(ProcessIntValue(Value));
+	}
+	return Results;
+}
+
+TArray<float> UAruPredicateProxy::ProcessFloatValues_Implementation(
+	const TArray<float>& InValues,
+	const TArray<FAruProxyValueContext>& InContexts) const
+{
+	TArray<float> Results;
+	Results.Reserve(InValues.Num());
+	for (const float Value : InValues)
+	{
+		Results.Add(ProcessFloatValue(Value));
+	}
+	return Results;
+}
+
+TArray<FString> UAruPredicateProxy::ProcessStringValues_Implementation(
+	const TArray<FString>& InValues,
+	const TArray<FAruProxyValueContext>& InContexts) const
+{
+	TArray<FString> Results;
+	Results.Reserve(InValues.Num());
+	for (const FString& Value : InValues)
+	{
+		Results.Add(ProcessStringValue(Value));
+	}
+	return Results;
+}
+
+TArray<FName> UAruPredicateProxy::ProcessNameValues_Implementation(
+	const TArray<FName>& InValues,
+	const TArray<FAruProxyValueContext>& InContexts) const
+{
+	TArray<FName> Results;
+	Results.Reserve(InValues.Num());
+	for (const FName& Value : InValues)
+	{
+		Results.Add(ProcessNameValue(Value));
+	}
+	return Results;
+}
@@ -1,4 +1,7 @@
 ﻿#include "AssetPredicates/AruPredicate_Set.h"
+#include "AruContainerUtils.h"
+#include "AruProcessingContext.h"
+#include "AruRunLog.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_Set)
 
 #define LOCTEXT_NAMESPACE "AruPredicate_Set"
@@ -11,73 +14,49 @@ bool FAruPredicate_AddSetElement::Execute(
 	const FSetProperty* SetProperty = CastField<FSetProperty>(InProperty);
 	if (SetProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"AddToSet_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a set."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("AddToSet_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a set."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	if (Predicates.Num() == 0)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"AddToSet_NoPredicatesForKey",
-					"[{0}][{1}]Set:'{2}'. At least one predicate is required to complete the process."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("AddToSet_NoPredicatesForKey", "[{0}][{1}]Set:'{2}'. At least one predicate is required to complete the process."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	FProperty* ElementProperty = SetProperty->ElementProp;
 	if (ElementProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"AddToSet_GetElementPropertyFailed",
-					"[{0}][{1}]Set:'{2}'. Can't get element property."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Error,
+			LOCTEXT("AddToSet_GetElementPropertyFailed", "[{0}][{1}]Set:'{2}'. Can't get element property."),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
 		
 		return false;
 	}
 
-	void* PendingElementPtr = FMemory::Malloc(ElementProperty->GetSize());
+	const FAruScopedScratchValue PendingElement{ElementProperty};
+	void* PendingElementPtr = PendingElement.Get();
 	if (PendingElementPtr == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"AddToSet__MallocFailed",
-					"[{0}][{1}]Set:'{2}'. Malloc memory for element failed."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Error,
+			LOCTEXT("AddToSet__MallocFailed", "[{0}][{1}]Set:'{2}'. Malloc memory for element failed."),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
 		
 		return false;
 	}
-	ElementProperty->InitializeValue(PendingElementPtr);
-
-	ON_SCOPE_EXIT
-	{
-		ElementProperty->DestroyValue(PendingElementPtr);
-		FMemory::Free(PendingElementPtr);
-	};
-
 	bool bExecutedSuccessfully = false;
-	ElementProperty->InitializeValue(PendingElementPtr);
 	for (auto& Predicate : Predicates)
 	{
 		if (const FAruPredicate* PredicatePtr = Predicate.GetPtr<FAruPredicate>())
@@ -88,30 +67,22 @@ bool FAruPredicate_AddSetElement::Execute(
 
 	if (bExecutedSuccessfully == false)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"AddToSet_ExecutionFailure",
-					"[{0}][{1}]Set:'{2}'. Predicate(s) for element executed failed."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("AddToSet_ExecutionFailure", "[{0}][{1}]Set:'{2}'. Predicate(s) for element executed failed."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	FScriptSetHelper SetHelper(SetProperty, InValue);
 	if (SetHelper.FindElementIndex(PendingElementPtr) != INDEX_NONE)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"AddToSet_DuplicateElements",
-					"[{0}][{1}]The element pending to add already existed in this set:'{2}'."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("AddToSet_DuplicateElements", "[{0}][{1}]The element pending to add already existed in this set:'{2}'."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
@@ -140,24 +111,19 @@ bool FAruPredicate_RemoveSetValue::Execute(
 	const FSetProperty* SetProperty = CastField<FSetProperty>(InProperty);
 	if (SetProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"AddToSet_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a set."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("AddToSet_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a set."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		return false;
 	}
 
 	if (Filters.Num() == 0)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT("Execution failed", "{0}: Lack of filter configuration."),
-				FText::FromString(GetNameSafe(StaticStruct()))));
+		ARU_LOG(Warning,
+			LOCTEXT("Execution failed", "{0}: Lack of filter configuration."),
+			GetNameSafe(StaticStruct()));
 		return false;
 	}
 
@@ -179,33 +145,32 @@ bool FAruPredicate_RemoveSetValue::Execute(
 		return true;
 	};
 
-	TArray<int32> PendingRemove;
+	// Removing from the sparse storage doesn't shift the other elements, so matches are removed during the scan
+	// and the hash is rebuilt once at the end.
+	int32 RemovedCount = 0;
 	FScriptSetHelper SetHelper{SetProperty, InValue};
-	for (int32 Index = 0; Index < SetHelper.Num(); ++Index)
+	for (int32 Index = 0; Index < SetHelper.GetMaxIndex(); ++Index)
 	{
-		if (ShouldRemove(SetHelper.GetElementPtr(Index)))
+		if (SetHelper.IsValidIndex(Index) && ShouldRemove(SetHelper.GetElementPtr(Index)))
 		{
-			PendingRemove.Add(Index);
+			SetHelper.RemoveAt(Index);
+			RemovedCount++;
 		}
 	}
 
-	for (int32& Index : PendingRemove)
+	if (RemovedCount > 0)
 	{
-		SetHelper.RemoveAt(Index);
+		SetHelper.Rehash();
 	}
 
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-		FText::Format(
-			LOCTEXT(
-				"RemoveFromSet_Result.",
-				"[{0}][{1}]Removed {2} element(s) from set:'{3}'."),
-			FText::FromString(GetCompactName()),
-			FText::FromString(PendingRemove.Num() > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed),
-			PendingRemove.Num(),
-			FText::FromString(InProperty->GetName()))
-	);
-
-	return PendingRemove.Num() > 0;
+	ARU_LOG(Info,
+		LOCTEXT("RemoveFromSet_Result.", "[{0}][{1}]Removed {2} element(s) from set:'{3}'."),
+		GetCompactName(),
+		RemovedCount > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed,
+		RemovedCount,
+		InProperty->GetFName());
+
+	return RemovedCount > 0;
 }
 
 bool FAruPredicate_ModifySetValue::Execute(
@@ -216,15 +181,11 @@ bool FAruPredicate_ModifySetValue::Execute(
 	const FSetProperty* SetProperty = CastField<FSetProperty>(InProperty);
 	if (SetProperty == nullptr)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"AddToSet_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' is not a set."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("AddToSet_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' is not a set."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		
 		return false;
 	}
@@ -237,15 +198,11 @@ bool FAruPredicate_ModifySetValue::Execute(
 
 	if (Filters.Num() == 0)
 	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"ModifySetValue_NoFilters",
-					"[{0}][{1}]Set:'{2}'. At least one filter is required to complete the process."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
+		ARU_LOG(Warning,
+			LOCTEXT("ModifySetValue_NoFilters", "[{0}][{1}]Set:'{2}'. At least one filter is required to complete the process."),
+			GetCompactName(),
+			Aru::ProcessResult::Failed,
+			InProperty->GetFName());
 		
 		return false;
 	}
@@ -268,46 +225,37 @@ bool FAruPredicate_ModifySetValue::Execute(
 		return true;
 	};
 
-	int32 MatchedCount = 0;
-	int32 ModifiedCount = 0;
 	FScriptSetHelper SetHelper{SetProperty, InValue};
-	for (int32 Index = 0; Index < SetHelper.Num(); ++Index)
+	TArray<int32> PendingToModify;
+	for (int32 Index = 0; Index < SetHelper.GetMaxIndex(); ++Index)
 	{
-		void* ElementPtr = SetHelper.GetElementPtr(Index);
-		if (!ShouldModify(ElementPtr))
-		{
-			continue;
-		}
-		else
+		if (SetHelper.IsValidIndex(Index) && ShouldModify(SetHelper.GetElementPtr(Index)))
 		{
-			MatchedCount++;
+			PendingToModify.Add(Index);
 		}
+	}
 
-		void* PendingElementPtr = FMemory::Malloc(ElementProperty->GetSize());
-		if (PendingElementPtr == nullptr)
-		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
-			FText::Format(
-				LOCTEXT(
-					"ModifySetValue_MallocFailed",
-					"[{0}][{1}]Set:'{2}'. Malloc memory for element failed."),
-				FText::FromString(GetCompactName()),
-				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
-			));
-			
-			return false;
-		}
-		ElementProperty->InitializeValue(PendingElementPtr);
+	// Stage every new element first, so the set is written and rehashed once instead of per element.
+	const FAruScratchArray PendingElements{ElementProperty, PendingToModify.Num()};
+	if (!PendingElements.IsValid())
+	{
+		ARU_LOG(Error,
+			LOCTEXT("ModifySetValue_MallocFailed", "[{0}][{1}]Set:'{2}'. Malloc memory for element failed."),
+			GetCompactName(),
+			Aru::ProcessResult::Error,
+			InProperty->GetFName());
+		
+		return false;
+	}
 
-		ON_SCOPE_EXIT
-		{
-			ElementProperty->DestroyValue(PendingElementPtr);
-			FMemory::Free(PendingElementPtr);
-		};
+	TArray<int32> ChangedIndices;
+	TArray<const void*> StagedElements;
+	for (int32 Slot = 0; Slot < PendingToModify.Num(); ++Slot)
+	{
+		void* PendingElementPtr = PendingElements.GetRawPtr(Slot);
+		ElementProperty->CopyCompleteValue(PendingElementPtr, SetHelper.GetElementPtr(PendingToModify[Slot]));
 
 		bool bValueChanged = false;
-		ElementProperty->CopyCompleteValue(PendingElementPtr, ElementPtr);
 		for (const TInstancedStruct<FAruPredicate>& PredicateStruct : Predicates)
 		{
 			const FAruPredicate* Predicate = PredicateStruct.GetPtr<FAruPredicate>();
@@ -319,45 +267,95 @@ bool FAruPredicate_ModifySetValue::Execute(
 			bValueChanged |= Predicate->Execute(SetProperty->ElementProp, PendingElementPtr, InParameters);
 		}
 
-		if(bValueChanged == false)
+		if (bValueChanged)
 		{
-			continue;
+			ChangedIndices.Add(PendingToModify[Slot]);
+			StagedElements.Add(PendingElementPtr);
 		}
+	}
+
+	const TBitArray<> Accepted = Aru::Container::ResolveStagedKeys(
+		ElementProperty,
+		SetHelper.GetMaxIndex(),
+		[&SetHelper](int32 Index) -> const void* { return SetHelper.IsValidIndex(Index) ? SetHelper.GetElementPtr(Index) : nullptr; },
+		ChangedIndices,
+		StagedElements);
 
-		if (SetHelper.FindElementIndex(PendingElementPtr) != INDEX_NONE)
+	int32 ModifiedCount = 0;
+	for (int32 ChangeIndex = 0; ChangeIndex < ChangedIndices.Num(); ++ChangeIndex)
+	{
+		if (!Accepted[ChangeIndex])
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-					FText::Format(
-						LOCTEXT(
-							"ModifySetValue_DuplicateElements",
-							"[{0}][{1}]The element pending to set already existed in this map:'{2}'."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
-					));
+			ARU_LOG(Warning,
+				LOCTEXT("ModifySetValue_DuplicateElements", "[{0}][{1}]The element pending to set already existed in this map:'{2}'."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName());
 			
 			continue;
 		}
 
-		ElementProperty->CopyCompleteValue(ElementPtr, PendingElementPtr);
-		SetHelper.Rehash();
+		ElementProperty->CopyCompleteValue(SetHelper.GetElementPtr(ChangedIndices[ChangeIndex]), StagedElements[ChangeIndex]);
+		ModifiedCount++;
+	}
 
-		ModifiedCount += bValueChanged? 1 : 0;
+	if (ModifiedCount > 0)
+	{
+		SetHelper.Rehash();
 	}
 
-	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
-		FText::Format(
-			LOCTEXT(
-				"ModifySetValue_Result",
-				"[{0}][{1}]Array:'{2}': {3} element(s) matched, {4} modified'."),
-			FText::FromString(GetCompactName()),
-			FText::FromString(ModifiedCount > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed),
-			FText::FromString(InProperty->GetName()),
-			MatchedCount,
-			ModifiedCount
-		));
+	const int32 MatchedCount = PendingToModify.Num();
+	ARU_LOG(Info,
+		LOCTEXT("ModifySetValue_Result", "[{0}][{1}]Array:'{2}': {3} element(s) matched, {4} modified'."),
+		GetCompactName(),
+		ModifiedCount > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed,
+		InProperty->GetFName(),
+		MatchedCount,
+		ModifiedCount);
 
 	return ModifiedCount > 0;
 }
 
+void FAruPredicate_AddSetElement::GatherPreloads(
+	const FProperty* InProperty,
+	const void* InValue,
+	const FInstancedPropertyBag& InParameters,
+	TArray<FSoftObjectPath>& OutPaths) const
+{
+	const FSetProperty* SetProperty = CastField<FSetProperty>(InProperty);
+	if (SetProperty == nullptr)
+	{
+		return;
+	}
+
+	const FAruScopedScratchValue PendingElement{SetProperty->ElementProp};
+	if (PendingElement.IsValid())
+	{
+		Aru::GatherPreloads(Predicates, SetProperty->ElementProp, PendingElement.Get(), InParameters, OutPaths);
+	}
+}
+
+void FAruPredicate_ModifySetValue::GatherPreloads(
+	const FProperty* InProperty,
+	const void* InValue,
+	const FInstancedPropertyBag& InParameters,
+	TArray<FSoftObjectPath>& OutPaths) const
+{
+	const FSetProperty* SetProperty = CastField<FSetProperty>(InProperty);
+	if (SetProperty == nullptr || InValue == nullptr)
+	{
+		return;
+	}
+
+	// Element filters are left to the write pass, so every element reports what it could load.
+	FScriptSetHelper SetHelper{SetProperty, InValue};
+	for (int32 Index = 0; Index < SetHelper.GetMaxIndex(); ++Index)
+	{
+		if (SetHelper.IsValidIndex(Index))
+		{
+			Aru::GatherPreloads(Predicates, SetProperty->ElementProp, SetHelper.GetElementPtr(Index), InParameters, OutPaths);
+		}
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
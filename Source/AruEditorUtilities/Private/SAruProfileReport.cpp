@@ -0,0 +1,210 @@
+#include "SAruProfileReport.h"
+#include "AruRuleProfiler.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Widgets/SWindow.h"
+#include "Widgets/Layout/SSplitter.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "SAruProfileReport"
+
+namespace Aru::Private
+{
+	class SProfileRow : public SMultiColumnTableRow<SAruProfileReport::FRowPtr>
+	{
+	public:
+		SLATE_BEGIN_ARGS(SProfileRow) {}
+			SLATE_ARGUMENT(SAruProfileReport::FRowPtr, Row)
+			SLATE_ARGUMENT(const TArray<SAruProfileReport::FColumn>*, Columns)
+		SLATE_END_ARGS()
+
+		void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable)
+		{
+			Row = InArgs._Row;
+			Columns = InArgs._Columns;
+			SMultiColumnTableRow<SAruProfileReport::FRowPtr>::Construct(FSuperRowType::FArguments(), InOwnerTable);
+		}
+
+		virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+		{
+			const int32 ColumnIndex = Columns->IndexOfByPredicate([&ColumnName](const SAruProfileReport::FColumn& Column) { return Column.Id == ColumnName; });
+			if (!Row.IsValid() || !Row->Cells.IsValidIndex(ColumnIndex))
+			{
+				return SNullWidget::NullWidget;
+			}
+
+			return SNew(STextBlock)
+				.Text(Row->Cells[ColumnIndex])
+				.Justification((*Columns)[ColumnIndex].bNumeric ? ETextJustify::Right : ETextJustify::Left);
+		}
+
+	private:
+		SAruProfileReport::FRowPtr Row;
+		const TArray<SAruProfileReport::FColumn>* Columns = nullptr;
+	};
+
+	static void AddNumber(SAruProfileReport::FRow& Row, const int64 Value)
+	{
+		Row.Cells.Add(FText::AsNumber(Value));
+		Row.Values.Add(static_cast<double>(Value));
+	}
+
+	static void AddMilliseconds(SAruProfileReport::FRow& Row, const double Seconds)
+	{
+		FNumberFormattingOptions Options;
+		Options.MinimumFractionalDigits = 3;
+		Options.MaximumFractionalDigits = 3;
+		Row.Cells.Add(FText::AsNumber(Seconds * 1000.0, &Options));
+		Row.Values.Add(Seconds);
+	}
+
+	static void AddString(SAruProfileReport::FRow& Row, const FString& Value)
+	{
+		Row.Cells.Add(FText::FromString(Value));
+		Row.Values.Add(0.0);
+	}
+}
+
+void SAruProfileReport::Construct(const FArguments& InArgs)
+{
+	using namespace Aru::Private;
+
+	Report = InArgs._Report;
+
+	RuleTable.Columns = {
+		{FName{"Definition"}, LOCTEXT("DefinitionColumn", "Definition"), 2.f, false},
+		{FName{"Rule"}, LOCTEXT("RuleColumn", "Rule"), 2.f, false},
+		{FName{"Kind"}, LOCTEXT("KindColumn", "Kind"), 1.f, false},
+		{FName{"Evaluations"}, LOCTEXT("EvaluationsColumn", "Evaluations"), 1.f, true},
+		{FName{"Matches"}, LOCTEXT("MatchesColumn", "Matches"), 1.f, true},
+		{FName{"Writes"}, LOCTEXT("WritesColumn", "Writes"), 1.f, true},
+		{FName{"Time"}, LOCTEXT("TimeColumn", "Time (ms)"), 1.f, true},
+		{FName{"Average"}, LOCTEXT("AverageColumn", "Average (ms)"), 1.f, true}};
+
+	AssetTable.Columns = {
+		{FName{"Asset"}, LOCTEXT("AssetColumn", "Asset"), 4.f, false},
+		{FName{"Evaluations"}, LOCTEXT("EvaluationsColumn", "Evaluations"), 1.f, true},
+		{FName{"Writes"}, LOCTEXT("WritesColumn", "Writes"), 1.f, true},
+		{FName{"Time"}, LOCTEXT("TimeColumn", "Time (ms)"), 1.f, true}};
+
+	if (Report.IsValid())
+	{
+		for (const FAruRuleStats& Stats : Report->Rules)
+		{
+			const FRowPtr Row = MakeShared<FRow>();
+			AddString(*Row, Stats.Definition);
+			AddString(*Row, Stats.Rule);
+			AddString(*Row, FAruProfileReport::LexKind(Stats.Kind));
+			AddNumber(*Row, Stats.Evaluations);
+			AddNumber(*Row, Stats.Matches);
+			AddNumber(*Row, Stats.Writes);
+			AddMilliseconds(*Row, Stats.GetSeconds());
+			AddMilliseconds(*Row, Stats.Evaluations > 0 ? Stats.GetSeconds() / Stats.Evaluations : 0.0);
+			RuleTable.Rows.Add(Row);
+		}
+
+		for (const FAruAssetStats& Stats : Report->Assets)
+		{
+			const FRowPtr Row = MakeShared<FRow>();
+			AddString(*Row, Stats.AssetPath);
+			AddNumber(*Row, Stats.Evaluations);
+			AddNumber(*Row, Stats.Writes);
+			AddMilliseconds(*Row, Stats.GetSeconds());
+			AssetTable.Rows.Add(Row);
+		}
+	}
+
+	// Reports arrive sorted by time, so mark that column as the current sort.
+	RuleTable.SortColumn = FName{"Time"};
+	RuleTable.SortMode = EColumnSortMode::Descending;
+	AssetTable.SortColumn = FName{"Time"};
+	AssetTable.SortMode = EColumnSortMode::Descending;
+
+	ChildSlot
+	[
+		SNew(SSplitter)
+		.Orientation(Orient_Vertical)
+		+ SSplitter::Slot()
+		.Value(0.6f)
+		[
+			MakeTable(RuleTable)
+		]
+		+ SSplitter::Slot()
+		.Value(0.4f)
+		[
+			MakeTable(AssetTable)
+		]
+	];
+}
+
+TSharedRef<SWidget> SAruProfileReport::MakeTable(FTable& Table)
+{
+	const TSharedRef<SHeaderRow> HeaderRow = SNew(SHeaderRow);
+	for (const FColumn& Column : Table.Columns)
+	{
+		const FName ColumnId = Column.Id;
+		HeaderRow->AddColumn(SHeaderRow::Column(ColumnId)
+			.DefaultLabel(Column.Label)
+			.FillWidth(Column.FillWidth)
+			.HAlignHeader(Column.bNumeric ? HAlign_Right : HAlign_Left)
+			.SortMode_Lambda([&Table, ColumnId] { return Table.SortColumn == ColumnId ? Table.SortMode : EColumnSortMode::None; })
+			.OnSort_Lambda([this, &Table](EColumnSortPriority::Type, const FName& InColumnId, EColumnSortMode::Type InMode)
+			{
+				SortTable(Table, InColumnId, InMode);
+			}));
+	}
+
+	return SAssignNew(Table.ListView, SListView<FRowPtr>)
+		.ListItemsSource(&Table.Rows)
+		.SelectionMode(ESelectionMode::Multi)
+		.HeaderRow(HeaderRow)
+		.OnGenerateRow(this, &SAruProfileReport::MakeRow, &Table);
+}
+
+TSharedRef<ITableRow> SAruProfileReport::MakeRow(FRowPtr Row, const TSharedRef<STableViewBase>& OwnerTable, FTable* Table)
+{
+	return SNew(Aru::Private::SProfileRow, OwnerTable)
+		.Row(Row)
+		.Columns(&Table->Columns);
+}
+
+void SAruProfileReport::SortTable(FTable& Table, const FName ColumnId, const EColumnSortMode::Type Mode)
+{
+	const int32 ColumnIndex = Table.Columns.IndexOfByPredicate([&ColumnId](const FColumn& Column) { return Column.Id == ColumnId; });
+	if (ColumnIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	Table.SortColumn = ColumnId;
+	Table.SortMode = Mode;
+
+	const bool bNumeric = Table.Columns[ColumnIndex].bNumeric;
+	const bool bAscending = Mode == EColumnSortMode::Ascending;
+	Table.Rows.StableSort([ColumnIndex, bNumeric, bAscending](const FRowPtr& A, const FRowPtr& B)
+	{
+		const int32 Compare = bNumeric
+			? (A->Values[ColumnIndex] < B->Values[ColumnIndex] ? -1 : (A->Values[ColumnIndex] > B->Values[ColumnIndex] ? 1 : 0))
+			: A->Cells[ColumnIndex].CompareToCaseIgnored(B->Cells[ColumnIndex]);
+		return bAscending ? Compare < 0 : Compare > 0;
+	});
+
+	if (Table.ListView.IsValid())
+	{
+		Table.ListView->RequestListRefresh();
+	}
+}
+
+void SAruProfileReport::OpenWindow(const TSharedRef<const FAruProfileReport>& InReport)
+{
+	const TSharedRef<SWindow> Window = SNew(SWindow)
+		.Title(FText::Format(LOCTEXT("ProfileWindowTitle", "Rule Profile - {0}"), FText::AsDateTime(InReport->Timestamp)))
+		.ClientSize(FVector2D{1200.f, 800.f})
+		[
+			SNew(SAruProfileReport)
+			.Report(InReport)
+		];
+	FSlateApplication::Get().AddWindow(Window);
+}
+
+#undef LOCTEXT_NAMESPACE
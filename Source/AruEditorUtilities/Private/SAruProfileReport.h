@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Widgets/Views/SListView.h"
+
+struct FAruProfileReport;
+
+/** Rule and asset tables of a profile report. Every column sorts when its header is clicked. */
+class SAruProfileReport : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SAruProfileReport) {}
+		SLATE_ARGUMENT(TSharedPtr<const FAruProfileReport>, Report)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/** Opens the report in its own window. */
+	static void OpenWindow(const TSharedRef<const FAruProfileReport>& InReport);
+
+	struct FColumn
+	{
+		FName Id;
+		FText Label;
+		float FillWidth = 1.f;
+		bool bNumeric = false;
+	};
+
+	/** Cells as displayed; numeric columns also keep their raw value so they sort by magnitude. */
+	struct FRow
+	{
+		TArray<FText> Cells;
+		TArray<double> Values;
+	};
+	using FRowPtr = TSharedPtr<FRow>;
+
+private:
+	struct FTable
+	{
+		TArray<FColumn> Columns;
+		TArray<FRowPtr> Rows;
+		TSharedPtr<SListView<FRowPtr>> ListView;
+		FName SortColumn;
+		EColumnSortMode::Type SortMode = EColumnSortMode::None;
+	};
+
+	TSharedRef<SWidget> MakeTable(FTable& Table);
+	TSharedRef<ITableRow> MakeRow(FRowPtr Row, const TSharedRef<STableViewBase>& OwnerTable, FTable* Table);
+	void SortTable(FTable& Table, const FName ColumnId, const EColumnSortMode::Type Mode);
+
+	TSharedPtr<const FAruProfileReport> Report;
+	FTable RuleTable;
+	FTable AssetTable;
+};
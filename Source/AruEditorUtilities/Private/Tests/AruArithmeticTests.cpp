@@ -0,0 +1,45 @@
+#include "AssetPredicates/AruPredicate_Arithmetic.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AruTestTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace Aru::Tests
+{
+	/** Runs the predicate on the whole array as one batch, and on every element of a copy one by one. Returns whether both agree bit for bit. */
+	static bool BatchMatchesElements(const FAruPredicate& Batched, const FAruPredicate& PerElement, const TArray<float>& Weights)
+	{
+		UAruTestObject* BatchObject = NewObject<UAruTestObject>();
+		UAruTestObject* ElementObject = NewObject<UAruTestObject>();
+		BatchObject->Weights = Weights;
+		ElementObject->Weights = Weights;
+
+		const FArrayProperty* WeightsProperty = FindFProperty<FArrayProperty>(UAruTestObject::StaticClass(), GET_MEMBER_NAME_CHECKED(UAruTestObject, Weights));
+		const FInstancedPropertyBag Parameters;
+		Batched.Execute(WeightsProperty, &BatchObject->Weights, Parameters);
+		for (float& Weight : ElementObject->Weights)
+		{
+			PerElement.Execute(WeightsProperty->Inner, &Weight, Parameters);
+		}
+		return FMemory::Memcmp(BatchObject->Weights.GetData(), ElementObject->Weights.GetData(), Weights.Num() * sizeof(float)) == 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAruArithmeticBatchMatchesElementsTest, "AruEditorUtilities.Arithmetic.BatchMatchesElements",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAruArithmeticBatchMatchesElementsTest::RunTest(const FString& Parameters)
+{
+	// Nine values, so two groups of four lanes and one leftover go through the batch, with values where float and double rounding differ.
+	const TArray<float> Weights{0.1f, 1.0f / 3.0f, 16777215.f, -2.5f, 1e-30f, 3.4e38f, 0.7f, -0.3f, 2.55f};
+
+	TestTrue(TEXT("Scaling agrees"), Aru::Tests::BatchMatchesElements(FAruPredicate_ScaleNumeric{1.0001, true}, FAruPredicate_ScaleNumeric{1.0001}, Weights));
+	TestTrue(TEXT("Adding agrees"), Aru::Tests::BatchMatchesElements(FAruPredicate_AddNumeric{0.1, true}, FAruPredicate_AddNumeric{0.1}, Weights));
+	TestTrue(TEXT("Clamping agrees"), Aru::Tests::BatchMatchesElements(FAruPredicate_ClampNumeric{-1.0, 0.5, true}, FAruPredicate_ClampNumeric{-1.0, 0.5}, Weights));
+	TestTrue(TEXT("Clamping to an empty range agrees"), Aru::Tests::BatchMatchesElements(FAruPredicate_ClampNumeric{1.0, -1.0, true}, FAruPredicate_ClampNumeric{1.0, -1.0}, Weights));
+	TestTrue(TEXT("Clamping NaN agrees"), Aru::Tests::BatchMatchesElements(FAruPredicate_ClampNumeric{-1.0, 0.5, true}, FAruPredicate_ClampNumeric{-1.0, 0.5}, {NAN, 0.f, 2.f, -2.f}));
+	TestTrue(TEXT("Rounding agrees"), Aru::Tests::BatchMatchesElements(FAruPredicate_RoundNumeric{0.1, true}, FAruPredicate_RoundNumeric{0.1}, Weights));
+	return true;
+}
+
+#endif
@@ -0,0 +1,57 @@
+#include "AruFunctionLibrary.h"
+#include "AssetCollector/AruAssetCollector.h"
+#include "AssetObject/AruAssetObject.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AruTestTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+PRAGMA_DISABLE_DEPRECATION_WARNINGS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAruAssetCollectorAssetObjectTagsTest, "AruEditorUtilities.AssetCollector.AssetObjectTags",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAruAssetCollectorAssetObjectTagsTest::RunTest(const FString& Parameters)
+{
+	UAruTestCollector* Collector = NewObject<UAruTestCollector>();
+	UAruTestObject* Object = NewObject<UAruTestObject>();
+
+	UAruAssetObject* AssetObject = Collector->AddInstance(Object, {TEXT("Enemy")});
+	if (!TestNotNull(TEXT("The instance is created"), AssetObject))
+	{
+		return false;
+	}
+	TestTrue(TEXT("Get returns the stored instance"), Collector->Get() == TArray<UAruAssetObject*>{AssetObject});
+	TestTrue(TEXT("Get returns the same instance again"), Collector->Get() == TArray<UAruAssetObject*>{AssetObject});
+
+	// Routing reads the collection's tag masks, so a tag added to the instance has to reach them.
+	AssetObject->AddAssetTag(TEXT("Boss"));
+	TestTrue(TEXT("A tag added to the instance reaches the collection"), Collector->GetAssetsWithTags({TEXT("Enemy"), TEXT("Boss")}) == TArray<UObject*>{Object});
+
+	Collector->AddTaggedAsset(Object, {TEXT("Flying")});
+	TestTrue(TEXT("A tag added to the asset reaches the instance"), AssetObject->GetAssetTags().Contains(TEXT("Flying")));
+	TestEqual(TEXT("The asset is collected once"), Collector->GetNumAssets(), 1);
+
+	Collector->ClearAssets();
+	AssetObject->AddAssetTag(TEXT("Dropped"));
+	TestEqual(TEXT("A cleared instance no longer adds to the collection"), Collector->GetNumAssets(), 0);
+	return true;
+}
+
+PRAGMA_ENABLE_DEPRECATION_WARNINGS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAruAssetCollectorTagMatchingTest, "AruEditorUtilities.AssetCollector.TagMatching",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAruAssetCollectorTagMatchingTest::RunTest(const FString& Parameters)
+{
+	UAruAssetObject* AssetObject = NewObject<UAruAssetObject>();
+	AssetObject->AddAssetTag(TEXT("Enemy"));
+
+	TestTrue(TEXT("No required tags match"), UAruFunctionLibrary::IsTagMatching(AssetObject, {}));
+	TestTrue(TEXT("A tag required twice matches once carried"), UAruFunctionLibrary::IsTagMatching(AssetObject, {TEXT("Enemy"), TEXT("Enemy")}));
+	TestFalse(TEXT("A missing tag doesn't match"), UAruFunctionLibrary::IsTagMatching(AssetObject, {TEXT("Enemy"), TEXT("Boss")}));
+	return true;
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include "AruAsyncRun.h"
+#include "AruFunctionLibrary.h"
+#include "AssetPredicates/AruPredicate_PropertySetter.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AruTestTypes.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAruAsyncRunModifyTest, "AruEditorUtilities.AsyncRun.Modify",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAruAsyncRunModifyTest::RunTest(const FString& Parameters)
+{
+	// Held by the latent commands, which outlive this call.
+	TSharedRef<TArray<TStrongObjectPtr<UAruTestObject>>> Fixtures = MakeShared<TArray<TStrongObjectPtr<UAruTestObject>>>();
+	TArray<UObject*> Objects;
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		UAruTestObject* Object = NewObject<UAruTestObject>();
+		Object->Value = 1;
+		Fixtures->Emplace(Object);
+		Objects.Add(Object);
+	}
+
+	const TArray<FAruActionDefinition> Actions{
+		Aru::Tests::MakeAction(TEXT("Value"), TInstancedStruct<FAruPredicate>::Make<FAruPredicate_SetIntegerValue>(int64{5}))};
+	const TStrongObjectPtr<UAruAsyncRun> Run{UAruFunctionLibrary::ModifyAssetsAsync(Objects, Actions, Aru::Tests::MakeConfigs())};
+	if (!TestNotNull(TEXT("The run starts"), Run.Get()))
+	{
+		return false;
+	}
+
+	// The run only advances on editor ticks, so the checks wait for it to end.
+	const double StartSeconds = FPlatformTime::Seconds();
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Run, StartSeconds]
+	{
+		if (Run->GetState() == EAruAsyncRunState::Running && FPlatformTime::Seconds() - StartSeconds < 30.0)
+		{
+			return false;
+		}
+
+		TestTrue(TEXT("The run finishes"), Run->GetState() == EAruAsyncRunState::Finished);
+		TestEqual(TEXT("Every asset is processed"), Run->GetNumProcessed(), Run->GetNumAssets());
+		TestTrue(TEXT("The run reports its change"), Run->GetResult());
+		return true;
+	}));
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Fixtures]
+	{
+		for (const TStrongObjectPtr<UAruTestObject>& Fixture : *Fixtures)
+		{
+			TestEqual(TEXT("The asset is written like in a blocking run"), Fixture->Value, 5);
+		}
+		return true;
+	}));
+	return true;
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include "AruChangeSet.h"
+#include "AruFunctionLibrary.h"
+#include "AssetPredicates/AruPredicate_PathToProperty.h"
+#include "AssetPredicates/AruPredicate_PropertySetter.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AruTestTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace Aru::Tests
+{
+	static const FProperty* FindTestProperty(const FName PropertyName)
+	{
+		return FindFProperty<FProperty>(UAruTestObject::StaticClass(), PropertyName);
+	}
+
+	/** Serializes the fixture's property and reads it back into another fixture. */
+	static bool RoundTrip(const FProperty* Property, UAruTestObject* Source, UAruTestObject* Destination)
+	{
+		TArray<uint8> Bytes;
+		Aru::Values::Serialize(Property, Property->ContainerPtrToValuePtr<void>(Source), Bytes);
+		return Aru::Values::Deserialize(Property, Property->ContainerPtrToValuePtr<void>(Destination), Bytes)
+			&& Property->Identical_InContainer(Source, Destination, 0, PPF_None);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAruChangeSetValueRoundTripTest, "AruEditorUtilities.ChangeSet.ValueRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAruChangeSetValueRoundTripTest::RunTest(const FString& Parameters)
+{
+	UAruTestObject* Source = NewObject<UAruTestObject>();
+	Source->Value = 42;
+	Source->Values = {1, 2, 3};
+	Source->Pairs.Add(TEXT("Goblin"), 7);
+	Source->Names.Add(TEXT("Orc"));
+	Source->Target = NewObject<UAruTestObject>();
+	UAruTestObject* Destination = NewObject<UAruTestObject>();
+
+	for (const FName PropertyName : {
+		GET_MEMBER_NAME_CHECKED(UAruTestObject, Value),
+		GET_MEMBER_NAME_CHECKED(UAruTestObject, Values),
+		GET_MEMBER_NAME_CHECKED(UAruTestObject, Pairs),
+		GET_MEMBER_NAME_CHECKED(UAruTestObject, Names),
+		GET_MEMBER_NAME_CHECKED(UAruTestObject, Target)})
+	{
+		TestTrue(FString::Printf(TEXT("'%s' survives serialization"), *PropertyName.ToString()),
+			Aru::Tests::RoundTrip(Aru::Tests::FindTestProperty(PropertyName), Source, Destination));
+	}
+
+	// Bytes that end early are refused instead of read partially.
+	const FProperty* ValuesProperty = Aru::Tests::FindTestProperty(GET_MEMBER_NAME_CHECKED(UAruTestObject, Values));
+	TArray<uint8> Bytes;
+	Aru::Values::Serialize(ValuesProperty, &Source->Values, Bytes);
+	TestFalse(TEXT("Truncated bytes are refused"), Aru::Values::Deserialize(ValuesProperty, &Destination->Values, TConstArrayView<uint8>{Bytes}.LeftChop(1)));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAruChangeSetPreviewThroughReferenceTest, "AruEditorUtilities.ChangeSet.PreviewThroughReference",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAruChangeSetPreviewThroughReferenceTest::RunTest(const FString& Parameters)
+{
+	UAruTestObject* Source = NewObject<UAruTestObject>();
+	UAruTestObject* Target = NewObject<UAruTestObject>();
+	Source->Target = Target;
+	Target->Value = 1;
+
+	const TArray<FAruActionDefinition> Actions{
+		Aru::Tests::MakeAction(TEXT("Target"), TInstancedStruct<FAruPredicate>::Make<FAruPredicate_PathToProperty>(
+			FString{TEXT("Value")}, TInstancedStruct<FAruPredicate>::Make<FAruPredicate_SetIntegerValue>(int64{5})))};
+	const FAruProcessConfig Configs = Aru::Tests::MakeConfigs();
+
+	const TSharedRef<const FAruChangeSet> ChangeSet = UAruFunctionLibrary::PreviewAssets({Source}, Actions, Configs);
+	TestEqual(TEXT("The referenced object keeps its value"), Target->Value, 1);
+	if (TestEqual(TEXT("The write is recorded once"), ChangeSet->Num(), 1))
+	{
+		const FAruPropertyChange& Change = ChangeSet->GetChanges()[0];
+		TestTrue(TEXT("The change belongs to the referenced object"), ChangeSet->GetObjects()[Change.ObjectIndex] == FSoftObjectPath{Target});
+		TestEqual(TEXT("The change is at the value's path"), Change.Path.ToString(), FString{TEXT("Value")});
+
+		int32 NewValue = 0;
+		TestTrue(TEXT("The new value is readable"), Aru::Values::Deserialize(Change.Property, &NewValue, Change.NewValue));
+		TestEqual(TEXT("The new value is the written one"), NewValue, 5);
+	}
+
+	UAruFunctionLibrary::ModifyAssets({Source}, Actions, Configs);
+	TestEqual(TEXT("A writing run writes the referenced object"), Target->Value, 5);
+	return true;
+}
+
+#endif
@@ -0,0 +1,136 @@
+#include "AruChangeSet.h"
+#include "AruCompiledPath.h"
+#include "AruPatch.h"
+#include "AruProcessingContext.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "Tests/AruTestTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace Aru::Tests
+{
+	/** Sparse index of the pair with this key, or INDEX_NONE. */
+	static int32 FindPairIndex(UAruTestObject* Object, const FName Key)
+	{
+		const FMapProperty* PairsProperty = FindFProperty<FMapProperty>(UAruTestObject::StaticClass(), GET_MEMBER_NAME_CHECKED(UAruTestObject, Pairs));
+		FScriptMapHelper MapHelper{PairsProperty, &Object->Pairs};
+		for (int32 Index = 0; Index < MapHelper.GetMaxIndex(); ++Index)
+		{
+			if (MapHelper.IsValidIndex(Index) && *reinterpret_cast<const FName*>(MapHelper.GetKeyPtr(Index)) == Key)
+			{
+				return Index;
+			}
+		}
+		return INDEX_NONE;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAruCompiledPathResolveTest, "AruEditorUtilities.Patch.CompiledPathResolve",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAruCompiledPathResolveTest::RunTest(const FString& Parameters)
+{
+	UAruTestObject* Object = NewObject<UAruTestObject>();
+	Object->Values = {1, 2, 3};
+
+	FAruPropertyPath Path;
+	Path.Segments.Add({EAruPathSegment::Property, GET_MEMBER_NAME_CHECKED(UAruTestObject, Values)});
+	Path.Segments.Add({EAruPathSegment::Element, NAME_None, 1});
+
+	const FAruCompiledPath Compiled = FAruCompiledPath::Compile(Object, Path);
+	TestTrue(TEXT("The path compiles"), Compiled.IsValid());
+	TestTrue(TEXT("The compiled path keeps its segments"), Compiled.ToPropertyPath() == Path);
+
+	const FAruResolvedValue Element = Compiled.Resolve(Object);
+	if (TestTrue(TEXT("The element resolves"), Element.IsValid()))
+	{
+		TestTrue(TEXT("The element is an int"), Element.Property->IsA<FIntProperty>());
+		TestEqual(TEXT("The element is the second one"), *static_cast<const int32*>(Element.Value), 2);
+	}
+
+	const FAruResolvedValue Container = Compiled.Resolve(Object, 1);
+	TestTrue(TEXT("The first step leads to the array"), Container.IsValid() && Container.Value == &Object->Values);
+
+	Object->Values.SetNum(1);
+	TestFalse(TEXT("A removed element doesn't resolve"), Compiled.Resolve(Object).IsValid());
+
+	FAruPropertyPath MissingPath;
+	MissingPath.Segments.Add({EAruPathSegment::Property, FName{TEXT("Missing")}});
+	TestFalse(TEXT("A missing property doesn't compile"), FAruCompiledPath::Compile(Object, MissingPath).IsValid());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAruPatchVerifyTest, "AruEditorUtilities.Patch.Verify",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAruPatchVerifyTest::RunTest(const FString& Parameters)
+{
+	UAruTestObject* Object = NewObject<UAruTestObject>();
+	Object->Pairs.Add(TEXT("Goblin"), 1);
+	Object->Pairs.Add(TEXT("Orc"), 2);
+	const int32 OrcIndex = Aru::Tests::FindPairIndex(Object, TEXT("Orc"));
+
+	// Records Value 0 -> 5 and the Orc's 2 -> 7, as a dry run would.
+	const FString Filename = FPaths::CreateTempFilename(*FPaths::ProjectSavedDir(), TEXT("AruPatchTest"), TEXT(".arupatch"));
+	{
+		FAruProcessConfig Configs = Aru::Tests::MakeConfigs();
+		Configs.bDryRun = true;
+		FAruProcessingContext Context{Configs};
+		FAruProcessingContextScope ContextScope{&Context};
+		FAruChangeSet& ChangeSet = *Context.GetChangeSet();
+
+		const FAruPathScope ObjectScope{Object};
+		{
+			const FAruPathScope PropertyScope{EAruPathSegment::Property, GET_MEMBER_NAME_CHECKED(UAruTestObject, Value)};
+			const int32 NewValue = 5;
+			ChangeSet.Record(FindFProperty<FProperty>(UAruTestObject::StaticClass(), GET_MEMBER_NAME_CHECKED(UAruTestObject, Value)), &Object->Value, &NewValue);
+		}
+		{
+			const FMapProperty* PairsProperty = FindFProperty<FMapProperty>(UAruTestObject::StaticClass(), GET_MEMBER_NAME_CHECKED(UAruTestObject, Pairs));
+			const FAruPathScope PropertyScope{EAruPathSegment::Property, GET_MEMBER_NAME_CHECKED(UAruTestObject, Pairs)};
+			const FAruPathScope ValueScope{EAruPathSegment::MapValue, NAME_None, OrcIndex};
+			const int32 NewValue = 7;
+			ChangeSet.Record(PairsProperty->ValueProp, &Object->Pairs[TEXT("Orc")], &NewValue);
+		}
+		TestEqual(TEXT("Both changes are recorded"), ChangeSet.Num(), 2);
+		TestTrue(TEXT("The patch is saved"), FAruPatch::Save(ChangeSet, Filename));
+	}
+
+	const TUniquePtr<FAruPatch> Patch = FAruPatch::Open(Filename);
+	if (!TestTrue(TEXT("The patch opens"), Patch.IsValid()))
+	{
+		return false;
+	}
+
+	// Another key at the Orc's index holds the same value, which still isn't what the patch was made against.
+	Object->Pairs.Remove(TEXT("Orc"));
+	Object->Pairs.Add(TEXT("Troll"), 2);
+	const FAruPatchApplyResult Conflicting = Patch->Apply();
+	TestTrue(TEXT("Another element at the index conflicts"), Conflicting.HasConflicts());
+	TestEqual(TEXT("The conflicting package is left alone"), Object->Value, 0);
+	TestEqual(TEXT("The other key keeps its value"), Object->Pairs[TEXT("Troll")], 2);
+
+	Object->Pairs.Remove(TEXT("Troll"));
+	Object->Pairs.Add(TEXT("Orc"), 2);
+	if (Aru::Tests::FindPairIndex(Object, TEXT("Orc")) == OrcIndex)
+	{
+		const FAruPatchApplyResult Applied = Patch->Apply();
+		TestFalse(TEXT("The original content applies cleanly"), Applied.HasConflicts());
+		TestEqual(TEXT("Both values are applied"), Applied.NumApplied, 2);
+		TestEqual(TEXT("Value is patched"), Object->Value, 5);
+		TestEqual(TEXT("The Orc is patched"), Object->Pairs[TEXT("Orc")], 7);
+		TestEqual(TEXT("A second apply finds both values applied"), Patch->Apply().NumAlreadyApplied, 2);
+	}
+
+	Object->Value = 3;
+	const FAruPatchApplyResult Changed = Patch->Apply();
+	TestEqual(TEXT("A value changed since the dry run conflicts"), Changed.NumConflicts, 1);
+	TestEqual(TEXT("The changed value is kept"), Object->Value, 3);
+
+	IFileManager::Get().Delete(*Filename);
+	return true;
+}
+
+#endif
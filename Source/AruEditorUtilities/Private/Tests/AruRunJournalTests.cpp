@@ -0,0 +1,66 @@
+#include "AruFunctionLibrary.h"
+#include "Editor.h"
+#include "AssetPredicates/AruPredicate_PathToProperty.h"
+#include "AssetPredicates/AruPredicate_PropertySetter.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AruTestTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAruRunJournalRollbackTest, "AruEditorUtilities.RunJournal.Rollback",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAruRunJournalRollbackTest::RunTest(const FString& Parameters)
+{
+	UAruTestObject* Source = NewObject<UAruTestObject>();
+	UAruTestObject* Target = NewObject<UAruTestObject>();
+	Source->Value = 1;
+	Source->Target = Target;
+	Target->Value = 1;
+
+	// The first action writes both objects while traversing them, the second writes the target again through the reference.
+	const TArray<FAruActionDefinition> Actions{
+		Aru::Tests::MakeAction(TEXT("Value"), TInstancedStruct<FAruPredicate>::Make<FAruPredicate_SetIntegerValue>(int64{5})),
+		Aru::Tests::MakeAction(TEXT("Target"), TInstancedStruct<FAruPredicate>::Make<FAruPredicate_PathToProperty>(
+			FString{TEXT("Value")}, TInstancedStruct<FAruPredicate>::Make<FAruPredicate_SetIntegerValue>(int64{9})))};
+	FAruProcessConfig Configs = Aru::Tests::MakeConfigs();
+	Configs.bJournalChanges = true;
+
+	TestTrue(TEXT("The run writes"), UAruFunctionLibrary::ModifyAssets({Source}, Actions, Configs));
+	TestEqual(TEXT("The source is written"), Source->Value, 5);
+	TestEqual(TEXT("The target is written through the reference last"), Target->Value, 9);
+
+	TestTrue(TEXT("The run rolls back"), UAruFunctionLibrary::RollbackLastRun());
+	TestEqual(TEXT("The source is restored"), Source->Value, 1);
+	TestEqual(TEXT("The target is restored past both writes"), Target->Value, 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAruRunJournalEditorUndoTest, "AruEditorUtilities.RunJournal.EditorUndo",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAruRunJournalEditorUndoTest::RunTest(const FString& Parameters)
+{
+	UAruTestObject* Source = NewObject<UAruTestObject>(GetTransientPackage(), NAME_None, RF_Transactional);
+	UAruTestObject* Target = NewObject<UAruTestObject>(GetTransientPackage(), NAME_None, RF_Transactional);
+	Source->Value = 1;
+	Source->Target = Target;
+	Target->Value = 1;
+
+	// Without a journal the run is an editor transaction, which has to hold both objects as they were before the writes.
+	const TArray<FAruActionDefinition> Actions{
+		Aru::Tests::MakeAction(TEXT("Value"), TInstancedStruct<FAruPredicate>::Make<FAruPredicate_SetIntegerValue>(int64{5}))};
+	TestTrue(TEXT("The run writes"), UAruFunctionLibrary::ModifyAssets({Source}, Actions, Aru::Tests::MakeConfigs()));
+	TestEqual(TEXT("The source is written"), Source->Value, 5);
+	TestEqual(TEXT("The target is written through the reference"), Target->Value, 5);
+
+	if (TestNotNull(TEXT("The editor is running"), GEditor))
+	{
+		TestTrue(TEXT("The run is undone in one step"), GEditor->UndoTransaction());
+		TestEqual(TEXT("The source is restored"), Source->Value, 1);
+		TestEqual(TEXT("The target is restored"), Target->Value, 1);
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AruTypes.h"
+#include "AssetCollector/AruAssetCollector.h"
+#include "AssetFilters/AruFilter_ByName.h"
+#include "UObject/Object.h"
+#include "AruTestTypes.generated.h"
+
+/** Object the automation tests run rules on. */
+UCLASS(Transient, NotBlueprintable)
+class UAruTestObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	int32 Value = 0;
+
+	UPROPERTY()
+	TArray<int32> Values;
+
+	UPROPERTY()
+	TArray<float> Weights;
+
+	UPROPERTY()
+	TMap<FName, int32> Pairs;
+
+	UPROPERTY()
+	TSet<FName> Names;
+
+	/** Another fixture, so rules can reach values through an object reference. */
+	UPROPERTY()
+	TObjectPtr<UAruTestObject> Target;
+};
+
+/** Collector the tests fill by hand. */
+UCLASS(Transient, NotBlueprintable)
+class UAruTestCollector : public UAruAssetCollector
+{
+	GENERATED_BODY()
+};
+
+namespace Aru::Tests
+{
+	/** Action running the predicate on every property with exactly this name. */
+	FORCEINLINE FAruActionDefinition MakeAction(const TCHAR* PropertyName, TInstancedStruct<FAruPredicate> Predicate)
+	{
+		return FAruActionDefinition{
+			{TInstancedStruct<FAruFilter>::Make<FAruFilter_ByName>(EAruNameCompareOp::MatchAll, FString{PropertyName})},
+			{MoveTemp(Predicate)}};
+	}
+
+	/** Quiet configs, so expected warnings don't reach the automation log. */
+	FORCEINLINE FAruProcessConfig MakeConfigs()
+	{
+		FAruProcessConfig Configs;
+		Configs.LogVerbosity = EAruLogVerbosity::Errors;
+		return Configs;
+	}
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AruFunctionLibrary.h"
+#include "AruProcessingContext.h"
+#include "Containers/Ticker.h"
+#include "AruAsyncRun.generated.h"
+
+class SNotificationItem;
+
+UENUM(BlueprintType)
+enum class EAruAsyncRunState : uint8
+{
+	Running,
+	Paused,
+	Cancelled,
+	Finished
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAruAsyncRunFinished, bool, bResult);
+
+/**
+ * Run that processes its assets on the game thread a slice at a time, spending at most FrameBudgetMilliseconds per editor tick,
+ * so the editor stays usable during long audits. Each asset is processed whole within one slice.
+ * Started through UAruFunctionLibrary::ModifyAssetsAsync and ValidateAssetsAsync, and kept alive until it ends.
+ */
+UCLASS(BlueprintType, Transient)
+class ARUEDITORUTILITIES_API UAruAsyncRun : public UObject
+{
+	GENERATED_BODY()
+
+	friend class UAruFunctionLibrary;
+
+public:
+	/** Broadcast once the run finished or was cancelled, with the result the blocking call would have returned. */
+	UPROPERTY(BlueprintAssignable, Category = "Aru Editor Utilities")
+	FAruAsyncRunFinished OnFinished;
+
+	/** Time spent processing per editor tick. A slice always processes at least one asset. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aru Editor Utilities", meta = (ClampMin = 1))
+	float FrameBudgetMilliseconds = 10.f;
+
+	UFUNCTION(BlueprintCallable, Category = "Aru Editor Utilities")
+	void Pause();
+
+	UFUNCTION(BlueprintCallable, Category = "Aru Editor Utilities")
+	void Resume();
+
+	/** Stops after the current asset. What was already written stays, and RollbackLastRun undoes it for journaled runs. */
+	UFUNCTION(BlueprintCallable, Category = "Aru Editor Utilities")
+	void Cancel();
+
+	UFUNCTION(BlueprintPure, Category = "Aru Editor Utilities")
+	FORCEINLINE EAruAsyncRunState GetState() const { return State; }
+
+	UFUNCTION(BlueprintPure, Category = "Aru Editor Utilities")
+	FORCEINLINE int32 GetNumProcessed() const { return NextObjectIndex; }
+
+	UFUNCTION(BlueprintPure, Category = "Aru Editor Utilities")
+	FORCEINLINE int32 GetNumAssets() const { return Objects.Num(); }
+
+	/** Share of the assets processed so far, from 0 to 1. */
+	UFUNCTION(BlueprintPure, Category = "Aru Editor Utilities")
+	float GetProgress() const;
+
+	/** Assets per second of processing time. Pauses and the time between slices don't count. */
+	UFUNCTION(BlueprintPure, Category = "Aru Editor Utilities")
+	float GetThroughput() const;
+
+	/** Wall-clock seconds until the run ends at the current throughput and frame budget. Negative until the first slice ran. */
+	UFUNCTION(BlueprintPure, Category = "Aru Editor Utilities")
+	float GetEstimatedSecondsRemaining() const;
+
+	/** What the run reported so far: a change for modify runs, no failure for validation runs. */
+	UFUNCTION(BlueprintPure, Category = "Aru Editor Utilities")
+	FORCEINLINE bool GetResult() const { return bResult; }
+
+protected:
+	virtual void BeginDestroy() override;
+
+private:
+	/**
+	 * Binds a new run to the calling thread, lets the caller build the processor within it, and starts ticking.
+	 * The processor may keep references to the configs it is given, which live as long as the run.
+	 */
+	void Start(
+		const TArray<UObject*>& InObjects,
+		const FAruProcessConfig& InConfigs,
+		const EAruProcessMode InMode,
+		TFunctionRef<TFunction<bool(const FProperty*, void*)>(const FAruProcessConfig&)> InMakeProcessor);
+
+	bool Tick(float DeltaTime);
+	void ProcessSlice();
+	void Finish(const EAruAsyncRunState InState);
+	void UpdateNotification();
+
+	UPROPERTY()
+	TArray<TObjectPtr<UObject>> Objects;
+
+	/** Definitions the processor runs, owned here so their proxies stay referenced. */
+	UPROPERTY()
+	TArray<FAruActionDefinition> Actions;
+
+	UPROPERTY()
+	TArray<FAruValidationDefinition> Validations;
+
+	FAruProcessConfig Configs;
+	EAruProcessMode Mode = EAruProcessMode::Modify;
+	TUniquePtr<FAruProcessingContext> Context;
+	TFunction<bool(const FProperty*, void*)> Processor;
+
+	EAruAsyncRunState State = EAruAsyncRunState::Finished;
+	int32 NextObjectIndex = 0;
+	bool bResult = false;
+
+	/** Seconds spent in slices, and wall-clock time of the run. */
+	double ProcessingSeconds = 0.0;
+	double WallSeconds = 0.0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	TWeakPtr<SNotificationItem> Notification;
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AruProcessingContext.h"
+#include "AruPropertyPath.h"
+
+namespace Aru::Values
+{
+	/** Writes the value in the property's binary form. Object and name references are stored as paths, so the bytes outlive the session. */
+	ARUEDITORUTILITIES_API void Serialize(const FProperty* InProperty, const void* InValue, TArray<uint8>& OutBytes);
+
+	/**
+	 * Reads bytes written by Serialize into an initialized value. Returns false if they don't fit the property.
+	 * Without bLoadReferences, referenced objects must already be loaded, which makes it safe on worker threads.
+	 */
+	ARUEDITORUTILITIES_API bool Deserialize(const FProperty* InProperty, void* OutValue, TConstArrayView<uint8> InBytes, const bool bLoadReferences = true);
+
+	/** Text form of serialized bytes, for reports. */
+	ARUEDITORUTILITIES_API FString ExportText(const FProperty* InProperty, TConstArrayView<uint8> InBytes);
+}
+
+/** One value a dry run would change. */
+struct FAruPropertyChange
+{
+	/** Index into the change set's objects. */
+	int32 ObjectIndex = INDEX_NONE;
+	FAruPropertyPath Path;
+
+	/** Property of the changed value. Only valid while its owning type is loaded. */
+	const FProperty* Property = nullptr;
+
+	TArray<uint8> OldValue;
+	TArray<uint8> NewValue;
+};
+
+/**
+ * Everything a dry run would have written, as old and new bytes per property path.
+ * Filled by the run's workers in any order; Sort puts it in a stable order once the run ends.
+ */
+class ARUEDITORUTILITIES_API FAruChangeSet : public FNoncopyable
+{
+public:
+	/** Records the difference at the calling thread's current path. Returns false if the values are identical. */
+	bool Record(const FProperty* InProperty, const void* InOldValue, const void* InNewValue);
+
+	/**
+	 * Records the differences below the current path, one change per innermost value that differs, e.g. per struct field
+	 * or array element. Containers that changed their size or keys are recorded whole. Returns the number of changes.
+	 */
+	int32 RecordDifferences(const FProperty* InProperty, const void* InOldValue, const void* InNewValue);
+
+	/** Orders the changes by object and path, so two dry runs over the same content compare equal. */
+	void Sort();
+
+	FORCEINLINE const TArray<FSoftObjectPath>& GetObjects() const { return Objects; }
+	FORCEINLINE const TArray<FAruPropertyChange>& GetChanges() const { return Changes; }
+	FORCEINLINE int32 Num() const { return Changes.Num(); }
+	FORCEINLINE bool IsEmpty() const { return Changes.IsEmpty(); }
+
+	/** Writes a summary and the first changes as text to the message log. */
+	void Report(const int32 MaxReportedChanges = 100) const;
+
+	/** Change set of the last dry run, or nullptr if there was none yet. */
+	static TSharedPtr<const FAruChangeSet> GetLast();
+	static void PublishLast(const TSharedRef<const FAruChangeSet>& InChangeSet);
+
+private:
+	int32 RecordMemberDifferences(const UStruct* InStruct, const void* InOldContainer, const void* InNewContainer);
+
+	FCriticalSection Lock;
+	TArray<FSoftObjectPath> Objects;
+	TMap<FSoftObjectPath, int32> ObjectIndices;
+	TArray<FAruPropertyChange> Changes;
+};
+
+/**
+ * Prepares a value for the first write of a run once the first definition matches, so values no rule touches cost what a validation does:
+ * a transacted run saves the owning object to its transaction, a journaled run copies what the value held. Predicates keep writing to the value itself.
+ */
+class ARUEDITORUTILITIES_API FAruShadowValue : public FNoncopyable
+{
+public:
+	FAruShadowValue(const FProperty* InProperty, void* InOriginal, const bool bInKeepCopy);
+
+	/** What conditions see. */
+	FORCEINLINE const void* Read() const { return Original; }
+
+	/** Where predicates write, preparing the value on first use. Nullptr if the snapshot couldn't be allocated. */
+	void* Write();
+
+	FORCEINLINE bool HasCopy() const { return Copy.IsSet() && Copy->IsValid(); }
+	FORCEINLINE const void* GetCopy() const { return HasCopy() ? Copy->Get() : nullptr; }
+	FORCEINLINE const void* GetOriginal() const { return Original; }
+
+private:
+	const FProperty* Property = nullptr;
+	void* Original = nullptr;
+	bool bKeepCopy = false;
+	bool bWritten = false;
+	TOptional<FAruScopedScratchValue> Copy;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AruPropertyPath.h"
+
+/** Step of a compiled path. */
+struct FAruPathStep
+{
+	EAruPathSegment Kind = EAruPathSegment::Property;
+	FName Name;
+	int32 Index = INDEX_NONE;
+
+	/** Property a Property step reads, resolved up front. Nullptr inside instanced structs, whose type is only known per value. */
+	const FProperty* Property = nullptr;
+};
+
+/** Value a path leads to, and the property describing it. */
+struct FAruResolvedValue
+{
+	const FProperty* Property = nullptr;
+	void* Value = nullptr;
+
+	FORCEINLINE bool IsValid() const { return Property != nullptr && Value != nullptr; }
+};
+
+/**
+ * Property path resolved against the type it starts from, so walking it to a value is a few pointer offsets
+ * instead of a traversal. Compiled once per type and path, it resolves on any thread.
+ */
+class ARUEDITORUTILITIES_API FAruCompiledPath
+{
+public:
+	/** Compiles the path against the object's type. Rows of a DataTable are compiled against its row struct. */
+	static FAruCompiledPath Compile(const UObject* InRoot, const FAruPropertyPath& InPath);
+
+	/**
+	 * Walks the path in the object. Invalid if a property, element or row no longer exists.
+	 * With fewer steps, only walks the first ones, e.g. to the container of an element.
+	 */
+	FAruResolvedValue Resolve(UObject* InObject, const int32 InNumSteps = MAX_int32) const;
+
+	FORCEINLINE bool IsValid() const { return bValid; }
+	FORCEINLINE TConstArrayView<FAruPathStep> GetSteps() const { return Steps; }
+
+	/** Segments the path was compiled from. */
+	FAruPropertyPath ToPropertyPath() const;
+
+private:
+	TArray<FAruPathStep> Steps;
+	bool bValid = false;
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace Aru::Container
+{
+	/**
+	 * Resolves staged key changes of a set or map against the keys it currently holds.
+	 * Changes are checked in order with a temporary hash index, which gives the same outcome as
+	 * writing and rehashing one element at a time, but lets the caller rehash only once.
+	 *
+	 * @param KeyProperty       Element property of a set, or key property of a map.
+	 * @param MaxIndex          Upper bound of the container's sparse element indices.
+	 * @param GetKeyPtr         Returns the key stored at an index, or nullptr for an invalid slot.
+	 * @param ChangedIndices    Container indices whose key is replaced, in processing order.
+	 * @param StagedKeys        New key for each entry of ChangedIndices.
+	 *
+	 * @return                  Per change, true if it can be written without colliding with another key.
+	 */
+	ARUEDITORUTILITIES_API TBitArray<> ResolveStagedKeys(
+		const FProperty* KeyProperty,
+		const int32 MaxIndex,
+		TFunctionRef<const void*(int32)> GetKeyPtr,
+		TConstArrayView<int32> ChangedIndices,
+		TConstArrayView<const void*> StagedKeys);
+
+	/**
+	 * Removes every array element matching the predicate in a single stable pass.
+	 * Matched elements are destroyed in place and survivors slide down in contiguous runs,
+	 * relying on reflected values being bitwise relocatable like TArray itself does.
+	 *
+	 * @return                  Number of removed elements.
+	 */
+	ARUEDITORUTILITIES_API int32 CompactArray(
+		FScriptArrayHelper& ArrayHelper,
+		const FProperty* InnerProperty,
+		TFunctionRef<bool(const void*)> ShouldRemove);
+}
@@ -2,15 +2,34 @@
 
 #include "CoreMinimal.h"
 #include "AruTypes.h"
+#include "AruPropertyPath.h"
 #include "AruFunctionLibrary.generated.h"
 
+class FAruChangeSet;
+class UAruAsyncRun;
 struct FAruActionDefinition;
+struct FAruTagMask;
+class UAruAssetCollector;
+class UDataTable;
+
+/** Whether a run is allowed to write to assets. Only Modify runs mark packages dirty. */
+enum class EAruProcessMode : uint8
+{
+	Modify,
+	Validate,
+	/** Dry run: the processor writes into copies of the values and the differences go to the run's change set, so nothing is marked dirty. */
+	Preview
+};
 
 struct FAruPropertyContext
 {
 	FProperty* PropertyPtr		= nullptr;
 	TOptional<void*> ValuePtr	= {};
 
+	/** Last object the path crossed a reference into, and the value's path inside it. Nullptr if the value is part of the searched one. */
+	UObject* Owner				= nullptr;
+	FAruPropertyPath OwnerPath;
+
 	FAruPropertyContext() : PropertyPtr (nullptr), ValuePtr ({}) {}
 	FAruPropertyContext(FProperty* InPropertyPtr, void* InValuePtr) : PropertyPtr (InPropertyPtr), ValuePtr (TOptional<void*>{InValuePtr}) {}
 
@@ -23,16 +42,20 @@ struct FAruProcessingParameters
 	const int32										RemainTime;
 	const TFunction<bool(const FProperty*, void*)>&	PropertyProcessor;
 
+	/** Change set of a dry run. Set, the processor runs on copies of the values. */
+	FAruChangeSet* const							ChangeSet;
+
 	FAruProcessingParameters() = delete;
 	FAruProcessingParameters(
 		const TFunction<bool(const FProperty*, void*)>&	InProcessor,
 		const FInstancedPropertyBag&					InParameters,
-		const int32										InRemainTime)
-			: Parameters(InParameters), RemainTime(InRemainTime), PropertyProcessor(InProcessor){};
+		const int32										InRemainTime,
+		FAruChangeSet*									InChangeSet = nullptr)
+			: Parameters(InParameters), RemainTime(InRemainTime), PropertyProcessor(InProcessor), ChangeSet(InChangeSet){};
 
 	FAruProcessingParameters GetSubsequentParameters() const
 	{
-		return {PropertyProcessor, Parameters, RemainTime-1};
+		return {PropertyProcessor, Parameters, RemainTime-1, ChangeSet};
 	} 
 };
 
@@ -54,15 +77,107 @@ public:
 	UFUNCTION(BlueprintCallable, CallInEditor)
 	static bool ValidateAssets(const TArray<UObject*>& AssetsToValidate, const TArray<FAruValidationDefinition>& Validations, const FAruProcessConfig& Configs);
 
+	/**
+	 * Runs each action only on the collected assets that carry all of its ActionTags. Actions without tags run on every asset.
+	 * Assets with the same tags share one routing decision, so rules that can never apply to an asset are never invoked.
+	 */
+	UFUNCTION(BlueprintCallable, CallInEditor)
+	static bool ModifyCollectedAssets(const UAruAssetCollector* Collector, const TArray<FAruActionDefinition>& Actions, const FAruProcessConfig& Configs);
+
+	/** Validates each collected asset against the definitions whose ValidationTags it carries. */
+	UFUNCTION(BlueprintCallable, CallInEditor)
+	static bool ValidateCollectedAssets(const UAruAssetCollector* Collector, const TArray<FAruValidationDefinition>& Validations, const FAruProcessConfig& Configs);
+
+	/**
+	 * ModifyAssets without blocking the editor: the assets are processed a time-budgeted slice per editor tick.
+	 * The returned run can be paused or cancelled, and reports progress, throughput and time remaining.
+	 */
+	UFUNCTION(BlueprintCallable, CallInEditor)
+	static UAruAsyncRun* ModifyAssetsAsync(const TArray<UObject*>& AssetsToModify, const TArray<FAruActionDefinition>& Actions, const FAruProcessConfig& Configs);
+
+	/** ValidateAssets without blocking the editor, see ModifyAssetsAsync. */
+	UFUNCTION(BlueprintCallable, CallInEditor)
+	static UAruAsyncRun* ValidateAssetsAsync(const TArray<UObject*>& AssetsToValidate, const TArray<FAruValidationDefinition>& Validations, const FAruProcessConfig& Configs);
+
+	/**
+	 * Dry run of ModifyAssets: returns what the actions would change, as old and new bytes per property path,
+	 * without writing to or dirtying any asset.
+	 */
+	static TSharedRef<const FAruChangeSet> PreviewAssets(
+		const TArray<UObject*>& Objects,
+		const TArray<FAruActionDefinition>& Actions,
+		const FAruProcessConfig& Configs);
+
+	/** Reopens the table of the last run that had bProfileRules set. Returns false if no run was profiled yet. */
+	UFUNCTION(BlueprintCallable, CallInEditor)
+	static bool OpenLastProfileReport();
+
+	/**
+	 * Compiles the change set of the last dry run into a patch file, which ApplyPatch replays without evaluating any rule.
+	 * Relative file names are placed under Saved/AruEditorUtilities/Patches.
+	 */
+	UFUNCTION(BlueprintCallable, CallInEditor)
+	static bool SaveLastChangeSetAsPatch(const FString& Filename);
+
+	/**
+	 * Writes the values of a patch file into the assets it was made from. A value that changed since the dry run is a conflict
+	 * and is left alone, with the rest of its package unless bSkipConflictingPackages is off. Returns false if anything conflicted.
+	 */
+	UFUNCTION(BlueprintCallable, CallInEditor)
+	static bool ApplyPatch(const FString& Filename, const bool bSkipConflictingPackages = true);
+
+	/**
+	 * Restores every value the last journaled run changed and removes that run from the history, so calling it again
+	 * undoes the run before. Returns false if there is no run to roll back.
+	 */
+	UFUNCTION(BlueprintCallable, CallInEditor)
+	static bool RollbackLastRun();
+
+	/**
+	 * Collection pass of a preloading run: gathers every asset the actions may load for these objects
+	 * and loads them into the current run's asset cache with one batched request.
+	 * Reports into the caller's progress dialog instead of opening one.
+	 */
+	static void PreloadAssets(
+		const TArray<UObject*>& Objects,
+		const TArray<FAruActionDefinition>& Actions,
+		const FAruProcessConfig& Configs);
+
+	static void PreloadAssets(
+		const TArray<UObject*>& Objects,
+		TConstArrayView<const FAruActionDefinition*> Actions,
+		const FAruProcessConfig& Configs);
+
 	static bool ProcessAssets(
 		const TArray<UObject*>& Objects,
 		const FAruProcessConfig& Configs,
-		const TFunction<bool(const FProperty*, void*)>&	PropertyProcessor);
+		const TFunction<bool(const FProperty*, void*)>&	PropertyProcessor,
+		const EAruProcessMode Mode = EAruProcessMode::Modify);
 
+	/**
+	 * Run the processor over every property of the asset.
+	 * In Modify mode the asset is only marked dirty when the processor reported an actual change.
+	 */
 	static bool ProcessAsset(
 		UObject* const Object,
 		const FAruProcessConfig& Configs,
-		const TFunction<bool(const FProperty*, void*)>&	PropertyProcessor);
+		const TFunction<bool(const FProperty*, void*)>&	PropertyProcessor,
+		const EAruProcessMode Mode = EAruProcessMode::Modify);
+
+	/**
+	 * Treat every row of a DataTable as a struct root and process its properties.
+	 * Composite tables forward to their parent tables, since their own rows are rebuilt copies.
+	 */
+	static bool ProcessDataTableRows(
+		UDataTable* const DataTable,
+		const FAruProcessConfig& Configs,
+		const TFunction<bool(const FProperty*, void*)>&	PropertyProcessor,
+		const EAruProcessMode Mode = EAruProcessMode::Modify);
+
+	static bool ProcessStructValues(
+		const UStruct* StructType,
+		void* StructValue,
+		const FAruProcessingParameters& InParameters);
 
 	static FAruPropertyContext FindPropertyByPath(
 		const FProperty* InProperty,
@@ -88,14 +203,34 @@ public:
 		void* ValuePtr,
 		const FAruProcessingParameters& InParameters);
 
+	/**
+	 * ProcessContainerValues for a property of an object or DataTable row. In a dry run the processor runs on a copy,
+	 * so later rules see earlier writes like in a writing run, and the differences are recorded in the change set.
+	 */
+	static bool ProcessRootProperty(
+		FProperty* PropertyPtr,
+		void* ValuePtr,
+		const FAruProcessingParameters& InParameters);
+
+	/**
+	 * Runs the writer on a value found by path. A value inside another object is written to a copy and recorded in a dry run,
+	 * and only written on the game thread otherwise, after the object was marked modified and into the run's journal if it keeps one.
+	 */
+	static bool WriteFoundProperty(
+		const FAruPropertyContext& PropertyContext,
+		const TFunctionRef<bool(const FProperty*, void*)> Writer);
+
 	static FString ResolveParameterizedString(const FInstancedPropertyBag& InParameters, const FString& SourceString);
 
 	/**
 	 * Determine if an AssetObject's tags match with a Definition's tags
 	 * @param AssetObject The asset object containing tags to check
 	 * @param Tags The tags to check against
-	 * @return True if any tag in the AssetObject matches any tag in the Definition, or if either tag list is empty
+	 * @return True if the AssetObject carries every tag of the Definition, or if the Definition has no tags
 	 */
 	UFUNCTION(BlueprintPure, Category = "Aru Editor Utilities")
 	static bool IsTagMatching(const class UAruAssetObject* AssetObject, const TArray<FName>& Tags);
+
+	/** Same check on masks of one tag dictionary. */
+	static bool IsTagMaskMatching(const FAruTagMask& AssetTags, const FAruTagMask& Tags);
 };
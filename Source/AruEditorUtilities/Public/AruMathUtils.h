@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AruTypes.h"
+
+/** Well-known math structs that rules read and write as a single SIMD register. */
+enum class EAruMathStruct : uint8
+{
+	None,
+	Vector,
+	Rotator,
+	LinearColor,
+	Transform
+};
+
+namespace Aru::Math
+{
+	ARUEDITORUTILITIES_API EAruMathStruct GetMathStructType(const UScriptStruct* Struct);
+	ARUEDITORUTILITIES_API EAruMathStruct GetMathStructType(const FProperty* Property);
+
+	/** Lanes that carry data: RGBA for colors, XYZ for everything else. */
+	FORCEINLINE int32 GetComponentMask(const EAruMathStruct Type)
+	{
+		return Type == EAruMathStruct::LinearColor ? 0b1111 : 0b0111;
+	}
+
+	/**
+	 * Loads the value's components into one register, with unused lanes zeroed.
+	 * Transforms load the selected part; their rotation is loaded as pitch, yaw and roll.
+	 */
+	ARUEDITORUTILITIES_API VectorRegister4Double Load(const EAruMathStruct Type, const void* Value, const EAruTransformComponent Component);
+
+	/** Writes the register back into the value. Returns false, and writes nothing, when the used lanes already match. */
+	ARUEDITORUTILITIES_API bool StoreIfChanged(const EAruMathStruct Type, void* Value, const EAruTransformComponent Component, const VectorRegister4Double& NewValue);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FAruChangeSet;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+struct FAruPatchApplyOptions
+{
+	/** Leaves a package untouched if any of its values conflicts, instead of applying the rest. */
+	bool bSkipConflictingPackages = true;
+};
+
+/** What applying a patch did, counted in values. */
+struct FAruPatchApplyResult
+{
+	int32 NumApplied = 0;
+
+	/** Values that already hold the patched value, e.g. when a patch is applied twice. */
+	int32 NumAlreadyApplied = 0;
+
+	/** Values that differ from the value the patch was made against. */
+	int32 NumConflicts = 0;
+
+	/** Values whose object, property, element or row doesn't exist. */
+	int32 NumUnresolved = 0;
+
+	/** Values left untouched because their package had a conflict. */
+	int32 NumSkipped = 0;
+
+	int32 NumPackagesChanged = 0;
+
+	FORCEINLINE bool HasConflicts() const { return NumConflicts > 0 || NumUnresolved > 0; }
+};
+
+/**
+ * Change set compiled into a file that can be applied without evaluating any rule, e.g. on another branch.
+ * Values are keyed by package, object and property path, and carry a hash of the value they replace so changed content
+ * is reported as a conflict instead of being overwritten. Map pairs and set elements are addressed by their index in sparse storage,
+ * which only picks the same one on identical content; the key or element found there is checked as well.
+ * The file is read through a memory mapping where the platform supports it.
+ */
+class ARUEDITORUTILITIES_API FAruPatch : public FNoncopyable
+{
+public:
+	~FAruPatch();
+
+	/** Writes the change set as a patch file. Loads every asset its new values reference, to list them for the apply step. */
+	static bool Save(const FAruChangeSet& InChangeSet, const FString& InFilename);
+
+	/** Maps the file and checks its tables. Nullptr if it isn't a readable patch. */
+	static TUniquePtr<FAruPatch> Open(const FString& InFilename);
+
+	/**
+	 * Loads the patched packages in one batched request, then writes their values on worker threads, one package per task,
+	 * inside one undoable transaction. Objects are notified before and after their values change. Must be called on the game thread.
+	 */
+	FAruPatchApplyResult Apply(const FAruPatchApplyOptions& InOptions = {}) const;
+
+	int32 GetNumPackages() const;
+	int32 GetNumValues() const;
+
+private:
+	FAruPatch() = default;
+
+	bool Validate() const;
+	FString GetString(const uint32 InIndex) const;
+
+	template <typename RecordType>
+	TConstArrayView<RecordType> GetTable(const uint64 InOffset, const uint32 InNum) const;
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** Holds the file when it can't be mapped. */
+	TArray64<uint8> LoadedFile;
+
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+};
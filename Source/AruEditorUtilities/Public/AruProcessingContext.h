@@ -0,0 +1,265 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AruTypes.h"
+#include "AruPropertyDispatch.h"
+#include "AruRuleProfiler.h"
+#include "AruRunLog.h"
+#include "AruRunMemory.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "AssetRegistry/AssetData.h"
+
+class FAruChangeSet;
+class FAruRunJournal;
+class FScopedTransaction;
+struct FStreamableHandle;
+struct FStreamableManager;
+
+/**
+ * Per-run pool of scratch values used by predicates to build pending elements, keys and values.
+ * Released values stay initialized and are handed back to the next request for the same property
+ * without touching the allocator.
+ */
+class ARUEDITORUTILITIES_API FAruScratchPool : public FNoncopyable
+{
+public:
+	FAruScratchPool() = default;
+	~FAruScratchPool();
+
+	/** Returns an initialized value of the property's type, or nullptr if allocation failed. */
+	void* Acquire(const FProperty* InProperty);
+
+	/** Hands the value back to the pool. The value is reset to its default but stays initialized. */
+	void Release(const FProperty* InProperty, void* InValue);
+
+	/** Destroys every pooled value and frees all slots. */
+	void Reset();
+
+private:
+	struct FSlotLayout
+	{
+		int32 Size = 0;
+		int32 Alignment = 0;
+	};
+
+	static FSlotLayout GetSlotLayout(const FProperty* InProperty);
+
+	FCriticalSection Lock;
+
+	/** Released values that are still initialized, keyed by the property that owns their layout. */
+	TMap<const FProperty*, TArray<void*>> InitializedSlots;
+};
+
+/**
+ * Scratch value borrowed from the current run's pool for the lifetime of the scope.
+ * Falls back to a plain heap allocation when no processing run is active.
+ */
+struct ARUEDITORUTILITIES_API FAruScopedScratchValue : public FNoncopyable
+{
+	explicit FAruScopedScratchValue(const FProperty* InProperty);
+	~FAruScopedScratchValue();
+
+	FORCEINLINE void* Get() const { return Value; }
+	FORCEINLINE bool IsValid() const { return Value != nullptr; }
+
+private:
+	const FProperty* Property = nullptr;
+	void* Value = nullptr;
+	FAruScratchPool* Pool = nullptr;
+};
+
+/** Contiguous block of initialized values of one property, used to stage bulk container edits. */
+struct ARUEDITORUTILITIES_API FAruScratchArray : public FNoncopyable
+{
+	FAruScratchArray(const FProperty* InProperty, int32 InNum);
+	~FAruScratchArray();
+
+	FORCEINLINE void* GetRawPtr(int32 Index) const { return Data + static_cast<SIZE_T>(Index) * Stride; }
+	FORCEINLINE int32 Num() const { return Data != nullptr ? NumValues : 0; }
+	FORCEINLINE bool IsValid() const { return Data != nullptr || NumValues == 0; }
+
+private:
+	const FProperty* Property = nullptr;
+	uint8* Data = nullptr;
+	int32 NumValues = 0;
+	int32 Stride = 0;
+};
+
+/**
+ * Objects resolved from soft paths during a run.
+ * A preloading run fills it with one batched async request; anything missed is loaded synchronously and remembered.
+ * Asset registry lookups made by soft-reference predicates are remembered here too, so they never load anything.
+ */
+class ARUEDITORUTILITIES_API FAruAssetCache : public FNoncopyable
+{
+public:
+	FAruAssetCache();
+	~FAruAssetCache();
+
+	/** Loads all paths in one async request, blocks until it completes and keeps the results alive for the run. */
+	void Preload(TConstArrayView<FSoftObjectPath> InPaths);
+
+	/** Returns the cached object for the path, loading it on a miss. Failed loads are cached as well. */
+	UObject* Resolve(const FSoftObjectPath& InPath);
+
+	/** Resolves through the current run's cache, or loads directly when no run is active. */
+	static UObject* LoadAsset(const FSoftObjectPath& InPath);
+
+	/** Returns the asset registry entry for the path without loading the asset. Invalid if the registry doesn't know it. */
+	FAssetData ResolveAssetData(const FSoftObjectPath& InPath);
+
+	/** Looks the path up through the current run's cache, or queries the asset registry directly when no run is active. */
+	static FAssetData FindAssetData(const FSoftObjectPath& InPath);
+
+private:
+	FCriticalSection Lock;
+	TMap<FSoftObjectPath, TWeakObjectPtr<UObject>> ResolvedAssets;
+	TSet<FSoftObjectPath> MissingAssets;
+	TMap<FSoftObjectPath, FAssetData> AssetDataCache;
+	TUniquePtr<FStreamableManager> StreamableManager;
+	TArray<TSharedPtr<FStreamableHandle>> Handles;
+};
+
+/**
+ * State shared by every filter and predicate during a single processing run.
+ * The context is bound to the executing thread through FAruProcessingContextScope,
+ * so rules can reach it without changing their signatures.
+ */
+class ARUEDITORUTILITIES_API FAruProcessingContext : public FNoncopyable
+{
+public:
+	explicit FAruProcessingContext(const FAruProcessConfig& InConfigs);
+	~FAruProcessingContext();
+
+	/** Context bound to the calling thread, or nullptr outside a processing run. */
+	static FAruProcessingContext* Get();
+
+	FORCEINLINE const FAruProcessConfig& GetConfigs() const { return Configs; }
+	FORCEINLINE FAruScratchPool& GetScratchPool() { return ScratchPool; }
+	FORCEINLINE FAruAssetCache& GetAssetCache() { return AssetCache; }
+	FORCEINLINE FAruDispatchCache& GetDispatchCache() { return DispatchCache; }
+	FORCEINLINE FAruRunLog& GetRunLog() { return RunLog; }
+	FORCEINLINE FAruRunStats& GetRunStats() { return RunStats; }
+
+	/** Nullptr unless the run is profiled. */
+	FORCEINLINE FAruRuleProfiler* GetRuleProfiler() { return RuleProfiler.Get(); }
+
+	/** Nullptr unless the run reports its memory. */
+	FORCEINLINE FAruRunMemory* GetRunMemory() { return RunMemory.Get(); }
+
+	/** Nullptr unless the run is a dry run. */
+	FORCEINLINE FAruChangeSet* GetChangeSet() { return ChangeSet.Get(); }
+	FORCEINLINE TSharedPtr<const FAruChangeSet> GetSharedChangeSet() const { return ChangeSet; }
+
+	/** Nullptr unless a writing run enabled its journal. */
+	FORCEINLINE FAruRunJournal* GetJournal() { return Journal.Get(); }
+
+	/** Starts recording overwritten values. The journal becomes a rollback step when the run ends. */
+	FAruRunJournal& EnableJournal();
+
+	/** Whether writes are recorded in an editor transaction the run opened, see FAruRunTransactionScope. */
+	FORCEINLINE bool IsTransacted() const { return bTransacted; }
+
+	/**
+	 * Saves the object to the run's transaction before its first write, once per transaction. Does nothing outside one.
+	 * Worker threads can't save objects, so they rely on the game thread having saved what they write.
+	 */
+	void ModifyBeforeWrite(UObject* InObject);
+
+	/** Whether traversal records where it is, see FAruPathScope. */
+	FORCEINLINE bool ShouldTrackPaths() const { return ChangeSet.IsValid() || Journal.IsValid() || bTransacted; }
+
+	/**
+	 * Returns what a rule compiled from its configuration for this run, building it on first use.
+	 * Entries are keyed by the rule instance, so two predicates of the same type never share one.
+	 */
+	template <typename T>
+	TSharedRef<T> FindOrAddRuleCache(const void* InRule, TFunctionRef<TSharedRef<T>()> InBuilder)
+	{
+		FScopeLock ScopeLock{&RuleCacheLock};
+		if (const TSharedPtr<void>* Found = RuleCaches.Find(InRule))
+		{
+			return StaticCastSharedPtr<T>(*Found).ToSharedRef();
+		}
+
+		LLM_SCOPE_BYTAG(Aru_Caches);
+		TSharedRef<T> Built = InBuilder();
+		RuleCaches.Add(InRule, Built);
+		RunStats.CacheEntries.fetch_add(1, std::memory_order_relaxed);
+		return Built;
+	}
+
+private:
+	FAruProcessConfig Configs;
+	FAruScratchPool ScratchPool;
+	FAruAssetCache AssetCache;
+	FAruDispatchCache DispatchCache;
+	FAruRunStats RunStats;
+
+	/** Flushed to the message log when the run ends. */
+	FAruRunLog RunLog;
+
+	TUniquePtr<FAruRuleProfiler> RuleProfiler;
+	TUniquePtr<FAruRunMemory> RunMemory;
+	TSharedPtr<FAruChangeSet> ChangeSet;
+	TSharedPtr<FAruRunJournal> Journal;
+
+	FCriticalSection RuleCacheLock;
+	TMap<const void*, TSharedPtr<void>> RuleCaches;
+
+	friend struct FAruRunTransactionScope;
+	bool bTransacted = false;
+
+	/** Objects saved to the open transaction. */
+	TSet<UObject*> TransactedObjects;
+};
+
+/**
+ * Editor transaction around a writing run, so the editor's undo restores what the run wrote.
+ * Opens nothing for dry runs, journaled runs and runs already inside one.
+ */
+struct ARUEDITORUTILITIES_API FAruRunTransactionScope : public FNoncopyable
+{
+	FAruRunTransactionScope(FAruProcessingContext& InContext, const FText& InDescription);
+	~FAruRunTransactionScope();
+
+private:
+	FAruProcessingContext* Context = nullptr;
+	TUniquePtr<FScopedTransaction> Transaction;
+};
+
+/** Binds a context to the calling thread and restores the previous one on destruction. */
+struct ARUEDITORUTILITIES_API FAruProcessingContextScope : public FNoncopyable
+{
+	explicit FAruProcessingContextScope(FAruProcessingContext* InContext);
+	~FAruProcessingContextScope();
+
+private:
+	FAruProcessingContext* PreviousContext = nullptr;
+};
+
+/**
+ * Array whose elements the calling thread is visiting, so element rules can reach their siblings.
+ * Every scope gets a new serial, which tells two visits of the same array memory apart.
+ */
+struct ARUEDITORUTILITIES_API FAruArrayScope : public FNoncopyable
+{
+	FAruArrayScope(const FArrayProperty* InArrayProperty, const void* InArrayValue);
+	~FAruArrayScope();
+
+	/** Innermost array being visited on the calling thread, or nullptr. */
+	static const FAruArrayScope* Get();
+
+	/** Index of the element in this array, or INDEX_NONE if the value is not one of its elements. */
+	int32 IndexOf(const FProperty* InElementProperty, const void* InElementValue) const;
+
+	FORCEINLINE const FArrayProperty* GetArrayProperty() const { return ArrayProperty; }
+	FORCEINLINE const void* GetArrayValue() const { return ArrayValue; }
+	FORCEINLINE uint64 GetSerial() const { return Serial; }
+
+private:
+	const FArrayProperty* ArrayProperty = nullptr;
+	const void* ArrayValue = nullptr;
+	uint64 Serial = 0;
+	const FAruArrayScope* PreviousScope = nullptr;
+};
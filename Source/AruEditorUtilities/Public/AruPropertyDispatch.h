@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Value types the proxy rules know how to hand to Blueprint. */
+enum class EAruValueKind : uint8
+{
+	Unsupported,
+	Bool,
+	Int8,
+	Int16,
+	Int32,
+	Int64,
+	Byte,
+	UInt16,
+	UInt32,
+	UInt64,
+	Float,
+	Double,
+	String,
+	Text,
+	Name,
+	Object,
+	SoftObject,
+	Enum,
+	GameplayTag,
+	GameplayTagContainer,
+	InstancedStruct,
+	Struct
+};
+
+/** What a property resolves to, so the cast chain runs once per property and run instead of once per visit. */
+struct FAruValueDispatch
+{
+	EAruValueKind Kind = EAruValueKind::Unsupported;
+
+	/** Integer storage of enums, whether declared as FEnumProperty or as an FByteProperty with an enum. */
+	const FNumericProperty* UnderlyingProperty = nullptr;
+	const UEnum* Enum = nullptr;
+
+	/** Type of plain struct values. */
+	const UScriptStruct* Struct = nullptr;
+};
+
+namespace Aru::Dispatch
+{
+	/** Resolves the property without caching. */
+	ARUEDITORUTILITIES_API FAruValueDispatch Resolve(const FProperty* Property);
+
+	/** Resolves the property once per run through the current context, or directly when no run is active. */
+	ARUEDITORUTILITIES_API FAruValueDispatch Find(const FProperty* Property);
+
+	/**
+	 * Integer kinds that Blueprint has no type for are widened to int64; this clamps a result back into their range.
+	 * uint64 doesn't fit in int64 and is clamped by the caller in uint64.
+	 */
+	ARUEDITORUTILITIES_API int64 ClampToKind(const EAruValueKind Kind, const int64 Value);
+}
+
+/** Per-run table of resolved properties. */
+class ARUEDITORUTILITIES_API FAruDispatchCache : public FNoncopyable
+{
+public:
+	FAruValueDispatch Find(const FProperty* Property);
+
+private:
+	FRWLock Lock;
+	TMap<const FProperty*, FAruValueDispatch> Entries;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EAruPathSegment : uint8
+{
+	/** Named property of the enclosing struct or object. */
+	Property,
+	/** Array or set element, by index. */
+	Element,
+	/** Key of a map pair, by index. */
+	MapKey,
+	/** Value of a map pair, by index. */
+	MapValue,
+	/** DataTable row, by name. */
+	Row
+};
+
+struct FAruPathSegment
+{
+	EAruPathSegment Kind = EAruPathSegment::Property;
+	FName Name;
+	int32 Index = INDEX_NONE;
+
+	friend bool operator==(const FAruPathSegment& A, const FAruPathSegment& B)
+	{
+		return A.Kind == B.Kind && A.Name == B.Name && A.Index == B.Index;
+	}
+};
+
+/**
+ * Location of a value inside an object, e.g. Nodes[2].Leaf.IntValue or (Goblin).Stats.Health for a DataTable row.
+ * Indices of maps and sets are indices into their sparse storage, so they only identify the same pair on identical content.
+ */
+struct ARUEDITORUTILITIES_API FAruPropertyPath
+{
+	TArray<FAruPathSegment> Segments;
+
+	FString ToString() const;
+
+	friend bool operator==(const FAruPropertyPath& A, const FAruPropertyPath& B) { return A.Segments == B.Segments; }
+};
+
+/**
+ * Step of the calling thread's traversal. Steps are only recorded while the bound run asks for paths,
+ * e.g. to report dry-run changes, so other runs pay a single check per property.
+ */
+struct ARUEDITORUTILITIES_API FAruPathScope : public FNoncopyable
+{
+	/** Enters an object. Paths below are relative to it. */
+	explicit FAruPathScope(UObject* InObject);
+	/** Enters an object and the path below it, e.g. to record a value that was found by path instead of traversed. */
+	FAruPathScope(UObject* InObject, const FAruPropertyPath& InPath);
+	FAruPathScope(const EAruPathSegment InKind, const FName InName, const int32 InIndex = INDEX_NONE);
+	~FAruPathScope();
+
+	/** Whether the run bound to the calling thread records paths. */
+	static bool IsTracking();
+
+	/** Innermost object the calling thread's traversal is in, or nullptr if paths aren't tracked. */
+	static UObject* GetCurrentObject();
+
+	/** Path from the current object to the value being visited. */
+	static FAruPropertyPath GetCurrentPath();
+
+private:
+	int32 NumPushed = 0;
+};
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+enum class EAruRuleKind : uint8
+{
+	Action,
+	Validation,
+	Condition,
+	Predicate
+};
+
+/** Counters of one rule over a run. Times of definitions include their conditions and predicates. */
+struct FAruRuleStats
+{
+	/** Description of the action or validation definition the rule belongs to. */
+	FString Definition;
+	FString Rule;
+	EAruRuleKind Kind = EAruRuleKind::Condition;
+
+	int64 Evaluations = 0;
+
+	/** Conditions that were met, and definitions whose conditions were all met. */
+	int64 Matches = 0;
+
+	/** Predicates and actions that reported a change. */
+	int64 Writes = 0;
+
+	uint64 Cycles = 0;
+
+	double GetSeconds() const { return FPlatformTime::ToSeconds64(Cycles); }
+};
+
+/** Totals of one asset over a run, summed over every pass that visited it. */
+struct FAruAssetStats
+{
+	FString AssetPath;
+	int64 Evaluations = 0;
+	int64 Writes = 0;
+	uint64 Cycles = 0;
+
+	double GetSeconds() const { return FPlatformTime::ToSeconds64(Cycles); }
+};
+
+struct ARUEDITORUTILITIES_API FAruProfileReport
+{
+	FDateTime Timestamp;
+	TArray<FAruRuleStats> Rules;
+	TArray<FAruAssetStats> Assets;
+
+	static FString LexKind(const EAruRuleKind Kind);
+
+	FString ToJson() const;
+
+	/** Rules first, then assets, each as its own block with a header row. */
+	FString ToCsv() const;
+
+	/** Writes the report as .json and .csv next to each other. Returns false if either file failed. */
+	bool SaveToFiles(const FString& BasePath) const;
+};
+
+/**
+ * Per-rule counters of one run, collected only when FAruProcessConfig::bProfileRules is set.
+ * Every thread counts into its own table, so recording never takes a lock; tables are merged when the report is built.
+ */
+class ARUEDITORUTILITIES_API FAruRuleProfiler : public FNoncopyable
+{
+public:
+	FAruRuleProfiler();
+	~FAruRuleProfiler();
+
+	/** Profiler of the current run, or nullptr when no run is active or the run isn't profiled. */
+	static FAruRuleProfiler* Get();
+
+	void RecordRule(
+		const void* InRule,
+		const EAruRuleKind InKind,
+		const UScriptStruct* InRuleType,
+		const FString& InDefinition,
+		const bool bMatched,
+		const bool bWrote,
+		const uint64 InCycles);
+
+	void RecordAsset(const UObject* InAsset, const int64 InEvaluations, const int64 InWrites, const uint64 InCycles);
+
+	/** Merges every thread's counters. Must not run while other threads are still recording. */
+	FAruProfileReport BuildReport() const;
+
+	/** Report of the last profiled run that finished in this session. */
+	static TSharedPtr<const FAruProfileReport> GetLastReport();
+
+	/** Stores the report of a finished run, saves it under Saved/AruEditorUtilities/Profiles and opens it in the editor. */
+	static void PublishReport(FAruProfileReport&& Report);
+
+private:
+	struct FThreadStats
+	{
+		TMap<const void*, FAruRuleStats> Rules;
+	};
+
+	FThreadStats& GetThreadStats();
+
+	const uint64 Serial;
+
+	mutable FCriticalSection Lock;
+	TArray<TUniquePtr<FThreadStats>> ThreadStats;
+	TMap<FString, FAruAssetStats> AssetStats;
+};
+
+/** Times one rule evaluation and records it when the scope ends. Does nothing without a profiler. */
+struct FAruRuleProfileScope : public FNoncopyable
+{
+	FORCEINLINE FAruRuleProfileScope(
+		FAruRuleProfiler* InProfiler,
+		const void* InRule,
+		const EAruRuleKind InKind,
+		const UScriptStruct* InRuleType,
+		const FString& InDefinition)
+		: Profiler(InProfiler)
+		, Rule(InRule)
+		, RuleType(InRuleType)
+		, Definition(InDefinition)
+		, Kind(InKind)
+		, StartCycles(InProfiler != nullptr ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	FORCEINLINE ~FAruRuleProfileScope()
+	{
+		if (Profiler != nullptr)
+		{
+			Profiler->RecordRule(Rule, Kind, RuleType, Definition, bMatched, bWrote, FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+
+	FORCEINLINE bool Matched(const bool bInMatched) { bMatched = bInMatched; return bInMatched; }
+	FORCEINLINE bool Wrote(const bool bInWrote) { bWrote = bInWrote; return bInWrote; }
+
+private:
+	FAruRuleProfiler* Profiler = nullptr;
+	const void* Rule = nullptr;
+	const UScriptStruct* RuleType = nullptr;
+	const FString& Definition;
+	EAruRuleKind Kind;
+	bool bMatched = false;
+	bool bWrote = false;
+	uint64 StartCycles = 0;
+};
+
+/**
+ * Times everything done to one asset and records the rule evaluations and writes it caused.
+ * Only the calling thread's evaluations are counted, into the innermost scope. Worker tasks processing part of
+ * the asset open their own untimed scope, so their counts join the asset without adding their time twice.
+ */
+struct ARUEDITORUTILITIES_API FAruAssetProfileScope : public FNoncopyable
+{
+	explicit FAruAssetProfileScope(const UObject* InAsset, const bool bInTimed = true);
+	~FAruAssetProfileScope();
+
+private:
+	friend class FAruRuleProfiler;
+
+	FAruRuleProfiler* Profiler = nullptr;
+	const UObject* Asset = nullptr;
+	FAruAssetProfileScope* Outer = nullptr;
+	int64 Evaluations = 0;
+	int64 Writes = 0;
+	bool bTimed = true;
+	uint64 StartCycles = 0;
+};
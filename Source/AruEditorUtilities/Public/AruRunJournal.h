@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AruCompiledPath.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+/** Value a run overwrote, and where it lives. */
+struct FAruJournalEntry
+{
+	/** Index into the journal's objects. */
+	int32 ObjectIndex = INDEX_NONE;
+	FAruCompiledPath Path;
+	TArray<uint8> OldValue;
+};
+
+/**
+ * Values a writing run overwrote, kept as compiled path and old bytes instead of transaction snapshots of whole objects,
+ * so its memory grows with what the run changed rather than with the size of the assets. A journal is one rollback step.
+ */
+class ARUEDITORUTILITIES_API FAruRunJournal : public FNoncopyable
+{
+public:
+	/** Number of runs that can be rolled back. Older journals are dropped. */
+	static constexpr int32 MaxHistory = 8;
+
+	/** Records what the value at the calling thread's current path held before it changed. Returns false if it didn't change. */
+	bool Record(const FProperty* InProperty, const void* InOldValue, const void* InNewValue);
+
+	/** Writes the old values back, newest first, and marks their packages dirty. Must be called on the game thread. */
+	int32 Rollback() const;
+
+	FORCEINLINE int32 Num() const { return Entries.Num(); }
+	FORCEINLINE bool IsEmpty() const { return Entries.IsEmpty(); }
+	FORCEINLINE int32 GetNumObjects() const { return Objects.Num(); }
+
+	/** Bytes of old values held by the journal. */
+	FORCEINLINE int64 GetNumValueBytes() const { return NumValueBytes; }
+
+	/** Makes the journal the newest rollback step. */
+	static void PushHistory(const TSharedRef<const FAruRunJournal>& InJournal);
+
+	/** Removes and returns the newest rollback step, or nullptr if there is none. */
+	static TSharedPtr<const FAruRunJournal> PopHistory();
+
+private:
+	FCriticalSection Lock;
+	TArray<FSoftObjectPath> ObjectPaths;
+	TArray<TWeakObjectPtr<UObject>> Objects;
+	TMap<const UObject*, int32> ObjectIndices;
+
+	/** In recording order, which a rollback reverses so containers are restored before the elements written before them. */
+	TArray<FAruJournalEntry> Entries;
+	int64 NumValueBytes = 0;
+};
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AruTypes.h"
+#include "AruRunMemory.h"
+#include "Misc/TVariant.h"
+#include <atomic>
+
+enum class EAruLogSeverity : uint8
+{
+	Error,
+	Warning,
+	Info
+};
+
+/**
+ * One log call site: its severity and its precompiled format pattern.
+ * Records point at it instead of carrying text, so nothing is formatted until the run log is flushed.
+ */
+struct FAruLogEvent
+{
+	FAruLogEvent(const EAruLogSeverity InSeverity, const FText& InPattern)
+		: Severity(InSeverity), Format(InPattern) {}
+
+	const EAruLogSeverity Severity;
+	const FTextFormat Format;
+};
+
+using FAruLogArg = TVariant<int64, double, FName, FString, FText>;
+
+struct FAruLogRecord
+{
+	const FAruLogEvent* Event = nullptr;
+	uint64 Sequence = 0;
+	TArray<FAruLogArg, TInlineAllocator<6>> Args;
+};
+
+/**
+ * Record buffer owned by one thread. Info records go to a fixed-capacity ring: once full, each new one replaces the oldest.
+ * Errors and warnings are kept apart and never evicted.
+ */
+class FAruLogRingBuffer : public FNoncopyable
+{
+public:
+	explicit FAruLogRingBuffer(const int32 InCapacity);
+
+	void Push(FAruLogRecord&& Record);
+
+	/** Moves the records out and empties the buffer. Returns how many info records were dropped since the last drain. */
+	int64 Drain(TArray<FAruLogRecord>& OutRecords);
+
+private:
+	TArray<FAruLogRecord> Problems;
+	TArray<FAruLogRecord> Records;
+	int32 Capacity = 0;
+	int32 Head = 0;
+	int64 NumDropped = 0;
+};
+
+/**
+ * Messages of one processing run, recorded as structured records into per-thread ring buffers
+ * and written to the message log only when the run is flushed.
+ */
+class ARUEDITORUTILITIES_API FAruRunLog : public FNoncopyable
+{
+public:
+	FAruRunLog(const EAruLogVerbosity InVerbosity, const int32 InBufferCapacity);
+	~FAruRunLog();
+
+	bool IsEnabled(const EAruLogSeverity Severity) const;
+
+	void Write(const FAruLogEvent& Event, TArray<FAruLogArg, TInlineAllocator<6>>&& Args);
+
+	/**
+	 * Formats every buffered record into the message log in the order they were written, and empties the buffers.
+	 * Must not run while other threads are still writing.
+	 */
+	void Flush();
+
+	/** Formats a single record straight into the message log. */
+	static void Emit(const FAruLogEvent& Event, TConstArrayView<FAruLogArg> Args);
+
+private:
+	FAruLogRingBuffer& GetThreadBuffer();
+
+	const EAruLogVerbosity Verbosity;
+	const int32 BufferCapacity;
+	const uint64 Serial;
+
+	FCriticalSection Lock;
+	TArray<TUniquePtr<FAruLogRingBuffer>> Buffers;
+	std::atomic<uint64> NextSequence{0};
+};
+
+namespace Aru::Log
+{
+	template <typename T>
+	FAruLogArg MakeArg(T&& Value)
+	{
+		using FValueType = std::decay_t<T>;
+		if constexpr (std::is_same_v<FValueType, FString>)
+		{
+			return FAruLogArg{TInPlaceType<FString>(), Forward<T>(Value)};
+		}
+		else if constexpr (std::is_same_v<FValueType, FName>)
+		{
+			return FAruLogArg{TInPlaceType<FName>(), Value};
+		}
+		else if constexpr (std::is_same_v<FValueType, FText>)
+		{
+			return FAruLogArg{TInPlaceType<FText>(), Forward<T>(Value)};
+		}
+		else if constexpr (std::is_convertible_v<FValueType, const TCHAR*>)
+		{
+			return FAruLogArg{TInPlaceType<FString>(), FString{Value}};
+		}
+		else if constexpr (std::is_floating_point_v<FValueType>)
+		{
+			return FAruLogArg{TInPlaceType<double>(), static_cast<double>(Value)};
+		}
+		else
+		{
+			static_assert(std::is_integral_v<FValueType> || std::is_enum_v<FValueType>, "Unsupported log argument type.");
+			return FAruLogArg{TInPlaceType<int64>(), static_cast<int64>(Value)};
+		}
+	}
+
+	/** Whether the current run records events of this severity. Outside a run everything is logged. */
+	ARUEDITORUTILITIES_API bool IsEnabled(const FAruLogEvent& Event);
+
+	ARUEDITORUTILITIES_API void WriteArgs(const FAruLogEvent& Event, TArray<FAruLogArg, TInlineAllocator<6>>&& Args);
+
+	/** Records the event in the current run's log, or formats it right away when no run is active. */
+	template <typename... ArgTypes>
+	void Write(const FAruLogEvent& Event, ArgTypes&&... Args)
+	{
+		TArray<FAruLogArg, TInlineAllocator<6>> LogArgs;
+		LogArgs.Reserve(sizeof...(Args));
+		(LogArgs.Add(MakeArg(Forward<ArgTypes>(Args))), ...);
+		WriteArgs(Event, MoveTemp(LogArgs));
+	}
+}
+
+/**
+ * Logs a rule message through the run log, e.g. ARU_LOG(Warning, LOCTEXT("Key", "Property:'{0}'"), Name).
+ * The pattern is compiled once per call site, and the arguments are only evaluated when the run records this severity.
+ * Pass the LOCTEXT at the call site, so the localization gatherer finds it.
+ */
+#define ARU_LOG(Severity, Pattern, ...) \
+	do \
+	{ \
+		static const FAruLogEvent AruLogEvent{EAruLogSeverity::Severity, Pattern}; \
+		if (Aru::Log::IsEnabled(AruLogEvent)) \
+		{ \
+			LLM_SCOPE_BYTAG(Aru_RunLog); \
+			Aru::Log::Write(AruLogEvent, ##__VA_ARGS__); \
+		} \
+	} while (0)
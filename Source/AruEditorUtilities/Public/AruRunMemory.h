@@ -0,0 +1,128 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include <atomic>
+
+/**
+ * LLM tags of the processing pipeline, listed under Aru in stat LLM, LLM csv files and Insights when run with -llm.
+ * Aru/Assets holds what runs load; every other tag is the run's own bookkeeping.
+ */
+LLM_DECLARE_TAG_API(Aru, ARUEDITORUTILITIES_API);
+LLM_DECLARE_TAG_API(Aru_Traversal, ARUEDITORUTILITIES_API);
+LLM_DECLARE_TAG_API(Aru_Scratch, ARUEDITORUTILITIES_API);
+LLM_DECLARE_TAG_API(Aru_RunLog, ARUEDITORUTILITIES_API);
+LLM_DECLARE_TAG_API(Aru_Caches, ARUEDITORUTILITIES_API);
+LLM_DECLARE_TAG_API(Aru_Proxies, ARUEDITORUTILITIES_API);
+LLM_DECLARE_TAG_API(Aru_Assets, ARUEDITORUTILITIES_API);
+LLM_DECLARE_TAG_API(Aru_Journal, ARUEDITORUTILITIES_API);
+
+/** Work counters of one run, for tools that measure runs such as the benchmark commandlet. */
+struct FAruRunStats
+{
+	std::atomic<int64> PropertiesVisited{0};
+	std::atomic<int64> AssetsProcessed{0};
+	std::atomic<int64> ScratchAllocations{0};
+	std::atomic<int64> LogRecords{0};
+	std::atomic<int64> CacheEntries{0};
+	std::atomic<int64> ProxyInstances{0};
+};
+
+namespace Aru::Memory
+{
+	/** Adds to a counter of the run bound to the calling thread. Does nothing outside a run. */
+	ARUEDITORUTILITIES_API void CountInRun(std::atomic<int64> FAruRunStats::* Counter, const int64 Amount = 1);
+}
+
+/** Stages of a run, in the order they happen. */
+enum class EAruRunPhase : uint8
+{
+	/** Collection pass of a preloading run. */
+	Collect,
+	/** Batched load of the collected assets. */
+	Load,
+	/** Filters and predicates running over the assets. */
+	Process,
+	/** Writing the run log and the profile report once the run ends. */
+	Report,
+	Num
+};
+
+ARUEDITORUTILITIES_API const TCHAR* LexToString(const EAruRunPhase Phase);
+
+/** Memory use and allocation counts of one phase, summed over every time the run entered it. */
+struct FAruPhaseMemory
+{
+	int32 NumEntries = 0;
+	double Seconds = 0.0;
+
+	/** Change of used physical memory between entering and leaving the phase. */
+	int64 UsedPhysicalDelta = 0;
+	uint64 PeakUsedPhysical = 0;
+	uint64 SumUsedPhysical = 0;
+	int64 NumSamples = 0;
+
+	int64 ScratchAllocations = 0;
+	int64 LogRecords = 0;
+	int64 CacheEntries = 0;
+	int64 ProxyInstances = 0;
+
+	FORCEINLINE uint64 GetAverageUsedPhysical() const { return NumSamples > 0 ? SumUsedPhysical / NumSamples : 0; }
+};
+
+/**
+ * Samples the process's memory while a run moves through its phases, to size machines for headless runs.
+ * Samples are taken when a phase starts and ends and after every processed asset.
+ */
+class ARUEDITORUTILITIES_API FAruRunMemory : public FNoncopyable
+{
+public:
+	explicit FAruRunMemory(const FAruRunStats& InStats);
+
+	/** Starts the phase unless another one is running, whose figures then include this work. Returns whether it started. */
+	bool BeginPhase(const EAruRunPhase Phase);
+	void EndPhase(const EAruRunPhase Phase);
+
+	/** Records the current memory use in the running phase. */
+	void Sample();
+
+	const FAruPhaseMemory& GetPhase(const EAruRunPhase Phase) const { return Phases[static_cast<int32>(Phase)]; }
+
+	/** Highest used memory sampled in any phase of the run so far. */
+	uint64 GetPeakUsedPhysical() const;
+
+	/** Writes one line per entered phase to the message log. */
+	void Report() const;
+
+private:
+	struct FCounters
+	{
+		int64 ScratchAllocations = 0;
+		int64 LogRecords = 0;
+		int64 CacheEntries = 0;
+		int64 ProxyInstances = 0;
+	};
+
+	FCounters ReadCounters() const;
+	void SampleLocked(const uint64 UsedPhysical);
+
+	const FAruRunStats& Stats;
+
+	mutable FCriticalSection Lock;
+	TOptional<EAruRunPhase> ActivePhase;
+	double PhaseStartTime = 0.0;
+	uint64 PhaseStartUsedPhysical = 0;
+	FCounters PhaseStartCounters;
+	FAruPhaseMemory Phases[static_cast<int32>(EAruRunPhase::Num)];
+};
+
+/** Runs the current run's phase for the lifetime of the scope. Does nothing unless the run reports memory. */
+struct ARUEDITORUTILITIES_API FAruRunPhaseScope : public FNoncopyable
+{
+	explicit FAruRunPhaseScope(const EAruRunPhase InPhase);
+	~FAruRunPhaseScope();
+
+private:
+	FAruRunMemory* RunMemory = nullptr;
+	EAruRunPhase Phase;
+};
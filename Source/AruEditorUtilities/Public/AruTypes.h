@@ -4,6 +4,8 @@
 #include "StructUtils/PropertyBag.h"
 #include "AruTypes.generated.h"
 
+class FAruShadowValue;
+
 namespace Aru::ProcessResult
 {
 	static FString Error{"ERROR"};
@@ -41,8 +43,40 @@ enum class EAruNameCompareOp : uint8
 	MatchAll
 };
 
+/** Lowest severity of rule messages that reach the message log. */
+UENUM(BlueprintType)
+enum class EAruLogVerbosity : uint8
+{
+	Errors,
+	Warnings,
+	All
+};
+
+UENUM(BlueprintType)
+enum class EAruTransformComponent : uint8
+{
+	Translation,
+	Rotation,
+	Scale
+};
+
+/** Where a value handed to a batch proxy event comes from. */
 USTRUCT(BlueprintType)
-struct FAruFilter
+struct FAruProxyValueContext
+{
+	GENERATED_BODY()
+
+public:
+	/** Name of the array property holding the value. */
+	UPROPERTY(BlueprintReadOnly, Category="Aru Editor Utilities")
+	FName PropertyName;
+
+	UPROPERTY(BlueprintReadOnly, Category="Aru Editor Utilities")
+	int32 Index = INDEX_NONE;
+};
+
+USTRUCT(BlueprintType)
+struct ARUEDITORUTILITIES_API FAruFilter
 {
 	GENERATED_BODY()
 
@@ -63,13 +97,16 @@ public:
 	 */
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const { return bInverseCondition; }
 
+	/** Whether the filter may run on worker threads: it calls no Blueprint code and loads no assets. Nested filters forward the question. */
+	virtual bool IsThreadSafe() const { return true; }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category=Config, meta=(AdvancedClassDisplay))
 	bool bInverseCondition = false;
 };
 
 USTRUCT(BlueprintType)
-struct FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate
 {
 	GENERATED_BODY()
 
@@ -90,8 +127,51 @@ public:
 	 *                          false if no changes were made or the operation failed.
 	 */
 	virtual bool Execute(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const { return true; }
+
+	/**
+	 * Reports the assets Execute would load for this value, without loading or writing anything.
+	 * Called by the collection pass of a preloading run, so all of them arrive in one batched request.
+	 */
+	virtual void GatherPreloads(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, TArray<FSoftObjectPath>& OutPaths) const {}
+
+	/** Whether the predicate may run on worker threads: it calls no Blueprint code and loads no assets. Nested rules forward the question. */
+	virtual bool IsThreadSafe() const { return true; }
 };
 
+namespace Aru
+{
+	/** Whether every rule in the array may run on worker threads. */
+	template <typename RuleType>
+	bool AreThreadSafe(const TArray<TInstancedStruct<RuleType>>& Rules)
+	{
+		for (const TInstancedStruct<RuleType>& Rule : Rules)
+		{
+			if (const RuleType* RulePtr = Rule.template GetPtr<const RuleType>(); RulePtr != nullptr && !RulePtr->IsThreadSafe())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** Forwards the preload collection to every predicate in the array. */
+	inline void GatherPreloads(
+		const TArray<TInstancedStruct<FAruPredicate>>& Predicates,
+		const FProperty* InProperty,
+		const void* InValue,
+		const FInstancedPropertyBag& InParameters,
+		TArray<FSoftObjectPath>& OutPaths)
+	{
+		for (const TInstancedStruct<FAruPredicate>& Predicate : Predicates)
+		{
+			if (const FAruPredicate* PredicatePtr = Predicate.GetPtr<const FAruPredicate>())
+			{
+				PredicatePtr->GatherPreloads(InProperty, InValue, InParameters, OutPaths);
+			}
+		}
+	}
+}
+
 template <typename StructType>
 	struct TStructIterator
 {
@@ -122,12 +202,29 @@ struct TRangedForStructArray
 };
 
 USTRUCT(BlueprintType)
-struct FAruActionDefinition
+struct ARUEDITORUTILITIES_API FAruActionDefinition
 {
 	GENERATED_BODY()
 
 public:
-	bool Invoke(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const;
+	FAruActionDefinition() = default;
+	FAruActionDefinition(TArray<TInstancedStruct<FAruFilter>> InConditions, TArray<TInstancedStruct<FAruPredicate>> InPredicates, const FString& InDescription = {})
+		: ActionConditions(MoveTemp(InConditions)), ActionPredicates(MoveTemp(InPredicates)), Description(InDescription) {}
+
+	/**
+	 * Runs the predicates on the value if every condition is met.
+	 * With a shadow, the value is prepared for undo before the first predicate writes it, see FAruShadowValue.
+	 */
+	bool Invoke(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters, FAruShadowValue* InShadow = nullptr) const;
+
+	/**
+	 * Collects the preloads of every predicate. Conditions are left to the write pass, so they are evaluated once per run;
+	 * a value the conditions would skip may still have its assets loaded.
+	 */
+	void GatherPreloads(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, TArray<FSoftObjectPath>& OutPaths) const;
+
+	/** Whether every condition and predicate may run on worker threads. */
+	bool IsThreadSafe() const { return Aru::AreThreadSafe(ActionConditions) && Aru::AreThreadSafe(ActionPredicates); }
 
 protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Aru Editor Utilities", meta=(ExcludeBaseStruct))
@@ -159,16 +256,28 @@ public:
 	{
 		return ActionTags;
 	}
+
+	FORCEINLINE const FString& GetDescription() const
+	{
+		return Description;
+	}
 };
 
 USTRUCT(BlueprintType)
-struct FAruValidationDefinition
+struct ARUEDITORUTILITIES_API FAruValidationDefinition
 {
 	GENERATED_BODY()
 
 public:
+	FAruValidationDefinition() = default;
+	explicit FAruValidationDefinition(TArray<TInstancedStruct<FAruFilter>> InConditions, const FString& InDescription = {})
+		: ValidationConditions(MoveTemp(InConditions)), Description(InDescription) {}
+
 	bool Validate(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const;
 
+	/** Whether every condition may run on worker threads. */
+	bool IsThreadSafe() const { return Aru::AreThreadSafe(ValidationConditions); }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Aru Editor Utilities", meta=(ExcludeBaseStruct))
 	TArray<TInstancedStruct<FAruFilter>> ValidationConditions;
@@ -191,6 +300,11 @@ public:
 	{
 		return ValidationTags;
 	}
+
+	FORCEINLINE const FString& GetDescription() const
+	{
+		return Description;
+	}
 };
 
 UCLASS(BlueprintType)
@@ -224,4 +338,70 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	int32 MaxSearchDepth = 5;
+
+	/**
+	 * Allows disjoint work (e.g. DataTable row ranges) to be processed on worker threads. Rows that can reference objects are never disjoint,
+	 * so those tables are processed on the game thread.
+	 * Ignored, with a warning, when a rule isn't thread-safe: Blueprint proxies and predicates that load assets run on the game thread.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	bool bAllowParallelProcessing = false;
+
+	/** Number of DataTable rows handed to a single worker task. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, meta=(ClampMin=1, EditCondition="bAllowParallelProcessing"))
+	int32 ParallelBatchSize = 256;
+
+	/**
+	 * Runs a collection pass first and loads every asset the predicates may reference in one batched async request,
+	 * instead of loading them one by one while properties are visited. Conditions aren't evaluated by that pass.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	bool bPreloadAssets = false;
+
+	/**
+	 * Stops traversal at FVector, FRotator, FLinearColor and FTransform values. Rules still see the struct itself,
+	 * but no longer each of its fields, which is what the math-struct filters and setters expect.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	bool bTreatMathStructsAsLeaves = false;
+
+	/** Messages below this severity are neither recorded nor formatted. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	EAruLogVerbosity LogVerbosity = EAruLogVerbosity::Warnings;
+
+	/**
+	 * Number of info messages each worker thread keeps until the run ends and they are written to the message log.
+	 * When a thread records more, its oldest info messages are dropped and counted. Errors and warnings are always kept.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, meta=(ClampMin=1))
+	int32 LogBufferCapacity = 65536;
+
+	/**
+	 * Counts evaluations, matches, writes and time of every definition, condition and predicate, plus totals per asset.
+	 * The report is saved as JSON and CSV under Saved/AruEditorUtilities/Profiles and opened in a table when the run ends.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	bool bProfileRules = false;
+
+	/**
+	 * Samples memory use and counts scratch allocations, log records, cache entries and proxy instances per phase of the run.
+	 * A summary of average, peak and retained memory per phase is written to the message log when the run ends.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	bool bReportMemory = false;
+
+	/**
+	 * Runs the actions without writing to any asset: predicates change copies of the values, and every difference is kept
+	 * as old and new bytes per property path. The changes are listed in the message log when the run ends.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	bool bDryRun = false;
+
+	/**
+	 * Keeps the old bytes of every value the actions change in a journal, instead of a transaction snapshot of each modified object.
+	 * The whole run is undone with RollbackLastRun; the editor's undo history doesn't include it, so it is off by default
+	 * and writing runs are recorded in an editor transaction instead.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	bool bJournalChanges = false;
 };
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AruProcessingContext.h"
+
+/** Outcome of writing a property value, so "nothing to do" is told apart from both failure and change. */
+enum class EAruWriteResult : uint8
+{
+	Failed,
+	Unchanged,
+	Changed
+};
+
+namespace Aru::Value
+{
+	/**
+	 * Copies the source into the destination only if the two differ.
+	 * Predicates write through this so rerunning a config leaves untouched values, and their packages, clean.
+	 */
+	inline EAruWriteResult CopyIfChanged(const FProperty* Property, void* Dest, const void* Src)
+	{
+		if (Property == nullptr || Dest == nullptr || Src == nullptr)
+		{
+			return EAruWriteResult::Failed;
+		}
+
+		if (Property->Identical(Dest, Src, PPF_None))
+		{
+			return EAruWriteResult::Unchanged;
+		}
+
+		Property->CopyCompleteValue(Dest, Src);
+		return EAruWriteResult::Changed;
+	}
+
+	/**
+	 * Lets the writer fill a scratch value of the property's type, then copies it over the destination only if it differs.
+	 * Use it for typed setters (SetPropertyValue, SetIntPropertyValue...) whose conversion makes comparing up front unreliable.
+	 */
+	template <typename WriterType>
+	EAruWriteResult WriteIfChanged(const FProperty* Property, void* Dest, WriterType&& Writer)
+	{
+		if (Property == nullptr || Dest == nullptr)
+		{
+			return EAruWriteResult::Failed;
+		}
+
+		const FAruScopedScratchValue Pending{Property};
+		if (!Pending.IsValid())
+		{
+			return EAruWriteResult::Failed;
+		}
+
+		Property->CopyCompleteValue(Pending.Get(), Dest);
+		Writer(Pending.Get());
+		return CopyIfChanged(Property, Dest, Pending.Get());
+	}
+}
@@ -0,0 +1,121 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectPtr.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class FReferenceCollector;
+
+/** Set of tags stored as one bit per tag index of an FAruTagDictionary. */
+struct ARUEDITORUTILITIES_API FAruTagMask
+{
+	void SetBit(const int32 Index);
+	bool HasBit(const int32 Index) const;
+
+	/** Whether every bit of Other is set here as well. An empty Other is contained in anything. */
+	bool ContainsAll(const FAruTagMask& Other) const;
+
+	FORCEINLINE bool IsEmpty() const { return Words.IsEmpty(); }
+
+	friend bool operator==(const FAruTagMask& A, const FAruTagMask& B) { return A.Words == B.Words; }
+	friend uint32 GetTypeHash(const FAruTagMask& Mask)
+	{
+		uint32 Hash = 0;
+		for (const uint64 Word : Mask.Words)
+		{
+			Hash = HashCombineFast(Hash, ::GetTypeHash(Word));
+		}
+		return Hash;
+	}
+
+private:
+	/** Trailing zero words are never stored, so equal sets compare equal. */
+	TArray<uint64, TInlineAllocator<1>> Words;
+};
+
+/** Interns tag names into bit indices. Indices are assigned in first-seen order and never change. */
+class ARUEDITORUTILITIES_API FAruTagDictionary
+{
+public:
+	int32 FindOrAdd(const FName Tag);
+
+	/** Index of the tag, or INDEX_NONE if it was never added. */
+	int32 Find(const FName Tag) const;
+
+	FORCEINLINE FName GetTag(const int32 Index) const { return Tags[Index]; }
+	FORCEINLINE int32 Num() const { return Tags.Num(); }
+
+	/** Mask of the tags, adding the ones not seen yet. */
+	FAruTagMask MakeMask(TConstArrayView<FName> InTags);
+
+	/**
+	 * Mask of the tags without adding any. Returns false if one of them is unknown,
+	 * since nothing built from this dictionary can carry it.
+	 */
+	bool TryMakeMask(TConstArrayView<FName> InTags, FAruTagMask& OutMask) const;
+
+	TArray<FName> GetTags(const FAruTagMask& Mask) const;
+
+private:
+	TArray<FName> Tags;
+	TMap<FName, int32> TagToIndex;
+};
+
+/**
+ * Native collection of tagged assets stored as parallel arrays, one entry per unique asset path.
+ * Indices are positions in the arrays, not handles: a removal moves the last entry into the freed index.
+ * Iterating it allocates nothing; only entries whose object was garbage collected are loaded again on access.
+ * Assets are held weakly. Objects that aren't assets, e.g. transient ones, can't be loaded again and are held strongly.
+ */
+class ARUEDITORUTILITIES_API FAruAssetCollection
+{
+public:
+	/** Adds the asset, or merges the tags into its entry if it is already collected. Returns the entry's current index. */
+	int32 Add(UObject* Object, TConstArrayView<FName> InTags);
+
+	/** Adds an asset that may not be loaded yet. */
+	int32 Add(const FSoftObjectPath& Path, const FName Name, TConstArrayView<FName> InTags);
+
+	/** Index of the asset's entry, or INDEX_NONE. */
+	int32 Find(const FSoftObjectPath& Path) const;
+
+	void AddTags(const int32 Index, TConstArrayView<FName> InTags);
+
+	/** Removes the asset's entry. The last entry takes its index, so indices held across a removal are invalid. */
+	bool Remove(const FSoftObjectPath& Path);
+
+	void Reset();
+
+	FORCEINLINE int32 Num() const { return Paths.Num(); }
+	FORCEINLINE bool IsValidIndex(const int32 Index) const { return Paths.IsValidIndex(Index); }
+
+	FORCEINLINE TConstArrayView<FSoftObjectPath> GetPaths() const { return Paths; }
+	FORCEINLINE TConstArrayView<FName> GetNames() const { return Names; }
+	FORCEINLINE TConstArrayView<FAruTagMask> GetTagMasks() const { return TagMasks; }
+	FORCEINLINE const FAruTagDictionary& GetTagDictionary() const { return TagDictionary; }
+
+	FORCEINLINE TArray<FName> GetTags(const int32 Index) const { return TagDictionary.GetTags(TagMasks[Index]); }
+
+	/** Returns the entry's object, loading it through its path if it isn't in memory. */
+	UObject* ResolveObject(const int32 Index) const;
+
+	/** Reports the strongly held objects. Called by the owner's AddReferencedObjects. */
+	void AddReferencedObjects(FReferenceCollector& Collector);
+
+private:
+	int32 AddEntry(const FSoftObjectPath& Path, UObject* Object, const FName Name);
+
+	TArray<FSoftObjectPath> Paths;
+	TArray<FName> Names;
+	TArray<FAruTagMask> TagMasks;
+	mutable TArray<TWeakObjectPtr<UObject>> Objects;
+
+	/** Objects that aren't assets, kept alive while collected. Null for assets. */
+	TArray<TObjectPtr<UObject>> PinnedObjects;
+
+	TMap<FSoftObjectPath, int32> PathToIndex;
+	FAruTagDictionary TagDictionary;
+};
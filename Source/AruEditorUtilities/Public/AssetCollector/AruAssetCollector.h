@@ -4,11 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "AssetCollector/AruAssetCollection.h"
 #include "AssetObject/AruAssetObject.h"
 #include "AruAssetCollector.generated.h"
 
 /**
- * Base class for asset collection that maintains a pool of AruAssetObject instances
+ * Base class for asset collection that maintains a native collection of tagged assets
  * Can be extended in Blueprint to implement custom asset collection logic
  */
 UCLASS(Blueprintable, Abstract)
@@ -20,8 +21,10 @@ public:
 	UAruAssetCollector();
 	virtual ~UAruAssetCollector();
 
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
 	/**
-	 * Collect assets and populate the AruAssetObjects array
+	 * Collect assets and populate the collection
 	 * Blueprint implementable function that can be overridden in child classes
 	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Asset Collector")
@@ -29,12 +32,32 @@ public:
 	virtual void Collect_Implementation();
 
 	/**
-	 * Returns all collected asset objects
-	 * @return Array of all collected AruAssetObjects
+	 * Returns the asset objects added through AddInstance and AddAruAssetObject
+	 * Their tags stay in sync with the collection, in both directions
 	 */
-	UFUNCTION(BlueprintPure, Category = "Asset Collector")
+	UFUNCTION(BlueprintPure, Category = "Asset Collector", meta = (DeprecatedFunction, DeprecationMessage = "Only returns assets added through AddInstance. Use GetAssets and GetAssetTags instead."))
 	TArray<UAruAssetObject*> Get() const;
 
+	/**
+	 * Returns all collected assets, loading the ones that are not in memory
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asset Collector")
+	TArray<UObject*> GetAssets() const;
+
+	/**
+	 * Returns the collected assets that carry every one of the tags
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asset Collector")
+	TArray<UObject*> GetAssetsWithTags(const TArray<FName>& Tags) const;
+
+	/** Number of collected assets */
+	UFUNCTION(BlueprintPure, Category = "Asset Collector")
+	int32 GetNumAssets() const;
+
+	/** Tags of the asset at the index, from 0 to GetNumAssets() - 1. Indices are positions, removing an asset moves the last one into its place */
+	UFUNCTION(BlueprintPure, Category = "Asset Collector")
+	TArray<FName> GetAssetTags(int32 Index) const;
+
 	/**
 	 * Clear all collected assets
 	 */
@@ -42,23 +65,44 @@ public:
 	virtual void ClearAssets();
 	
 	/**
-	 * Create a new AruAssetObject instance with the provided object reference and tags
+	 * Add an asset with the provided tags. Adding an asset twice merges its tags
+	 * @param SourceObject The UObject to collect
+	 * @param Tags Array of tags to add to the asset
+	 * @return False if SourceObject is null
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asset Collector")
+	bool AddTaggedAsset(UObject* SourceObject, const TArray<FName>& Tags);
+
+	/**
+	 * Create a new AruAssetObject instance with the provided object reference and tags, and collect the object
 	 * @param SourceObject The UObject reference to associate with the asset object
 	 * @param Tags Array of tags to add to the asset object
 	 * @return The newly created asset object
 	 */
-	UFUNCTION(BlueprintCallable, Category = "Asset Collector")
+	UFUNCTION(BlueprintCallable, Category = "Asset Collector", meta = (DeprecatedFunction, DeprecationMessage = "Creates an object per asset. Use AddTaggedAsset instead."))
 	UAruAssetObject* AddInstance(UObject* SourceObject, const TArray<FName>& Tags);
 
+	/** Native view of the collection. Iterating it does not copy or allocate */
+	FORCEINLINE const FAruAssetCollection& GetCollection() const { return Collection; }
+
 protected:
 	/**
-	 * Add an asset object to the collection
+	 * Add an asset object's referenced object and tags to the collection
 	 * @param AruAssetObject The asset object to add
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Asset Collector")
 	void AddAruAssetObject(UAruAssetObject* AruAssetObject);
 
-	/** The collection of asset objects */
-	UPROPERTY(BlueprintReadOnly, Category = "Asset Collector")
+	/** Asset objects added through AddInstance and AddAruAssetObject. Assets added any other way are only in the collection */
+	UPROPERTY(BlueprintReadOnly, Category = "Asset Collector", meta = (DeprecatedProperty, DeprecationMessage = "Only holds assets added through AddInstance. Use GetAssets and GetAssetTags instead."))
 	TArray<TObjectPtr<UAruAssetObject>> AruAssetObjects;
+
+	/** The collected assets */
+	FAruAssetCollection Collection;
+
+private:
+	friend class UAruAssetObject;
+
+	/** Merges the tags of a stored asset object into its entry */
+	void SyncAssetObjectTags(const UAruAssetObject* AruAssetObject);
 };
@@ -0,0 +1,76 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetCollector/AruAssetCollector.h"
+#include "AssetRegistry/ARFilter.h"
+#include "AruAssetCollector_Registry.generated.h"
+
+struct FAssetData;
+
+/**
+ * Collects assets from the asset registry without loading them
+ * The result is cached after the first Collect and kept up to date from registry add, remove and rename events
+ */
+UCLASS(Blueprintable)
+class ARUEDITORUTILITIES_API UAruAssetCollector_Registry : public UAruAssetCollector
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PostInitProperties() override;
+	virtual void BeginDestroy() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	/** Queries the registry once; later calls return the cached set until the filter changes or the assets are cleared */
+	virtual void Collect_Implementation() override;
+
+	virtual void ClearAssets() override;
+
+	/** Drops the cached set so the next Collect queries the registry again */
+	UFUNCTION(BlueprintCallable, Category = "Asset Collector")
+	void InvalidateCache();
+
+protected:
+	/** Content folders to search, e.g. /Game/Characters. Empty searches everywhere */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Asset Collector")
+	TArray<FName> PackagePaths;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Asset Collector")
+	bool bRecursivePaths = true;
+
+	/** Asset classes to collect. Empty collects every class */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Asset Collector", meta = (AllowAbstract))
+	TArray<TSoftClassPtr<UObject>> AssetClasses;
+
+	/** Also collects subclasses of AssetClasses */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Asset Collector")
+	bool bRecursiveClasses = true;
+
+	/** Asset registry tags the assets must carry. An empty value accepts any value of the tag */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Asset Collector")
+	TMap<FName, FString> RequiredTagValues;
+
+	/** Tags attached to every collected asset, for routing definitions by ActionTags and ValidationTags */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Asset Collector")
+	TArray<FName> AssetTags;
+
+private:
+	FARFilter MakeFilter() const;
+	bool IsIncluded(const FAssetData& AssetData) const;
+	void AddAsset(const FAssetData& AssetData);
+
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	FARCompiledFilter CompiledFilter;
+	bool bCacheValid = false;
+
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+};
@@ -3,11 +3,14 @@
 #include "AruFilter_ByName.generated.h"
 
 USTRUCT(BlueprintType, DisplayName="Check Property Name")
-struct FAruFilter_ByName : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByName : public FAruFilter
 {
 	GENERATED_BODY()
 
 public:
+	FAruFilter_ByName() = default;
+	FAruFilter_ByName(const EAruNameCompareOp InCompareOp, const FString& InPropertyName) : CompareOp(InCompareOp), PropertyName(InPropertyName) {}
+
 	virtual ~FAruFilter_ByName() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
@@ -21,11 +24,14 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Object Name")
-struct FAruFilter_ByObjectName : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByObjectName : public FAruFilter
 {
 	GENERATED_BODY()
 
 public:
+	FAruFilter_ByObjectName() = default;
+	FAruFilter_ByObjectName(const EAruNameCompareOp InCompareOp, const FString& InObjectName) : CompareOp(InCompareOp), ObjectName(InObjectName) {}
+
 	virtual ~FAruFilter_ByObjectName() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
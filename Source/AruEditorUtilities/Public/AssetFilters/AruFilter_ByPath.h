@@ -3,11 +3,14 @@
 #include "AruFilter_ByPath.generated.h"
 
 USTRUCT(BlueprintType, DisplayName="Check Asset Path")
-struct FAruFilter_ByAssetPath : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByAssetPath : public FAruFilter
 {
 	GENERATED_BODY()
 
 public:
+	FAruFilter_ByAssetPath() = default;
+	explicit FAruFilter_ByAssetPath(TArray<FString> InMatchingContexts) : MatchingContexts(MoveTemp(InMatchingContexts)) {}
+
 	virtual ~FAruFilter_ByAssetPath() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
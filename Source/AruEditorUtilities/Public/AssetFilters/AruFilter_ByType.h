@@ -3,7 +3,7 @@
 #include "AruFilter_ByType.generated.h"
 
 USTRUCT(BlueprintType, DisplayName="Check Object Type")
-struct FAruFilter_ByObjectType : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByObjectType : public FAruFilter
 {
 	GENERATED_BODY()
 
@@ -18,7 +18,7 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Struct Type")
-struct FAruFilter_ByStructType : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByStructType : public FAruFilter
 {
 	GENERATED_BODY()
 
@@ -33,7 +33,7 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Instanced Struct Type")
-struct FAruFilter_ByInstancedStructType : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByInstancedStructType : public FAruFilter
 {
 	GENERATED_BODY()
 
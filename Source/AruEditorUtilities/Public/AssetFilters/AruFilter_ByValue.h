@@ -4,11 +4,14 @@
 #include "AruFilter_ByValue.generated.h"
 
 USTRUCT(BlueprintType, DisplayName="Check Numeric Value")
-struct FAruFilter_ByNumericValue : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByNumericValue : public FAruFilter
 {
 	GENERATED_BODY()
 
 public:
+	FAruFilter_ByNumericValue() = default;
+	FAruFilter_ByNumericValue(const float InConditionValue, const EAruNumericCompareOp InCompareOp) : ConditionValue(InConditionValue), CompareOp(InCompareOp) {}
+
 	virtual ~FAruFilter_ByNumericValue() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
@@ -22,11 +25,14 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Numeric Range")
-struct FAruFilter_InRange : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_InRange : public FAruFilter
 {
 	GENERATED_BODY()
 
 public:
+	FAruFilter_InRange() = default;
+	explicit FAruFilter_InRange(const FVector2D& InConditionValue) : ConditionValue(InConditionValue) {}
+
 	virtual ~FAruFilter_InRange() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
@@ -37,11 +43,14 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Boolean Value")
-struct FAruFilter_ByBoolean : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByBoolean : public FAruFilter
 {
 	GENERATED_BODY()
 
 public:
+	FAruFilter_ByBoolean() = default;
+	explicit FAruFilter_ByBoolean(const bool InConditionValue, const EAruBooleanCompareOp InCompareOp = EAruBooleanCompareOp::Is) : ConditionValue(InConditionValue), CompareOp(InCompareOp) {}
+
 	virtual ~FAruFilter_ByBoolean() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
@@ -55,7 +64,7 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Object Value")
-struct FAruFilter_ByObject : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByObject : public FAruFilter
 {
 	GENERATED_BODY()
 
@@ -73,7 +82,7 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Enumeration Value")
-struct FAruFilter_ByEnum : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByEnum : public FAruFilter
 {
 	GENERATED_BODY()
 
@@ -91,11 +100,14 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Check String Value")
-struct FAruFilter_ByString : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByString : public FAruFilter
 {
 	GENERATED_BODY()
 
 public:
+	FAruFilter_ByString() = default;
+	explicit FAruFilter_ByString(const FString& InConditionValue, const EAruContainerCompareOp InCompareOp = EAruContainerCompareOp::HasAny, const bool bInCaseSensitive = false) : ConditionValue(InConditionValue), CompareOp(InCompareOp), bCaseSensitive(bInCaseSensitive) {}
+
 	virtual ~FAruFilter_ByString() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
@@ -112,11 +124,14 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Text Value")
-struct FAruFilter_ByText : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByText : public FAruFilter
 {
 	GENERATED_BODY()
 
 public:
+	FAruFilter_ByText() = default;
+	explicit FAruFilter_ByText(const FString& InConditionValue, const EAruContainerCompareOp InCompareOp = EAruContainerCompareOp::HasAny, const bool bInCaseSensitive = false) : ConditionValue(InConditionValue), CompareOp(InCompareOp), bCaseSensitive(bInCaseSensitive) {}
+
 	virtual ~FAruFilter_ByText() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
@@ -133,11 +148,14 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Name Value")
-struct FAruFilter_ByNameValue : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByNameValue : public FAruFilter
 {
 	GENERATED_BODY()
 
 public:
+	FAruFilter_ByNameValue() = default;
+	explicit FAruFilter_ByNameValue(const FName InConditionValue, const EAruContainerCompareOp InCompareOp = EAruContainerCompareOp::HasAny, const bool bInCaseSensitive = false) : ConditionValue(InConditionValue), CompareOp(InCompareOp), bCaseSensitive(bInCaseSensitive) {}
+
 	virtual ~FAruFilter_ByNameValue() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
@@ -154,11 +172,14 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Check GameplayTags")
-struct FAruFilter_ByGameplayTagContainer : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_ByGameplayTagContainer : public FAruFilter
 {
 	GENERATED_BODY()
 
 public:
+	FAruFilter_ByGameplayTagContainer() = default;
+	explicit FAruFilter_ByGameplayTagContainer(const FGameplayTagQuery& InTagQuery) : TagQuery(InTagQuery) {}
+
 	virtual ~FAruFilter_ByGameplayTagContainer() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
@@ -0,0 +1,55 @@
+#pragma once
+#include "AruTypes.h"
+#include "AruFilter_MathStruct.generated.h"
+
+/**
+ * Compares the components of an FVector, FRotator, FLinearColor or FTransform part against a value, all lanes at once.
+ * Vectors and rotators use XYZ, colors use RGBA; W is ignored for three-component types.
+ */
+USTRUCT(BlueprintType, DisplayName="Check Math Struct Components")
+struct ARUEDITORUTILITIES_API FAruFilter_MathStructComponents : public FAruFilter
+{
+	GENERATED_BODY()
+
+public:
+	virtual ~FAruFilter_MathStructComponents() override {};
+
+	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+
+protected:
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	FVector4 ConditionValue{0.0, 0.0, 0.0, 0.0};
+
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	EAruNumericCompareOp CompareOp = EAruNumericCompareOp::Equip;
+
+	/** Whether any or every component has to pass the comparison. */
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	EAruContainerCompareOp ComponentMatch = EAruContainerCompareOp::HasAll;
+
+	/** Largest difference still treated as equal by Equip and NotEqual. */
+	UPROPERTY(EditDefaultsOnly, meta=(ClampMin=0))
+	double Tolerance = UE_KINDA_SMALL_NUMBER;
+
+	UPROPERTY(EditDefaultsOnly)
+	EAruTransformComponent TransformComponent = EAruTransformComponent::Translation;
+};
+
+/** Checks that the length of an FVector, FRotator, FLinearColor or FTransform part lies within a range. */
+USTRUCT(BlueprintType, DisplayName="Check Math Struct Length")
+struct ARUEDITORUTILITIES_API FAruFilter_MathStructLength : public FAruFilter
+{
+	GENERATED_BODY()
+
+public:
+	virtual ~FAruFilter_MathStructLength() override {};
+
+	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+
+protected:
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	FVector2D ConditionValue{0.0, 1.0};
+
+	UPROPERTY(EditDefaultsOnly)
+	EAruTransformComponent TransformComponent = EAruTransformComponent::Translation;
+};
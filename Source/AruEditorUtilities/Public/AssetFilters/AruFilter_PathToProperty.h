@@ -3,7 +3,7 @@
 #include "AruFilter_PathToProperty.generated.h"
 
 USTRUCT(BlueprintType, DisplayName="Path To Property")
-struct FAruFilter_PathToProperty : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_PathToProperty : public FAruFilter
 {
 	GENERATED_BODY()
 
@@ -12,6 +12,8 @@ public:
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
 
+	virtual bool IsThreadSafe() const override { return !Filter.IsValid() || Filter.Get<const FAruFilter>().IsThreadSafe(); }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
 	FString PathToProperty{"Path.To.Your.Property"};
@@ -3,7 +3,7 @@
 #include "AruFilter_Proxy.generated.h"
 
 USTRUCT(meta=(Hidden))
-struct FAruFilter_Proxy : public FAruFilter
+struct ARUEDITORUTILITIES_API FAruFilter_Proxy : public FAruFilter
 {
 	GENERATED_BODY()
 public:
@@ -12,7 +12,10 @@ public:
 protected:
 	virtual bool IsConditionMet_Internal(const bool InBoolValue, const FInstancedPropertyBag& InParameters) const {return false;}
 	virtual bool IsConditionMet_Internal(const int32 InIntValue, const FInstancedPropertyBag& InParameters) const {return false;}
+	virtual bool IsConditionMet_Internal(const int64 InInt64Value, const FInstancedPropertyBag& InParameters) const {return false;}
+	virtual bool IsConditionMet_Internal(const uint8 InByteValue, const FInstancedPropertyBag& InParameters) const {return false;}
 	virtual bool IsConditionMet_Internal(const float InFloatValue, const FInstancedPropertyBag& InParameters) const {return false;}
+	virtual bool IsConditionMet_Internal(const double InDoubleValue, const FInstancedPropertyBag& InParameters) const {return false;}
 	virtual bool IsConditionMet_Internal(const FString& InStringValue, const FInstancedPropertyBag& InParameters) const {return false;}
 	virtual bool IsConditionMet_Internal(const FText& InTextValue, const FInstancedPropertyBag& InParameters) const {return false;}
 	virtual bool IsConditionMet_Internal(const UObject* InObjectValue, const FInstancedPropertyBag& InParameters) const {return false;}
@@ -37,9 +40,19 @@ public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruFilterProxy")
 	bool CheckIntValue(const int32 InIntValue) const;
 
+	/** Also receives int8, int16, uint16, uint32 and uint64 values; uint64 values above the int64 range are clamped. */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruFilterProxy")
+	bool CheckInt64Value(const int64 InInt64Value) const;
+
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruFilterProxy")
+	bool CheckByteValue(const uint8 InByteValue) const;
+
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruFilterProxy")
 	bool CheckFloatValue(const float InFloatValue) const;
 
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruFilterProxy")
+	bool CheckDoubleValue(const double InDoubleValue) const;
+
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruFilterProxy")
 	bool CheckStringValue(const FString& InStringValue) const;
 
@@ -63,15 +76,39 @@ public:
 
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruFilterProxy")
 	bool CheckEnumValue(const int32 InEnumValue, const UEnum* InEnumType) const;
+
+	/*
+	 * Batch events, called once per visited array with all of its elements instead of once per element.
+	 * Return one result per value; any other count falls back to the scalar event.
+	 * Only overrides made in Blueprint are used, and the defaults forward to the scalar events.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruFilterProxy")
+	TArray<bool> CheckBoolValues(const TArray<bool>& InValues, const TArray<FAruProxyValueContext>& InContexts) const;
+
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruFilterProxy")
+	TArray<bool> CheckIntValues(const TArray<int32>& InValues, const TArray<FAruProxyValueContext>& InContexts) const;
+
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruFilterProxy")
+	TArray<bool> CheckFloatValues(const TArray<float>& InValues, const TArray<FAruProxyValueContext>& InContexts) const;
+
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruFilterProxy")
+	TArray<bool> CheckStringValues(const TArray<FString>& InValues, const TArray<FAruProxyValueContext>& InContexts) const;
+
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruFilterProxy")
+	TArray<bool> CheckNameValues(const TArray<FName>& InValues, const TArray<FAruProxyValueContext>& InContexts) const;
 };
 
 USTRUCT(BlueprintType, DisplayName="Blueprint Proxy")
-struct FAruFilter_BlueprintProxy : public FAruFilter_Proxy
+struct ARUEDITORUTILITIES_API FAruFilter_BlueprintProxy : public FAruFilter_Proxy
 {
 	GENERATED_BODY()
 public:
 	virtual ~FAruFilter_BlueprintProxy() override {}
 
+	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+
+	virtual bool IsThreadSafe() const override { return false; }
+
 	// Initialize the ProxyInstance based on ProxyClass
 	void InitializeProxy(UObject* InOwner = nullptr);
 
@@ -85,9 +122,15 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Instanced)
 	TObjectPtr<UAruFilterProxy> ProxyInstance;
 
+	/** Result from the proxy's batch event for an array element, or unset when the scalar event has to be used. */
+	TOptional<bool> FindBatchedCondition(const FProperty* InProperty, const void* InValue) const;
+
 	virtual bool IsConditionMet_Internal(const bool InBoolValue, const FInstancedPropertyBag& InParameters) const override;
 	virtual bool IsConditionMet_Internal(const int32 InIntValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsConditionMet_Internal(const int64 InInt64Value, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsConditionMet_Internal(const uint8 InByteValue, const FInstancedPropertyBag& InParameters) const override;
 	virtual bool IsConditionMet_Internal(const float InFloatValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsConditionMet_Internal(const double InDoubleValue, const FInstancedPropertyBag& InParameters) const override;
 	virtual bool IsConditionMet_Internal(const FString& InStringValue, const FInstancedPropertyBag& InParameters) const override;
 	virtual bool IsConditionMet_Internal(const FText& InTextValue, const FInstancedPropertyBag& InParameters) const override;
 	virtual bool IsConditionMet_Internal(const UObject* InObjectValue, const FInstancedPropertyBag& InParameters) const override;
@@ -6,6 +6,8 @@
 #include "UObject/Object.h"
 #include "AruAssetObject.generated.h"
 
+class UAruAssetCollector;
+
 /**
  * Class that maintains a reference to a UObject and an FName
  */
@@ -53,4 +55,10 @@ protected:
 	/** The tags associated with this asset object */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Asset Object")
 	TArray<FName> AssetTags;
+
+private:
+	friend class UAruAssetCollector;
+
+	/** Collectors this object was added to, told about tags added later */
+	TArray<TWeakObjectPtr<UAruAssetCollector>> Collectors;
 };
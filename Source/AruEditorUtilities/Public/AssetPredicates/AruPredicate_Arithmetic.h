@@ -0,0 +1,147 @@
+#pragma once
+#include "AruTypes.h"
+#include "Curves/CurveFloat.h"
+#include "AruPredicate_Arithmetic.generated.h"
+
+/**
+ * Base for native arithmetic on numeric properties, specialized per numeric property class.
+ * With bBatchArrays, a numeric array matched as a whole is transformed in one pass, four lanes at a time for float and double elements.
+ * Float lanes are computed in double like single values, so batching never changes a result.
+ * Integer results are rounded and clamped to the range of the property's type.
+ */
+USTRUCT(meta=(Hidden))
+struct ARUEDITORUTILITIES_API FAruPredicate_Arithmetic : public FAruPredicate
+{
+	GENERATED_BODY()
+
+public:
+	FAruPredicate_Arithmetic() = default;
+	explicit FAruPredicate_Arithmetic(const bool bInBatchArrays) : bBatchArrays(bInBatchArrays) {}
+
+	virtual ~FAruPredicate_Arithmetic() override {};
+
+	virtual bool Execute(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const override;
+
+protected:
+	/**
+	 * Transforms a matched numeric array in one batched pass and ignores its elements, so no value is transformed twice.
+	 * Only enable it when the conditions select whole arrays: element-level conditions are never evaluated in that mode.
+	 */
+	UPROPERTY(EditDefaultsOnly, AdvancedDisplay)
+	bool bBatchArrays = false;
+
+	virtual FString GetCompactName() const { return {"ShouldBeOverride"}; }
+
+	virtual double ApplyScalar(const double Value) const { return Value; }
+
+	/** Four-lane version of ApplyScalar, which it has to match exactly. The default falls back to it lane by lane. */
+	virtual VectorRegister4Double ApplyDoubleRegister(const VectorRegister4Double& Value) const;
+
+private:
+	/** Returns the number of values that changed, or INDEX_NONE if the property class isn't supported. */
+	int32 ApplyToNumericValues(const FNumericProperty* NumericProperty, void* Values, const int32 Num) const;
+
+	template <typename T>
+	int32 ApplyToValues(T* Values, const int32 Num) const;
+};
+
+USTRUCT(BlueprintType, DisplayName="Scale Numeric Value")
+struct ARUEDITORUTILITIES_API FAruPredicate_ScaleNumeric : public FAruPredicate_Arithmetic
+{
+	GENERATED_BODY()
+
+public:
+	FAruPredicate_ScaleNumeric() = default;
+	explicit FAruPredicate_ScaleNumeric(const double InFactor, const bool bInBatchArrays = false) : FAruPredicate_Arithmetic(bInBatchArrays), Factor(InFactor) {}
+
+	virtual ~FAruPredicate_ScaleNumeric() override {};
+
+protected:
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	double Factor = 1.0;
+
+	virtual FString GetCompactName() const override { return {"ScaleNumeric"}; }
+	virtual double ApplyScalar(const double Value) const override;
+	virtual VectorRegister4Double ApplyDoubleRegister(const VectorRegister4Double& Value) const override;
+};
+
+USTRUCT(BlueprintType, DisplayName="Add Numeric Value")
+struct ARUEDITORUTILITIES_API FAruPredicate_AddNumeric : public FAruPredicate_Arithmetic
+{
+	GENERATED_BODY()
+
+public:
+	FAruPredicate_AddNumeric() = default;
+	explicit FAruPredicate_AddNumeric(const double InAddend, const bool bInBatchArrays = false) : FAruPredicate_Arithmetic(bInBatchArrays), Addend(InAddend) {}
+
+	virtual ~FAruPredicate_AddNumeric() override {};
+
+protected:
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	double Addend = 0.0;
+
+	virtual FString GetCompactName() const override { return {"AddNumeric"}; }
+	virtual double ApplyScalar(const double Value) const override;
+	virtual VectorRegister4Double ApplyDoubleRegister(const VectorRegister4Double& Value) const override;
+};
+
+USTRUCT(BlueprintType, DisplayName="Clamp Numeric Value")
+struct ARUEDITORUTILITIES_API FAruPredicate_ClampNumeric : public FAruPredicate_Arithmetic
+{
+	GENERATED_BODY()
+
+public:
+	FAruPredicate_ClampNumeric() = default;
+	FAruPredicate_ClampNumeric(const double InMin, const double InMax, const bool bInBatchArrays = false) : FAruPredicate_Arithmetic(bInBatchArrays), Min(InMin), Max(InMax) {}
+
+	virtual ~FAruPredicate_ClampNumeric() override {};
+
+protected:
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	double Min = 0.0;
+
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	double Max = 1.0;
+
+	virtual FString GetCompactName() const override { return {"ClampNumeric"}; }
+	virtual double ApplyScalar(const double Value) const override;
+	virtual VectorRegister4Double ApplyDoubleRegister(const VectorRegister4Double& Value) const override;
+};
+
+/** Rounds to the nearest multiple of Step, halves rounding up. */
+USTRUCT(BlueprintType, DisplayName="Round Numeric Value")
+struct ARUEDITORUTILITIES_API FAruPredicate_RoundNumeric : public FAruPredicate_Arithmetic
+{
+	GENERATED_BODY()
+
+public:
+	FAruPredicate_RoundNumeric() = default;
+	explicit FAruPredicate_RoundNumeric(const double InStep, const bool bInBatchArrays = false) : FAruPredicate_Arithmetic(bInBatchArrays), Step(InStep) {}
+
+	virtual ~FAruPredicate_RoundNumeric() override {};
+
+protected:
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay, meta=(ClampMin="0.000001"))
+	double Step = 1.0;
+
+	virtual FString GetCompactName() const override { return {"RoundNumeric"}; }
+	virtual double ApplyScalar(const double Value) const override;
+	virtual VectorRegister4Double ApplyDoubleRegister(const VectorRegister4Double& Value) const override;
+};
+
+/** Replaces each value with the curve evaluated at it. Values pass through unchanged while the curve has no keys. */
+USTRUCT(BlueprintType, DisplayName="Remap Numeric Value By Curve")
+struct ARUEDITORUTILITIES_API FAruPredicate_RemapNumericByCurve : public FAruPredicate_Arithmetic
+{
+	GENERATED_BODY()
+
+public:
+	virtual ~FAruPredicate_RemapNumericByCurve() override {};
+
+protected:
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	FRuntimeFloatCurve Curve;
+
+	virtual FString GetCompactName() const override { return {"RemapNumericByCurve"}; }
+	virtual double ApplyScalar(const double Value) const override;
+};
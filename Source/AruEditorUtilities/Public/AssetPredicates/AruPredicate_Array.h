@@ -3,11 +3,14 @@
 #include "AruPredicate_Array.generated.h"
 
 USTRUCT(BlueprintType, DisplayName="Add Value to Array")
-struct FAruPredicate_AddArrayValue : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_AddArrayValue : public FAruPredicate
 {
 	GENERATED_BODY()
 
 public:
+	FAruPredicate_AddArrayValue() = default;
+	explicit FAruPredicate_AddArrayValue(TArray<TInstancedStruct<FAruPredicate>> InPredicates) : Predicates(MoveTemp(InPredicates)) {}
+
 	virtual ~FAruPredicate_AddArrayValue() override {}
 
 	virtual bool Execute(
@@ -15,6 +18,10 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual void GatherPreloads(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, TArray<FSoftObjectPath>& OutPaths) const override;
+
+	virtual bool IsThreadSafe() const override { return Aru::AreThreadSafe(Predicates); }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
 	TArray<TInstancedStruct<FAruPredicate>> Predicates;
@@ -25,11 +32,14 @@ private:
 
 
 USTRUCT(BlueprintType, DisplayName="Remove Value(s) from Array")
-struct FAruPredicate_RemoveArrayValue : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_RemoveArrayValue : public FAruPredicate
 {
 	GENERATED_BODY()
 
 public:
+	FAruPredicate_RemoveArrayValue() = default;
+	explicit FAruPredicate_RemoveArrayValue(TArray<TInstancedStruct<FAruFilter>> InFilters) : Filters(MoveTemp(InFilters)) {}
+
 	virtual ~FAruPredicate_RemoveArrayValue() override {}
 
 	virtual bool Execute(
@@ -37,6 +47,8 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual bool IsThreadSafe() const override { return Aru::AreThreadSafe(Filters); }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
 	TArray<TInstancedStruct<FAruFilter>> Filters;
@@ -46,11 +58,14 @@ private:
 };
 
 USTRUCT(BlueprintType, DisplayName="Modify Value(s) from Array")
-struct FAruPredicate_ModifyArrayValue : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_ModifyArrayValue : public FAruPredicate
 {
 	GENERATED_BODY()
 
 public:
+	FAruPredicate_ModifyArrayValue() = default;
+	FAruPredicate_ModifyArrayValue(TArray<TInstancedStruct<FAruFilter>> InFilters, TArray<TInstancedStruct<FAruPredicate>> InPredicates) : Filters(MoveTemp(InFilters)), Predicates(MoveTemp(InPredicates)) {}
+
 	virtual ~FAruPredicate_ModifyArrayValue() override {}
 
 	virtual bool Execute(
@@ -58,6 +73,10 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual void GatherPreloads(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, TArray<FSoftObjectPath>& OutPaths) const override;
+
+	virtual bool IsThreadSafe() const override { return Aru::AreThreadSafe(Filters) && Aru::AreThreadSafe(Predicates); }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
 	TArray<TInstancedStruct<FAruFilter>> Filters;
@@ -2,8 +2,34 @@
 #include "AruTypes.h"
 #include "AruPredicate_AssetPathRedirector.generated.h"
 
+/**
+ * Replacement map with its parameters resolved and its keys ordered longest first.
+ * Built once per run; rewritten segments and whole paths are memoized, so a path seen before costs one lookup.
+ */
+struct FAruCompiledRedirects : public FNoncopyable
+{
+	FAruCompiledRedirects(const TMap<FString, FString>& InReplacementMap, const FInstancedPropertyBag& InParameters);
+
+	/** Applies the replacements to every segment of the source path. */
+	FString Redirect(const FString& SourcePath);
+
+private:
+	FString RedirectSegment(const FString& Segment) const;
+
+	TArray<TPair<FString, FString>> Replacements;
+
+	FCriticalSection Lock;
+	TMap<FString, FString> SegmentMemo;
+	TMap<FString, FString> PathMemo;
+};
+
+/**
+ * Rewrites object references through the replacement map.
+ * Hard references load the new asset to verify it; soft references are rewritten in place and verified
+ * against the asset registry, so they never load anything.
+ */
 USTRUCT(BlueprintType, DisplayName="Redirect Asset Path")
-struct FAruPredicate_AssetPathRedirector : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_AssetPathRedirector : public FAruPredicate
 {
 	GENERATED_BODY()
 
@@ -11,6 +37,9 @@ public:
 	UPROPERTY(EditDefaultsOnly)
 	TMap<FString, FString> ReplacementMap;
 
+	FAruPredicate_AssetPathRedirector() = default;
+	explicit FAruPredicate_AssetPathRedirector(TMap<FString, FString> InReplacementMap) : ReplacementMap(MoveTemp(InReplacementMap)) {}
+
 	virtual ~FAruPredicate_AssetPathRedirector() override {}
 
 	virtual bool Execute(
@@ -18,6 +47,21 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual void GatherPreloads(
+		const FProperty* InProperty,
+		const void* InValue,
+		const FInstancedPropertyBag& InParameters,
+		TArray<FSoftObjectPath>& OutPaths) const override;
+
+	/** Hard references load the new asset. */
+	virtual bool IsThreadSafe() const override { return false; }
+
 private:
 	static FString GetCompactName() { return {"RedirectPath"}; }
+
+	/** Soft reference branch of Execute. The new path must be known to the asset registry with a compatible class. */
+	bool RedirectSoftReference(const FSoftObjectProperty* SoftProperty, void* InValue, const FInstancedPropertyBag& InParameters) const;
+
+	/** Redirects through the run's compiled table, or compiles a temporary one outside a run. */
+	FString GetRedirectedPath(const FString& SourcePath, const FInstancedPropertyBag& InParameters) const;
 };
@@ -4,7 +4,7 @@
 #include "AruPredicate_GameplayTag.generated.h"
 
 USTRUCT(BlueprintType, DisplayName="Set GameplayTag")
-struct FAruPredicate_SetGameplayTag : public FAruPredicate_PropertySetter
+struct ARUEDITORUTILITIES_API FAruPredicate_SetGameplayTag : public FAruPredicate_PropertySetter
 {
 	GENERATED_BODY()
 
@@ -15,6 +15,9 @@ protected:
 	virtual FString GetCompactName() const override { return {"SetGameplayTagValue"}; }
 
 public:
+	FAruPredicate_SetGameplayTag() = default;
+	explicit FAruPredicate_SetGameplayTag(const FGameplayTag& InNewValue) : NewValue(InNewValue) {}
+
 	virtual ~FAruPredicate_SetGameplayTag() override {}
 	virtual const UScriptStruct* GetScriptedStruct() const override { return StaticStruct(); }
 
@@ -25,7 +28,7 @@ public:
 };
 
 USTRUCT(BlueprintType, DisplayName="Set GameplayTag Container")
-struct FAruPredicate_SetGameplayTagContainer : public FAruPredicate_PropertySetter
+struct ARUEDITORUTILITIES_API FAruPredicate_SetGameplayTagContainer : public FAruPredicate_PropertySetter
 {
 	GENERATED_BODY()
 
@@ -36,6 +39,9 @@ protected:
 	virtual FString GetCompactName() const override { return {"SetGameplayTagContainerValue"}; }
 	
 public:
+	FAruPredicate_SetGameplayTagContainer() = default;
+	explicit FAruPredicate_SetGameplayTagContainer(const FGameplayTagContainer& InNewValue) : NewValue(InNewValue) {}
+
 	virtual ~FAruPredicate_SetGameplayTagContainer() override {}
 	virtual const UScriptStruct* GetScriptedStruct() const override { return StaticStruct(); }
 
@@ -2,8 +2,12 @@
 #include "AruTypes.h"
 #include "AruPredicate_LoadAssetByPath.generated.h"
 
+/**
+ * Points an object reference at the asset found by path.
+ * Soft references are assigned the path without loading; the asset registry is used to check its class.
+ */
 USTRUCT(BlueprintType, DisplayName="Load Asset By Path")
-struct FAruPredicate_LoadAssetByPath : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_LoadAssetByPath : public FAruPredicate
 {
 	GENERATED_BODY()
 
@@ -19,7 +23,18 @@ public:
 	virtual ~FAruPredicate_LoadAssetByPath() override {};
 
 	virtual bool Execute(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const override;
+
+	virtual void GatherPreloads(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, TArray<FSoftObjectPath>& OutPaths) const override;
+
+	/** Hard references load the asset. */
+	virtual bool IsThreadSafe() const override { return false; }
 	
 private:
 	static FString GetCompactName() { return {"LoadAsset"}; }
+
+	/** PathToAsset with every parameterized segment resolved. */
+	FString ResolveAssetPath(const FInstancedPropertyBag& InParameters) const;
+
+	/** Soft reference branch of Execute. */
+	bool AssignSoftReference(const FSoftObjectProperty* SoftProperty, void* InValue, const FInstancedPropertyBag& InParameters) const;
 };
@@ -3,11 +3,14 @@
 #include "AruPredicate_Map.generated.h"
 
 USTRUCT(BlueprintType, DisplayName="Add Pair to Map")
-struct FAruPredicate_AddMapPair : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_AddMapPair : public FAruPredicate
 {
 	GENERATED_BODY()
 
 public:
+	FAruPredicate_AddMapPair() = default;
+	FAruPredicate_AddMapPair(TArray<TInstancedStruct<FAruPredicate>> InPredicatesForKey, TArray<TInstancedStruct<FAruPredicate>> InPredicatesForValue) : PredicatesForKey(MoveTemp(InPredicatesForKey)), PredicatesForValue(MoveTemp(InPredicatesForValue)) {}
+
 	virtual ~FAruPredicate_AddMapPair() override {};
 
 	virtual bool Execute(
@@ -15,6 +18,10 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual void GatherPreloads(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, TArray<FSoftObjectPath>& OutPaths) const override;
+
+	virtual bool IsThreadSafe() const override { return Aru::AreThreadSafe(PredicatesForKey) && Aru::AreThreadSafe(PredicatesForValue); }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
 	TArray<TInstancedStruct<FAruPredicate>> PredicatesForKey;
@@ -26,11 +33,14 @@ private:
 };
 
 USTRUCT(BlueprintType, DisplayName="Remove Pair(s) from Map")
-struct FAruPredicate_RemoveMapPair : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_RemoveMapPair : public FAruPredicate
 {
 	GENERATED_BODY()
 
 public:
+	FAruPredicate_RemoveMapPair() = default;
+	FAruPredicate_RemoveMapPair(TArray<TInstancedStruct<FAruFilter>> InKeyFilters, TArray<TInstancedStruct<FAruFilter>> InValueFilters) : KeyFilters(MoveTemp(InKeyFilters)), ValueFilters(MoveTemp(InValueFilters)) {}
+
 	virtual ~FAruPredicate_RemoveMapPair() override {};
 
 	virtual bool Execute(
@@ -38,6 +48,8 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual bool IsThreadSafe() const override { return Aru::AreThreadSafe(KeyFilters) && Aru::AreThreadSafe(ValueFilters); }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
 	TArray<TInstancedStruct<FAruFilter>> KeyFilters;
@@ -49,11 +61,14 @@ private:
 };
 
 USTRUCT(BlueprintType, DisplayName="Modify Pair(s) from Map")
-struct FAruPredicate_ModifyMapPair : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_ModifyMapPair : public FAruPredicate
 {
 	GENERATED_BODY()
 
 public:
+	FAruPredicate_ModifyMapPair() = default;
+	FAruPredicate_ModifyMapPair(TArray<TInstancedStruct<FAruFilter>> InKeyFilters, TArray<TInstancedStruct<FAruFilter>> InValueFilters, TArray<TInstancedStruct<FAruPredicate>> InPredicatesForKey, TArray<TInstancedStruct<FAruPredicate>> InPredicatesForValue) : KeyFilters(MoveTemp(InKeyFilters)), ValueFilters(MoveTemp(InValueFilters)), PredicatesForKey(MoveTemp(InPredicatesForKey)), PredicatesForValue(MoveTemp(InPredicatesForValue)) {}
+
 	virtual ~FAruPredicate_ModifyMapPair() override {};
 
 	virtual bool Execute(
@@ -61,6 +76,11 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual void GatherPreloads(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, TArray<FSoftObjectPath>& OutPaths) const override;
+
+	virtual bool IsThreadSafe() const override { return Aru::AreThreadSafe(KeyFilters) && Aru::AreThreadSafe(ValueFilters)
+		&& Aru::AreThreadSafe(PredicatesForKey) && Aru::AreThreadSafe(PredicatesForValue); }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
 	TArray<TInstancedStruct<FAruFilter>> KeyFilters;
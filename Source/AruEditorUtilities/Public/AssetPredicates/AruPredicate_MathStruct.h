@@ -0,0 +1,90 @@
+#pragma once
+#include "AruTypes.h"
+#include "AruPredicate_MathStruct.generated.h"
+
+/**
+ * Base for setters that edit an FVector, FRotator, FLinearColor or FTransform part as one SIMD register.
+ * Vectors and rotators use XYZ of the operands, colors use RGBA.
+ */
+USTRUCT(meta=(Hidden))
+struct ARUEDITORUTILITIES_API FAruPredicate_MathStruct : public FAruPredicate
+{
+	GENERATED_BODY()
+
+public:
+	FAruPredicate_MathStruct() = default;
+	explicit FAruPredicate_MathStruct(const EAruTransformComponent InTransformComponent) : TransformComponent(InTransformComponent) {}
+
+	virtual ~FAruPredicate_MathStruct() override {};
+
+	virtual bool Execute(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const override;
+
+protected:
+	UPROPERTY(EditDefaultsOnly, meta=(DisplayPriority = 0))
+	EAruTransformComponent TransformComponent = EAruTransformComponent::Translation;
+
+	virtual FString GetCompactName() const { return {"ShouldBeOverride"}; }
+
+	/** Returns the new components computed from the current ones. */
+	virtual VectorRegister4Double Apply(const VectorRegister4Double& Value) const { return Value; }
+};
+
+USTRUCT(BlueprintType, DisplayName="Scale Math Struct")
+struct ARUEDITORUTILITIES_API FAruPredicate_ScaleMathStruct : public FAruPredicate_MathStruct
+{
+	GENERATED_BODY()
+
+public:
+	FAruPredicate_ScaleMathStruct() = default;
+	FAruPredicate_ScaleMathStruct(const EAruTransformComponent InTransformComponent, const FVector4& InFactor) : FAruPredicate_MathStruct(InTransformComponent), Factor(InFactor) {}
+
+	virtual ~FAruPredicate_ScaleMathStruct() override {};
+
+protected:
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	FVector4 Factor{1.0, 1.0, 1.0, 1.0};
+
+	virtual FString GetCompactName() const override { return {"ScaleMathStruct"}; }
+	virtual VectorRegister4Double Apply(const VectorRegister4Double& Value) const override;
+};
+
+USTRUCT(BlueprintType, DisplayName="Offset Math Struct")
+struct ARUEDITORUTILITIES_API FAruPredicate_OffsetMathStruct : public FAruPredicate_MathStruct
+{
+	GENERATED_BODY()
+
+public:
+	FAruPredicate_OffsetMathStruct() = default;
+	FAruPredicate_OffsetMathStruct(const EAruTransformComponent InTransformComponent, const FVector4& InOffset) : FAruPredicate_MathStruct(InTransformComponent), Offset(InOffset) {}
+
+	virtual ~FAruPredicate_OffsetMathStruct() override {};
+
+protected:
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	FVector4 Offset{0.0, 0.0, 0.0, 0.0};
+
+	virtual FString GetCompactName() const override { return {"OffsetMathStruct"}; }
+	virtual VectorRegister4Double Apply(const VectorRegister4Double& Value) const override;
+};
+
+USTRUCT(BlueprintType, DisplayName="Clamp Math Struct")
+struct ARUEDITORUTILITIES_API FAruPredicate_ClampMathStruct : public FAruPredicate_MathStruct
+{
+	GENERATED_BODY()
+
+public:
+	FAruPredicate_ClampMathStruct() = default;
+	FAruPredicate_ClampMathStruct(const EAruTransformComponent InTransformComponent, const FVector4& InMin, const FVector4& InMax) : FAruPredicate_MathStruct(InTransformComponent), Min(InMin), Max(InMax) {}
+
+	virtual ~FAruPredicate_ClampMathStruct() override {};
+
+protected:
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	FVector4 Min{0.0, 0.0, 0.0, 0.0};
+
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	FVector4 Max{1.0, 1.0, 1.0, 1.0};
+
+	virtual FString GetCompactName() const override { return {"ClampMathStruct"}; }
+	virtual VectorRegister4Double Apply(const VectorRegister4Double& Value) const override;
+};
@@ -3,10 +3,13 @@
 #include "AruPredicate_PathToProperty.generated.h"
 
 USTRUCT(BlueprintType, DisplayName="Path To Property")
-struct FAruPredicate_PathToProperty : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_PathToProperty : public FAruPredicate
 {
 	GENERATED_BODY()
 public:
+	FAruPredicate_PathToProperty() = default;
+	FAruPredicate_PathToProperty(const FString& InPathToProperty, TInstancedStruct<FAruPredicate> InPredicate)
+		: PathToProperty(InPathToProperty), Predicate(MoveTemp(InPredicate)) {}
 	virtual ~FAruPredicate_PathToProperty() override {};
 
 	virtual bool Execute(
@@ -14,6 +17,10 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual void GatherPreloads(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, TArray<FSoftObjectPath>& OutPaths) const override;
+
+	virtual bool IsThreadSafe() const override { return !Predicate.IsValid() || Predicate.Get<const FAruPredicate>().IsThreadSafe(); }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
 	FString PathToProperty{"Path.To.Your.Property"};
@@ -22,5 +29,8 @@ protected:
 	TInstancedStruct<FAruPredicate> Predicate;
 
 private:
+	/** The path with every parameterized segment resolved. */
+	FString ResolvePath(const FInstancedPropertyBag& InParameters) const;
+
 	static FString GetCompactName() { return {"FindPropertyByPath"}; }
 };
@@ -1,5 +1,7 @@
 ﻿#pragma once
 #include "AruTypes.h"
+#include "AruRunLog.h"
+#include "AruValueUtils.h"
 #include "StructUtils/PropertyBag.h"
 #include "AruPredicate_PropertySetter.generated.h"
 
@@ -15,7 +17,7 @@ enum class EAruValueSource : uint8
 };
 
 USTRUCT(meta=(Hidden))
-struct FAruPredicate_PropertySetter : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_PropertySetter : public FAruPredicate
 {
 	GENERATED_BODY()
 
@@ -59,52 +61,43 @@ protected:
 	}
 
 	template <typename T, typename = std::enable_if_t<std::is_base_of_v<FProperty, std::decay_t<T>>>>
-	bool SetPropertyValue(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const
+	EAruWriteResult SetPropertyValue(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const
 	{
 		if (InProperty == nullptr || InValue == nullptr)
 		{
-			return false;
+			return EAruWriteResult::Failed;
 		}
 
 		const T* SubProperty = CastField<T>(InProperty);
 		if (SubProperty == nullptr)
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_PropertyTypeMismatch",
-					"[{0}][{1}]Property:'{2}' type mismatches."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
-			));
-			return false;
+			ARU_LOG(Warning,
+				LOCTEXT("PropertySetter_PropertyTypeMismatch", "[{0}][{1}]Property:'{2}' type mismatches."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName());
+			return EAruWriteResult::Failed;
 		}
 
 		TOptional<const void*> OptionalValue = GetNewValueBySourceType<T>(InParameters);
 		if (!OptionalValue.IsSet())
 		{
-			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"PropertySetter_NewValueNoFound",
-					"[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
-						FText::FromString(GetCompactName()),
-						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
-				FText::FromString(StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource))
-			));
-			return false;
+			ARU_LOG(Warning,
+				LOCTEXT("PropertySetter_NewValueNoFound", "[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
+				GetCompactName(),
+				Aru::ProcessResult::Failed,
+				InProperty->GetFName(),
+				StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource));
+			return EAruWriteResult::Failed;
 		}
 
 		const void* PendingValue = OptionalValue.GetValue();
 		if (PendingValue == nullptr)
 		{
-			return false;
+			return EAruWriteResult::Failed;
 		}
 
-		SubProperty->CopyCompleteValue(InValue, PendingValue);
-		return true;
+		return Aru::Value::CopyIfChanged(SubProperty, InValue, PendingValue);
 	}
 
 private:
@@ -137,7 +130,7 @@ private:
 };
 
 USTRUCT(BlueprintType, DisplayName="Set Bool Value")
-struct FAruPredicate_SetBoolValue : public FAruPredicate_PropertySetter
+struct ARUEDITORUTILITIES_API FAruPredicate_SetBoolValue : public FAruPredicate_PropertySetter
 {
 	GENERATED_BODY()
 
@@ -146,6 +139,9 @@ protected:
 	bool NewValue = false;
 
 public:
+	FAruPredicate_SetBoolValue() = default;
+	explicit FAruPredicate_SetBoolValue(const bool InNewValue) : NewValue(InNewValue) {}
+
 	virtual ~FAruPredicate_SetBoolValue() override {}
 	virtual const UScriptStruct* GetScriptedStruct() const override { return StaticStruct(); }
 
@@ -159,7 +155,7 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Set Float Value")
-struct FAruPredicate_SetFloatValue : public FAruPredicate_PropertySetter
+struct ARUEDITORUTILITIES_API FAruPredicate_SetFloatValue : public FAruPredicate_PropertySetter
 {
 	GENERATED_BODY()
 
@@ -168,6 +164,9 @@ protected:
 	float NewValue = 0.f;
 
 public:
+	FAruPredicate_SetFloatValue() = default;
+	explicit FAruPredicate_SetFloatValue(const float InNewValue) : NewValue(InNewValue) {}
+
 	virtual ~FAruPredicate_SetFloatValue() override {}
 	virtual const UScriptStruct* GetScriptedStruct() const override { return StaticStruct(); }
 
@@ -181,7 +180,7 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Set Integer Value")
-struct FAruPredicate_SetIntegerValue : public FAruPredicate_PropertySetter
+struct ARUEDITORUTILITIES_API FAruPredicate_SetIntegerValue : public FAruPredicate_PropertySetter
 {
 	GENERATED_BODY()
 
@@ -190,6 +189,9 @@ protected:
 	int64 NewValue = 0;
 
 public:
+	FAruPredicate_SetIntegerValue() = default;
+	explicit FAruPredicate_SetIntegerValue(const int64 InNewValue) : NewValue(InNewValue) {}
+
 	virtual ~FAruPredicate_SetIntegerValue() override {}
 	virtual const UScriptStruct* GetScriptedStruct() const override { return StaticStruct(); }
 
@@ -203,7 +205,7 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Set String Value")
-struct FAruPredicate_SetStringValue : public FAruPredicate_PropertySetter
+struct ARUEDITORUTILITIES_API FAruPredicate_SetStringValue : public FAruPredicate_PropertySetter
 {
 	GENERATED_BODY()
 
@@ -212,6 +214,9 @@ protected:
 	FString NewValue{};
 
 public:
+	FAruPredicate_SetStringValue() = default;
+	explicit FAruPredicate_SetStringValue(const FString& InNewValue) : NewValue(InNewValue) {}
+
 	virtual ~FAruPredicate_SetStringValue() override {}
 	virtual const UScriptStruct* GetScriptedStruct() const override { return StaticStruct(); }
 
@@ -225,7 +230,7 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Set Text Value")
-struct FAruPredicate_SetTextValue : public FAruPredicate_PropertySetter
+struct ARUEDITORUTILITIES_API FAruPredicate_SetTextValue : public FAruPredicate_PropertySetter
 {
 	GENERATED_BODY()
 
@@ -234,6 +239,9 @@ protected:
 	FString NewValue{};
 
 public:
+	FAruPredicate_SetTextValue() = default;
+	explicit FAruPredicate_SetTextValue(const FString& InNewValue) : NewValue(InNewValue) {}
+
 	virtual ~FAruPredicate_SetTextValue() override {}
 	virtual const UScriptStruct* GetScriptedStruct() const override { return StaticStruct(); }
 
@@ -247,7 +255,7 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Set Name Value")
-struct FAruPredicate_SetNameValue : public FAruPredicate_PropertySetter
+struct ARUEDITORUTILITIES_API FAruPredicate_SetNameValue : public FAruPredicate_PropertySetter
 {
 	GENERATED_BODY()
 
@@ -256,6 +264,9 @@ protected:
 	FName NewValue = FName{};
 
 public:
+	FAruPredicate_SetNameValue() = default;
+	explicit FAruPredicate_SetNameValue(const FName InNewValue) : NewValue(InNewValue) {}
+
 	virtual ~FAruPredicate_SetNameValue() override {}
 	virtual const UScriptStruct* GetScriptedStruct() const override { return StaticStruct(); }
 
@@ -269,7 +280,7 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Set Enum Value")
-struct FAruPredicate_SetEnumValue : public FAruPredicate_PropertySetter
+struct ARUEDITORUTILITIES_API FAruPredicate_SetEnumValue : public FAruPredicate_PropertySetter
 {
 	GENERATED_BODY()
 
@@ -278,6 +289,9 @@ protected:
 	FString NewValue{};
 
 public:
+	FAruPredicate_SetEnumValue() = default;
+	explicit FAruPredicate_SetEnumValue(const FString& InNewValue) : NewValue(InNewValue) {}
+
 	virtual ~FAruPredicate_SetEnumValue() override {}
 	virtual const UScriptStruct* GetScriptedStruct() const override { return StaticStruct(); }
 
@@ -291,7 +305,7 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Set Struct Value")
-struct FAruPredicate_SetStructValue : public FAruPredicate_PropertySetter
+struct ARUEDITORUTILITIES_API FAruPredicate_SetStructValue : public FAruPredicate_PropertySetter
 {
 	GENERATED_BODY()
 
@@ -300,6 +314,9 @@ protected:
 	FInstancedStruct NewValue;
 
 public:
+	FAruPredicate_SetStructValue() = default;
+	explicit FAruPredicate_SetStructValue(const FInstancedStruct& InNewValue) : NewValue(InNewValue) {}
+
 	virtual ~FAruPredicate_SetStructValue() override {}
 	virtual const UScriptStruct* GetScriptedStruct() const override { return StaticStruct(); }
 
@@ -313,7 +330,7 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Set Object Value")
-struct FAruPredicate_SetObjectValue : public FAruPredicate_PropertySetter
+struct ARUEDITORUTILITIES_API FAruPredicate_SetObjectValue : public FAruPredicate_PropertySetter
 {
 	GENERATED_BODY()
 
@@ -322,6 +339,9 @@ protected:
 	TObjectPtr<UObject> NewValue = nullptr;
 
 public:
+	FAruPredicate_SetObjectValue() = default;
+	explicit FAruPredicate_SetObjectValue(UObject* InNewValue) : NewValue(InNewValue) {}
+
 	virtual ~FAruPredicate_SetObjectValue() override {}
 	virtual const UScriptStruct* GetScriptedStruct() const override { return StaticStruct(); }
 
@@ -335,7 +355,7 @@ protected:
 };
 
 USTRUCT(BlueprintType, DisplayName="Set Instanced Struct Value")
-struct FAruPredicate_SetInstancedStructValue : public FAruPredicate_PropertySetter
+struct ARUEDITORUTILITIES_API FAruPredicate_SetInstancedStructValue : public FAruPredicate_PropertySetter
 {
 	GENERATED_BODY()
 
@@ -344,6 +364,9 @@ protected:
 	FInstancedStruct NewValue;
 
 public:
+	FAruPredicate_SetInstancedStructValue() = default;
+	explicit FAruPredicate_SetInstancedStructValue(const FInstancedStruct& InNewValue) : NewValue(InNewValue) {}
+
 	virtual ~FAruPredicate_SetInstancedStructValue() override {}
 	virtual const UScriptStruct* GetScriptedStruct() const override { return StaticStruct(); }
 
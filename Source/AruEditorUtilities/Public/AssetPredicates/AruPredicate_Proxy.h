@@ -3,7 +3,7 @@
 #include "AruPredicate_Proxy.generated.h"
 
 USTRUCT(meta=(Hidden))
-struct FAruPredicate_Proxy : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_Proxy : public FAruPredicate
 {
 	GENERATED_BODY()
 public:
@@ -12,7 +12,10 @@ public:
 protected:
 	virtual bool ExecuteBoolValue(const bool InBoolValue, const FInstancedPropertyBag& InParameters) const {return InBoolValue;}
 	virtual int32 ExecuteIntegerValue(const int32 InIntValue, const FInstancedPropertyBag& InParameters) const {return InIntValue;}
+	virtual int64 ExecuteInt64Value(const int64 InInt64Value, const FInstancedPropertyBag& InParameters) const {return InInt64Value;}
+	virtual uint8 ExecuteByteValue(const uint8 InByteValue, const FInstancedPropertyBag& InParameters) const {return InByteValue;}
 	virtual float ExecuteFloatValue(const float InFloatValue, const FInstancedPropertyBag& InParameters) const {return InFloatValue;}
+	virtual double ExecuteDoubleValue(const double InDoubleValue, const FInstancedPropertyBag& InParameters) const {return InDoubleValue;}
 	virtual FString ExecuteStringValue(const FString& InStringValue, const FInstancedPropertyBag& InParameters) const {return InStringValue;}
 	virtual FText ExecuteTextValue(const FText& InTextValue, const FInstancedPropertyBag& InParameters) const {return InTextValue;}
 	virtual UObject* ExecuteObjectValue(const UObject* InObjectValue, const FInstancedPropertyBag& InParameters) const {return nullptr;}
@@ -37,9 +40,24 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category="AruPredicateProxy")
 	int32 ProcessIntValue(const int32 InIntValue) const;
 
+	/**
+	 * Also receives int8, int16, uint16, uint32 and uint64 values; results are clamped to the property's range.
+	 * Properties of these types are left untouched unless this event is implemented.
+	 */
+	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category="AruPredicateProxy")
+	int64 ProcessInt64Value(const int64 InInt64Value) const;
+
+	/** Properties of this type are left untouched unless this event is implemented. */
+	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category="AruPredicateProxy")
+	uint8 ProcessByteValue(const uint8 InByteValue) const;
+
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category="AruPredicateProxy")
 	float ProcessFloatValue(const float InFloatValue) const;
 
+	/** Properties of this type are left untouched unless this event is implemented. */
+	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category="AruPredicateProxy")
+	double ProcessDoubleValue(const double InDoubleValue) const;
+
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category="AruPredicateProxy")
 	FString ProcessStringValue(const FString& InStringValue) const;
 
@@ -66,28 +84,64 @@ public:
 
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category="AruPredicateProxy")
 	int64 ProcessEnumValue(const int64 InEnumValue, const UEnum* InEnumType) const;
+
+	/*
+	 * Batch events, called once per visited array with all of its elements instead of once per element.
+	 * Return one new value per input; any other count falls back to the scalar event.
+	 * Only overrides made in Blueprint are used, and the defaults forward to the scalar events.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruPredicateProxy")
+	TArray<bool> ProcessBoolValues(const TArray<bool>& InValues, const TArray<FAruProxyValueContext>& InContexts) const;
+
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruPredicateProxy")
+	TArray<int32> ProcessIntValues(const TArray<int32>& InValues, const TArray<FAruProxyValueContext>& InContexts) const;
+
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruPredicateProxy")
+	TArray<float> ProcessFloatValues(const TArray<float>& InValues, const TArray<FAruProxyValueContext>& InContexts) const;
+
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruPredicateProxy")
+	TArray<FString> ProcessStringValues(const TArray<FString>& InValues, const TArray<FAruProxyValueContext>& InContexts) const;
+
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="AruPredicateProxy")
+	TArray<FName> ProcessNameValues(const TArray<FName>& InValues, const TArray<FAruProxyValueContext>& InContexts) const;
 };
 
 USTRUCT(BlueprintType, DisplayName="Blueprint Proxy")
-struct FAruPredicate_BlueprintProxy : public FAruPredicate_Proxy
+struct ARUEDITORUTILITIES_API FAruPredicate_BlueprintProxy : public FAruPredicate_Proxy
 {
 	GENERATED_BODY()
 public:
 	virtual ~FAruPredicate_BlueprintProxy() override {}
 
+	virtual bool Execute(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const override;
+
+	virtual bool IsThreadSafe() const override { return false; }
+
 	// Initialize the ProxyInstance based on ProxyClass
 	void InitializeProxy(UObject* InOwner = nullptr);
 
+	// Helper function to ensure ProxyInstance is initialized before use
+	bool EnsureProxyInitialized() const;
+
 protected:
 	UPROPERTY(EditDefaultsOnly)
 	TSubclassOf<UAruPredicateProxy> ProxyClass;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Instanced)
 	TObjectPtr<UAruPredicateProxy> ProxyInstance;
+
+	/**
+	 * Writes the proxy's batch result for an array element.
+	 * Returns whether the value changed, or unset when the scalar event has to be used.
+	 */
+	TOptional<bool> ExecuteBatched(const FProperty* InProperty, void* InValue) const;
 	
 	virtual bool ExecuteBoolValue(const bool InBoolValue, const FInstancedPropertyBag& InParameters) const override;
 	virtual int32 ExecuteIntegerValue(const int32 InIntValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual int64 ExecuteInt64Value(const int64 InInt64Value, const FInstancedPropertyBag& InParameters) const override;
+	virtual uint8 ExecuteByteValue(const uint8 InByteValue, const FInstancedPropertyBag& InParameters) const override;
 	virtual float ExecuteFloatValue(const float InFloatValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual double ExecuteDoubleValue(const double InDoubleValue, const FInstancedPropertyBag& InParameters) const override;
 	virtual FString ExecuteStringValue(const FString& InStringValue, const FInstancedPropertyBag& InParameters) const override;
 	virtual FText ExecuteTextValue(const FText& InTextValue, const FInstancedPropertyBag& InParameters) const override;
 	virtual UObject* ExecuteObjectValue(const UObject* InObjectValue, const FInstancedPropertyBag& InParameters) const override;
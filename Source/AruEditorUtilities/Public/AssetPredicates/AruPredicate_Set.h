@@ -3,11 +3,14 @@
 #include "AruPredicate_Set.generated.h"
 
 USTRUCT(BlueprintType, DisplayName="Add Element to Set")
-struct FAruPredicate_AddSetElement : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_AddSetElement : public FAruPredicate
 {
 	GENERATED_BODY()
 
 public:
+	FAruPredicate_AddSetElement() = default;
+	explicit FAruPredicate_AddSetElement(TArray<TInstancedStruct<FAruPredicate>> InPredicates) : Predicates(MoveTemp(InPredicates)) {}
+
 	virtual ~FAruPredicate_AddSetElement() override {};
 
 	virtual bool Execute(
@@ -15,6 +18,10 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual void GatherPreloads(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, TArray<FSoftObjectPath>& OutPaths) const override;
+
+	virtual bool IsThreadSafe() const override { return Aru::AreThreadSafe(Predicates); }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
 	TArray<TInstancedStruct<FAruPredicate>> Predicates;
@@ -23,11 +30,14 @@ private:
 };
 
 USTRUCT(BlueprintType, DisplayName="Remove Element(s) from Set")
-struct FAruPredicate_RemoveSetValue : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_RemoveSetValue : public FAruPredicate
 {
 	GENERATED_BODY()
 
 public:
+	FAruPredicate_RemoveSetValue() = default;
+	explicit FAruPredicate_RemoveSetValue(TArray<TInstancedStruct<FAruFilter>> InFilters) : Filters(MoveTemp(InFilters)) {}
+
 	virtual ~FAruPredicate_RemoveSetValue() override {};
 
 	virtual bool Execute(
@@ -35,6 +45,8 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual bool IsThreadSafe() const override { return Aru::AreThreadSafe(Filters); }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
 	TArray<TInstancedStruct<FAruFilter>> Filters;
@@ -43,11 +55,14 @@ private:
 };
 
 USTRUCT(BlueprintType, DisplayName="Modify Element(s) from Set")
-struct FAruPredicate_ModifySetValue : public FAruPredicate
+struct ARUEDITORUTILITIES_API FAruPredicate_ModifySetValue : public FAruPredicate
 {
 	GENERATED_BODY()
 
 public:
+	FAruPredicate_ModifySetValue() = default;
+	FAruPredicate_ModifySetValue(TArray<TInstancedStruct<FAruFilter>> InFilters, TArray<TInstancedStruct<FAruPredicate>> InPredicates) : Filters(MoveTemp(InFilters)), Predicates(MoveTemp(InPredicates)) {}
+
 	virtual ~FAruPredicate_ModifySetValue() override {};
 
 	virtual bool Execute(
@@ -55,6 +70,10 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual void GatherPreloads(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, TArray<FSoftObjectPath>& OutPaths) const override;
+
+	virtual bool IsThreadSafe() const override { return Aru::AreThreadSafe(Filters) && Aru::AreThreadSafe(Predicates); }
+
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
 	TArray<TInstancedStruct<FAruFilter>> Filters;